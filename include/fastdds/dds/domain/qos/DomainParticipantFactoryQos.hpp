@@ -22,6 +22,7 @@
 
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -53,7 +54,8 @@ public:
     bool operator ==(
             const DomainParticipantFactoryQos& b) const
     {
-        return (this->entity_factory_ == b.entity_factory());
+        return (this->entity_factory_ == b.entity_factory()) &&
+               (this->thread_pools_ == b.thread_pools());
     }
 
     /**
@@ -84,10 +86,42 @@ public:
         entity_factory_ = entity_factory;
     }
 
+    /**
+     * Getter for the settings of the threads shared by the participants of the process
+     * @return SharedThreadPoolsSettings reference
+     */
+    const rtps::SharedThreadPoolsSettings& thread_pools() const
+    {
+        return thread_pools_;
+    }
+
+    /**
+     * Getter for the settings of the threads shared by the participants of the process
+     * @return SharedThreadPoolsSettings reference
+     */
+    rtps::SharedThreadPoolsSettings& thread_pools()
+    {
+        return thread_pools_;
+    }
+
+    /**
+     * Setter for the settings of the threads shared by the participants of the process.
+     * They are used by the participants created afterwards.
+     * @param thread_pools SharedThreadPoolsSettings
+     */
+    void thread_pools(
+            const rtps::SharedThreadPoolsSettings& thread_pools)
+    {
+        thread_pools_ = thread_pools;
+    }
+
 private:
 
     //!EntityFactoryQosPolicy, implemented in the library.
     EntityFactoryQosPolicy entity_factory_;
+
+    //!Settings of the threads shared by the participants, implemented in the library.
+    rtps::SharedThreadPoolsSettings thread_pools_;
 };
 
 } /* namespace dds */
@@ -30,6 +30,8 @@
 #include <fastrtps/qos/DeadlineMissedStatus.h>
 #include <fastrtps/types/TypesBase.h>
 
+#include <memory>
+
 using eprosima::fastrtps::types::ReturnCode_t;
 
 namespace eprosima {
@@ -162,6 +164,24 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write data with handle, sharing the sample with the DataReaders on the same process.
+     *
+     * The sample is serialized as usual for the rest of DataReaders. DataReaders on the same process with
+     * the property "fastdds.intraprocess_shared_samples" set to "true" receive this same object, instead of
+     * a deserialized copy, when taking or reading loaned samples while the change is still on the history of this
+     * DataWriter. The sample should not be modified after this call, and those DataReaders should not modify it
+     * either.
+     *
+     * @param data Shared pointer to the data
+     * @param handle InstanceHandle_t, or HANDLE_NIL to deduce it from the data.
+     * @return RETCODE_PRECONDITION_NOT_MET if the handle introduced does not match with the one associated to the data,
+     * RETCODE_OK if the data is correctly sent and RETCODE_ERROR otherwise.
+     */
+    RTPS_DllAPI ReturnCode_t write_shared(
+            const std::shared_ptr<const void>& data,
+            const InstanceHandle_t& handle = HANDLE_NIL);
+
     /** NOT YET IMPLEMENTED
      * @brief This operation performs the same function as write except that it also provides the value for the
      * @ref source_timestamp that is made available to DataReader objects by means of the @ref source_timestamp
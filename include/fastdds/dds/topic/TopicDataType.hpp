@@ -68,6 +68,7 @@ public:
         , m_isGetKeyDefined(false)
         , auto_fill_type_object_(true)
         , auto_fill_type_information_(true)
+        , checks_serialization_bounds_(false)
     {
     }
 
@@ -188,6 +189,27 @@ public:
         auto_fill_type_information_ = auto_fill_type_information;
     }
 
+    /**
+     * Get whether serialize fails, instead of writing past the end, when the payload is smaller than the sample.
+     * @return true if the payload may be reserved before computing the serialized size of the sample
+     */
+    RTPS_DllAPI inline bool checks_serialization_bounds() const
+    {
+        return checks_serialization_bounds_;
+    }
+
+    /**
+     * Set whether serialize fails, instead of writing past the end, when the payload is smaller than the sample.
+     * Writers then reserve the payloads from an estimate, and only compute the serialized size of the samples
+     * that do not fit. Otherwise, payloads are always reserved with the size given by getSerializedSizeProvider.
+     * @param checks_serialization_bounds new value to set
+     */
+    RTPS_DllAPI inline void checks_serialization_bounds(
+            bool checks_serialization_bounds)
+    {
+        checks_serialization_bounds_ = checks_serialization_bounds;
+    }
+
     /**
      * Get the type identifier
      * @return TypeIdV1
@@ -329,6 +351,8 @@ private:
     bool auto_fill_type_object_;
     bool auto_fill_type_information_;
 
+    bool checks_serialization_bounds_;
+
     friend class fastdds::dds::TypeSupport;
 
 };
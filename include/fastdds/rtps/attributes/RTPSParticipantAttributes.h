@@ -324,6 +324,14 @@ public:
     //!Set to true to avoid multicast traffic on builtin endpoints
     bool avoid_builtin_multicast = true;
 
+    /**
+     * Set to true to defer the creation of builtin endpoints not needed for discovery, which speeds up the
+     * creation of the participant. The liveliness endpoints are created when the first local endpoint is
+     * registered, and the TypeLookup client endpoints when the TypeLookup service is first used. These endpoints
+     * are announced from the start, so remote participants match them as usual.
+     */
+    bool lazy_builtin_endpoints = false;
+
     BuiltinAttributes() = default;
 
     virtual ~BuiltinAttributes() = default;
@@ -343,7 +351,8 @@ public:
                (this->writerHistoryMemoryPolicy == b.writerHistoryMemoryPolicy) &&
                (this->writerPayloadSize == b.writerPayloadSize) &&
                (this->mutation_tries == b.mutation_tries) &&
-               (this->avoid_builtin_multicast == b.avoid_builtin_multicast);
+               (this->avoid_builtin_multicast == b.avoid_builtin_multicast) &&
+               (this->lazy_builtin_endpoints == b.lazy_builtin_endpoints);
     }
 
 };
@@ -0,0 +1,138 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadSettings.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+#define _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Settings applied to a thread created by the library.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct ThreadSettings
+{
+    //! Value of scheduling_policy and priority that keeps the value inherited from the creating thread.
+    static constexpr int32_t default_value = std::numeric_limits<int32_t>::min();
+
+    /**
+     * Scheduling policy of the thread (SCHED_OTHER, SCHED_FIFO, SCHED_RR...).
+     * Not used on Windows.
+     */
+    int32_t scheduling_policy = default_value;
+
+    /**
+     * Scheduling priority of the thread.
+     * On Windows, the value given to SetThreadPriority.
+     */
+    int32_t priority = default_value;
+
+    /**
+     * Mask of the CPUs the thread may run on, where bit N allows CPU N.
+     * When 0, the affinity is inherited from the creating thread. Not used on Mac.
+     */
+    uint64_t affinity = 0;
+
+    bool operator ==(
+            const ThreadSettings& b) const
+    {
+        return (scheduling_policy == b.scheduling_policy) &&
+               (priority == b.priority) &&
+               (affinity == b.affinity);
+    }
+
+    bool operator !=(
+            const ThreadSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+};
+
+/**
+ * Settings of a pool of threads shared by all the participants of the process.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct ThreadPoolSettings
+{
+    //! Number of threads of the pool. Each participant is served by one of them.
+    uint32_t num_threads = 1;
+
+    //! Settings applied to every thread of the pool.
+    ThreadSettings thread;
+
+    bool operator ==(
+            const ThreadPoolSettings& b) const
+    {
+        return (num_threads == b.num_threads) &&
+               (thread == b.thread);
+    }
+
+    bool operator !=(
+            const ThreadPoolSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+};
+
+/**
+ * Settings of the threads shared by all the participants of the process.
+ *
+ * By default every participant creates its own threads. When enabled, participants take their timed events
+ * thread and their asynchronous writers thread from pools shared by the whole process. The pools are created by
+ * the first participant using them, with the settings in effect at that moment, and destroyed with the last one.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct SharedThreadPoolsSettings
+{
+    //! Whether participants share the threads of the pools.
+    bool enabled = false;
+
+    //! Threads running the timed events of the participants.
+    ThreadPoolSettings timed_events;
+
+    //! Threads sending the samples of asynchronous writers.
+    ThreadPoolSettings async_writers;
+
+    bool operator ==(
+            const SharedThreadPoolsSettings& b) const
+    {
+        return (enabled == b.enabled) &&
+               (timed_events == b.timed_events) &&
+               (async_writers == b.async_writers);
+    }
+
+    bool operator !=(
+            const SharedThreadPoolsSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
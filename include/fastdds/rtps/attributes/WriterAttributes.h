@@ -55,6 +55,12 @@ struct WriterTimes
     Duration_t nackResponseDelay;
     //!This time allows the RTPSWriter to ignore nack messages too soon after the data as sent, default value 0s.
     Duration_t nackSupressionDuration;
+    /**
+     * Adapt the heartbeat period and the NACK response delay to the unacknowledged data and to the round trip time
+     * measured with the readers, default value false.
+     * When enabled, heartbeatPeriod and nackResponseDelay are the longest period and delay used.
+     */
+    bool adaptive_reliability = false;
 
     WriterTimes()
     {
@@ -75,7 +81,8 @@ struct WriterTimes
         return (this->initialHeartbeatDelay == b.initialHeartbeatDelay) &&
                (this->heartbeatPeriod == b.heartbeatPeriod) &&
                (this->nackResponseDelay == b.nackResponseDelay) &&
-               (this->nackSupressionDuration == b.nackSupressionDuration);
+               (this->nackSupressionDuration == b.nackSupressionDuration) &&
+               (this->adaptive_reliability == b.adaptive_reliability);
     }
 
 };
@@ -114,6 +114,12 @@ public:
     //! Known discovery and backup server container
     std::list<eprosima::fastdds::rtps::RemoteServerAttributes> m_DiscoveryServers;
 
+    /**
+     * Get the TypeLookupManager, creating it first when its creation was deferred.
+     * @return Pointer to the TypeLookupManager, or nullptr if the TypeLookup service is not used.
+     */
+    fastdds::dds::builtin::TypeLookupManager* typelookup_manager();
+
     /**
      * Add a local Writer to the BuiltinProtocols.
      * @param w Pointer to the RTPSWriter
@@ -26,6 +26,8 @@
 #include <fastrtps/utils/IPLocator.h>
 
 #include <algorithm>
+#include <array>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -43,12 +45,18 @@ namespace rtps {
  *       - A call to enable is performed per desired destination
  *       - If state_has_changed() returns true:
  *         - the message group is flushed
- *         - selection_start is called
- *         - for each transport:
- *           - transport_starts is called
- *           - transport handles the selection state of each entry
- *           - select may be called
+ *         - if restore_selection() returns false:
+ *           - selection_start is called
+ *           - for each transport:
+ *             - transport_starts is called
+ *             - transport handles the selection state of each entry
+ *             - select may be called
+ *           - store_selection is called
  *       - Submessage is added to the message group
+ *
+ * The last selections are cached, keyed by the set of enabled entries, so sending again to the same set of
+ * destinations does not run the transports' selection. The cache is invalidated when entries are added or removed,
+ * and should be invalidated with clear_selection_cache when the locators of an entry change.
  */
 class LocatorSelector
 {
@@ -75,6 +83,7 @@ public:
         entries_.clear();
         selections_.clear();
         last_state_.clear();
+        clear_selection_cache();
     }
 
     /**
@@ -85,6 +94,7 @@ public:
     bool add_entry(
             LocatorSelectorEntry* entry)
     {
+        clear_selection_cache();
         return entries_.push_back(entry) != nullptr;
     }
 
@@ -95,6 +105,7 @@ public:
     bool remove_entry(
             const GUID_t& guid)
     {
+        clear_selection_cache();
         return entries_.remove_if(
             [&guid](LocatorSelectorEntry* entry)
             {
@@ -171,6 +182,87 @@ public:
         }
     }
 
+    /**
+     * Restore the selection previously stored for the current enabling state of the entries.
+     *
+     * @return true if a selection was found and restored, false if the selection algorithm should be run.
+     */
+    bool restore_selection()
+    {
+        for (CachedSelection& cached : selection_cache_)
+        {
+            if (cached.valid && cached_selection_matches(cached))
+            {
+                cached.last_used = ++selection_cache_uses_;
+                selections_.clear();
+                for (size_t index : cached.selections)
+                {
+                    selections_.push_back(index);
+                }
+
+                // States are stored as the number of multicast indexes, the indexes, the number of unicast indexes
+                // and the indexes, for each entry.
+                auto state_it = cached.states.begin();
+                for (LocatorSelectorEntry* entry : entries_)
+                {
+                    entry->reset();
+                    for (size_t n = *state_it++; n > 0; --n)
+                    {
+                        entry->state.multicast.push_back(*state_it++);
+                    }
+                    for (size_t n = *state_it++; n > 0; --n)
+                    {
+                        entry->state.unicast.push_back(*state_it++);
+                    }
+                }
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Store the result of the selection algorithm for the current enabling state of the entries.
+     * The least recently used selection is replaced when the cache is full.
+     */
+    void store_selection()
+    {
+        CachedSelection& cached = *std::min_element(selection_cache_.begin(), selection_cache_.end(),
+                        [](const CachedSelection& a, const CachedSelection& b)
+                        {
+                            return a.last_used < b.last_used;
+                        });
+        cached.last_used = ++selection_cache_uses_;
+
+        cached.enabled.clear();
+        cached.states.clear();
+        for (LocatorSelectorEntry* entry : entries_)
+        {
+            cached.enabled.push_back(entry->enabled);
+            cached.states.push_back(entry->state.multicast.size());
+            cached.states.insert(cached.states.end(), entry->state.multicast.begin(), entry->state.multicast.end());
+            cached.states.push_back(entry->state.unicast.size());
+            cached.states.insert(cached.states.end(), entry->state.unicast.begin(), entry->state.unicast.end());
+        }
+        cached.selections.assign(selections_.begin(), selections_.end());
+        cached.valid = true;
+    }
+
+    /**
+     * Invalidate all the stored selections.
+     * Should be called when the locators of an entry change.
+     */
+    void clear_selection_cache()
+    {
+        for (CachedSelection& cached : selection_cache_)
+        {
+            cached.valid = false;
+            cached.last_used = 0;
+        }
+    }
+
     /**
      * Called when the selection algorithm starts for a specific transport.
      *
@@ -463,12 +555,50 @@ public:
 
 private:
 
+    //! Result of the selection algorithm for a given enabling state of the entries.
+    struct CachedSelection
+    {
+        //! Whether this selection can be restored.
+        bool valid = false;
+        //! Value of the uses counter the last time this selection was stored or restored.
+        uint64_t last_used = 0;
+        //! Enabling state of each entry.
+        std::vector<bool> enabled;
+        //! Selected indexes.
+        std::vector<size_t> selections;
+        //! Selection state of each entry.
+        std::vector<size_t> states;
+    };
+
+    bool cached_selection_matches(
+            const CachedSelection& cached) const
+    {
+        if (cached.enabled.size() != entries_.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < entries_.size(); ++i)
+        {
+            if (cached.enabled[i] != entries_.at(i)->enabled)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     //! Entries collection.
     ResourceLimitedVector<LocatorSelectorEntry*> entries_;
     //! List of selected indexes.
     ResourceLimitedVector<size_t> selections_;
     //! Enabling state when reset was called.
     ResourceLimitedVector<int> last_state_;
+    //! Last selections, keyed by the enabling state of the entries.
+    std::array<CachedSelection, 4> selection_cache_;
+    //! Number of times a selection has been stored or restored.
+    uint64_t selection_cache_uses_ = 0;
 };
 
 } /* namespace rtps */
@@ -0,0 +1,59 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file NetworkBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+#define _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_
+
+#include <cstdint>
+
+#include <fastdds/rtps/common/Types.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * A slice of a message to be sent, which is not owned by this object.
+ * A message can be sent as a sequence of buffers that are gathered by the transport, so big payloads do not need
+ * to be copied next to the submessage headers.
+ */
+struct NetworkBuffer
+{
+    //! Pointer to the first byte of the slice.
+    const fastrtps::rtps::octet* buffer = nullptr;
+
+    //! Number of bytes of the slice.
+    uint32_t size = 0;
+
+    NetworkBuffer() = default;
+
+    NetworkBuffer(
+            const fastrtps::rtps::octet* ptr,
+            uint32_t s)
+        : buffer(ptr)
+        , size(s)
+    {
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_RTPS_COMMON_NETWORKBUFFER_HPP_ */
@@ -73,6 +73,8 @@ private:
 
     std::mutex mtx_;
     std::vector<RTPSWriter*> associated_writers_;
+    //! Writers processing the acknacks of the current message as a batch
+    std::vector<RTPSWriter*> acknack_batch_writers_;
     std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
 
     RTPSParticipantImpl* participant_;
@@ -113,6 +115,9 @@ private:
     //!Reset the MessageReceiver to process a new message.
     void reset();
 
+    //!End the batches of acknacks started by the writers while processing the current message.
+    void end_acknack_batches();
+
     /**
      * Check the RTPSHeader of a received message.
      * @param msg Pointer to the message.
@@ -112,6 +112,9 @@ public:
      * @param[out] msg Pointer to where the message is going to be created and stored.
      * @param[in] guidPrefix Guid Prefix of the RTPSParticipant.
      * @param[in] param Different parameters depending on the message.
+     * @param[in] copy_data Only for DATA and DATA_FRAG. When false, the serialized payload is not copied into the
+     * message, although the submessage length accounts for it and its alignment, which the caller should send right
+     * after the submessage.
      * @return True if correct.
      */
 
@@ -133,7 +136,8 @@ public:
             const EntityId_t& readerId,
             bool expectsInlineQos,
             InlineQosWriter* inlineQos,
-            bool* is_big_submessage);
+            bool* is_big_submessage,
+            bool copy_data = true);
 
     static bool addMessageDataFrag(
             CDRMessage_t* msg,
@@ -152,7 +156,8 @@ public:
             TopicKind_t topicKind,
             const EntityId_t& readerId,
             bool expectsInlineQos,
-            InlineQosWriter* inlineQos);
+            InlineQosWriter* inlineQos,
+            bool copy_data = true);
 
     static bool addMessageGap(
             CDRMessage_t* msg,
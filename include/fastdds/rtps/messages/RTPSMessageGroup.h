@@ -168,7 +168,7 @@ public:
 
     inline uint32_t get_current_bytes_processed() const
     { 
-        return currentBytesSent_ + full_msg_->length; 
+        return currentBytesSent_ + full_msg_->length + referenced_payload_bytes_; 
     }
 
     /**
@@ -191,6 +191,11 @@ private:
 
     static constexpr uint32_t data_frag_header_size_ = 28;
     static constexpr uint32_t max_inline_qos_size_ = 32;
+    //! Smaller payloads are copied into the message, as gathering them costs more than copying them.
+    static constexpr uint32_t min_referenced_payload_size_ = 1024;
+    //! Each referenced payload adds two buffers to the message, which keeps it within the 64 buffers transports
+    //! can gather in a single send.
+    static constexpr size_t max_referenced_payloads_ = 31;
 
     void reset_to_header();
 
@@ -216,6 +221,17 @@ private:
             const GuidPrefix_t& destination_guid_prefix,
             bool is_big_submessage);
 
+    bool append_submessage();
+
+    /**
+     * Check if a payload can be sent from where it is, instead of being copied into the message.
+     * This is not possible when the payload or the message have to be encrypted.
+     * @param payload_size Size of the payload.
+     * @return true when the payload can be referenced.
+     */
+    bool can_reference_payload(
+            uint32_t payload_size) const;
+
     bool add_info_dst_in_buffer(
             CDRMessage_t* buffer,
             const GuidPrefix_t& destination_guid_prefix);
@@ -251,6 +267,12 @@ private:
     std::chrono::steady_clock::time_point max_blocking_time_point_;
 
     std::unique_ptr<RTPSMessageGroup_t> send_buffer_;
+
+    //! Payload of the submessage being added, when it is not copied into submessage_msg_.
+    eprosima::fastdds::rtps::NetworkBuffer pending_payload_;
+
+    //! Bytes of the current message sent from the payloads, which are not on full_msg_.
+    uint32_t referenced_payload_bytes_;
 };
 
 } /* namespace rtps */
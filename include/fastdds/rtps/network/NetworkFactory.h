@@ -109,8 +109,10 @@ public:
      * Performs the locator selection algorithm.
      *
      * It basically consists of the following steps
+     *   - if selector.restore_selection returns true, nothing else is done
      *   - selector.selection_start is called
      *   - the transport selection algorithm is called for each registered transport
+     *   - selector.store_selection is called
      *
      * @param [in, out] selector Locator selector.
      */
@@ -19,6 +19,8 @@
 #include <vector>
 #include <chrono>
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+
 namespace eprosima{
 namespace fastrtps{
 namespace rtps{
@@ -65,6 +67,47 @@ public:
         return returned_value;
     }
 
+    /**
+     * Sends to a destination locator a message made of several buffers, through the channel managed by this
+     * resource. Transports able to gather the buffers send them without joining them first. For the rest, the
+     * buffers are copied into a single one and sent as usual.
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of all the buffers.
+     * @param destination_locators_begin destination endpoint Locators iterator begin.
+     * @param destination_locators_end destination endpoint Locators iterator end.
+     * @param max_blocking_time_point If transport supports it then it will use it as maximum blocking time.
+     * @return Success of the send operation.
+     */
+    bool send(
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        LocatorsIterator* destination_locators_begin,
+        LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+    {
+        if (send_buffers_lambda_)
+        {
+            return send_buffers_lambda_(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                    max_blocking_time_point);
+        }
+
+        if (buffers.size() == 1)
+        {
+            return send(buffers[0].buffer, buffers[0].size, destination_locators_begin, destination_locators_end,
+                    max_blocking_time_point);
+        }
+
+        gather_buffer_.clear();
+        gather_buffer_.reserve(total_bytes);
+        for (const eprosima::fastdds::rtps::NetworkBuffer& buffer : buffers)
+        {
+            gather_buffer_.insert(gather_buffer_.end(), buffer.buffer, buffer.buffer + buffer.size);
+        }
+
+        return send(gather_buffer_.data(), total_bytes, destination_locators_begin, destination_locators_end,
+                max_blocking_time_point);
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -73,6 +116,8 @@ public:
     {
         clean_up.swap(rValueResource.clean_up);
         send_lambda_.swap(rValueResource.send_lambda_);
+        send_buffers_lambda_.swap(rValueResource.send_buffers_lambda_);
+        gather_buffer_.swap(rValueResource.gather_buffer_);
     }
 
     virtual ~SenderResource() = default;
@@ -93,11 +138,21 @@ protected:
             LocatorsIterator* destination_locators_end,
             const std::chrono::steady_clock::time_point&)> send_lambda_;
 
+    //! Optional. Transports without it receive the buffers joined on gather_buffer_.
+    std::function<bool(
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>&,
+            uint32_t,
+            LocatorsIterator* destination_locators_begin,
+            LocatorsIterator* destination_locators_end,
+            const std::chrono::steady_clock::time_point&)> send_buffers_lambda_;
+
 private:
 
     SenderResource()                                 = delete;
     SenderResource(const SenderResource&)            = delete;
     SenderResource& operator=(const SenderResource&) = delete;
+
+    std::vector<octet> gather_buffer_;
 };
 
 } // namespace rtps
@@ -262,13 +262,15 @@ public:
 
     /**
      * Use the participant of this reader to send a message to certain locator.
-     * @param message Message to be sent.
+     * @param buffers Slices of the message to be sent, in order.
+     * @param total_bytes Sum of the sizes of all the buffers.
      * @param locators_begin Destination locators iterator begin.
      * @param locators_end Destination locators iterator end.
      * @param max_blocking_time_point Future time point where any blocking should end.
      */
     bool send_sync_nts(
-            CDRMessage_t* message,
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             const Locators& locators_begin,
             const Locators& locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point);
@@ -22,7 +22,9 @@
 #include <thread>
 #include <atomic>
 #include <list>
+#include <string>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/resources/AsyncInterestTree.h>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
@@ -45,6 +47,19 @@ public:
 
     AsyncWriterThread() = default;
 
+    /*!
+     * @brief Construct an object whose thread is created with the given settings.
+     * @param settings Scheduling and affinity settings of the thread.
+     * @param name Name given to the thread.
+     */
+    AsyncWriterThread(
+            const fastdds::rtps::ThreadSettings& settings,
+            const std::string& name)
+        : thread_settings_(settings)
+        , thread_name_(name)
+    {
+    }
+
     ~AsyncWriterThread();
 
     /*!
@@ -90,6 +105,11 @@ private:
     bool running_ = false;
     bool run_scheduled_ = false;
     TimedConditionVariable cv_;
+
+    //! Settings applied to the thread each time it is created.
+    fastdds::rtps::ThreadSettings thread_settings_;
+    //! Name given to the thread each time it is created. Empty to keep the default name.
+    std::string thread_name_;
 };
 
 } // namespace rtps
@@ -22,11 +22,13 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
 #include <thread>
 #include <atomic>
+#include <string>
 #include <vector>
 
 namespace eprosima {
@@ -52,6 +54,15 @@ public:
      */
     void init_thread();
 
+    /*!
+     * @brief Method to initialize the internal thread with the given settings.
+     * @param settings Scheduling and affinity settings of the thread.
+     * @param name Name given to the thread.
+     */
+    void init_thread(
+            const fastdds::rtps::ThreadSettings& settings,
+            const std::string& name);
+
     /*!
      * @brief This method informs that a TimedEventImpl has been created.
      *
@@ -68,6 +79,7 @@ public:
      * This method has to be called before deleting the TimedEventImpl object.
      * This method cancels any operation of the timer.
      * Then it avoids the situation of the execution thread calling the event handler when it was previously removed.
+     * It may be called from the callback of another timer, but a callback must not delete its own timer.
      * @param event TimedEventImpl object that will be deleted and we have to be sure all its operations are cancelled.
      */
     void unregister_timer(
@@ -138,6 +150,11 @@ private:
     //! Method called by the internal thread.
     void event_service();
 
+    //! Method called by the internal thread when it has settings to apply.
+    void configured_event_service(
+            const fastdds::rtps::ThreadSettings& settings,
+            const std::string& name);
+
     //! Sorts waiting timers in ascending order of trigger time.
     void sort_timers();
 
@@ -20,9 +20,12 @@
 #include <fastdds/rtps/transport/ChannelResource.h>
 #include <fastdds/rtps/transport/tcp/RTCPMessageManager.h>
 #include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 
 #include <asio.hpp>
 
+#include <functional>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -130,6 +133,30 @@ public:
             size_t size,
             asio::error_code& ec) = 0;
 
+    /**
+     * Send a header followed by a message made of several buffers, writing all of them to the socket without
+     * joining them.
+     */
+    virtual size_t send(
+            const fastrtps::rtps::octet* header,
+            size_t header_size,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            asio::error_code& ec) = 0;
+
+    /**
+     * Start reading some bytes without blocking. The handler is called from the transport I/O threads when the
+     * read completes, and the next read should not be started before that.
+     * @return false when the channel does not support asynchronous reads.
+     */
+    virtual bool async_read_some(
+            fastrtps::rtps::octet*,
+            std::size_t,
+            const std::function<void(const asio::error_code&, std::size_t)>&)
+    {
+        return false;
+    }
+
     virtual asio::ip::tcp::endpoint remote_endpoint() const = 0;
 
     virtual asio::ip::tcp::endpoint local_endpoint() const = 0;
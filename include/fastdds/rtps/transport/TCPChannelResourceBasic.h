@@ -24,8 +24,24 @@ namespace rtps{
 
 class TCPChannelResourceBasic : public TCPChannelResource
 {
+    //! Messages waiting to be written when sends are asynchronous
+    struct SendQueue
+    {
+        std::mutex mutex;
+        //! Messages sent while a write is in progress, which are written together on the next one
+        std::vector<fastrtps::rtps::octet> pending;
+        //! Messages being written, only accessed from the strand
+        std::vector<fastrtps::rtps::octet> writing;
+        bool write_in_progress = false;
+    };
+
     asio::io_service& service_;
     std::shared_ptr<asio::ip::tcp::socket> socket_;
+    //! Serializes the operations started on the socket when the transport serves channels asynchronously
+    asio::io_service::strand strand_;
+    //! Only created when the transport serves channels asynchronously
+    std::shared_ptr<SendQueue> send_queue_;
+    size_t max_pending_send_bytes_;
 public:
     // Constructor called when trying to connect to a remote server
     TCPChannelResourceBasic(
@@ -60,6 +76,18 @@ public:
         size_t size,
         asio::error_code& ec) override;
 
+    size_t send(
+        const fastrtps::rtps::octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        asio::error_code& ec) override;
+
+    bool async_read_some(
+        fastrtps::rtps::octet* buffer,
+        std::size_t size,
+        const std::function<void(const asio::error_code&, std::size_t)>& handler) override;
+
     asio::ip::tcp::endpoint remote_endpoint() const override;
     asio::ip::tcp::endpoint local_endpoint() const override;
 
@@ -75,6 +103,19 @@ public:
     }
 
 private:
+
+    size_t enqueue(
+        const fastrtps::rtps::octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        asio::error_code& ec);
+
+    static void write_pending(
+        std::shared_ptr<SendQueue> queue,
+        std::shared_ptr<asio::ip::tcp::socket> socket,
+        asio::io_service::strand strand);
+
     TCPChannelResourceBasic(const TCPChannelResourceBasic&) = delete;
     TCPChannelResourceBasic& operator=(const TCPChannelResourceBasic&) = delete;
 };
@@ -62,6 +62,13 @@ class TCPChannelResourceSecure : public TCPChannelResource
                 size_t size,
                 asio::error_code& ec) override;
 
+        size_t send(
+                const fastrtps::rtps::octet* header,
+                size_t header_size,
+                const std::vector<NetworkBuffer>& buffers,
+                uint32_t total_bytes,
+                asio::error_code& ec) override;
+
         asio::ip::tcp::endpoint remote_endpoint() const override;
         asio::ip::tcp::endpoint local_endpoint() const override;
 
@@ -164,6 +164,9 @@ typedef struct TCPTransportDescriptor : public SocketTransportDescriptor
     bool calculate_crc;
     bool check_crc;
     bool apply_security;
+    //! Number of threads serving the events of all the non-secure channels with asynchronous reads and queued
+    //! writes. When 0, each channel is served by its own thread with blocking operations.
+    uint16_t async_io_threads;
 
     TLSConfig tls_config;
 
@@ -15,6 +15,7 @@
 #ifndef _FASTDDS_TCP_TRANSPORT_INTERFACE_H_
 #define _FASTDDS_TCP_TRANSPORT_INTERFACE_H_
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/TCPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
@@ -40,6 +41,7 @@ namespace rtps{
 
 class RTCPMessageManager;
 class TCPChannelResource;
+class TCPReceiveBuffer;
 
 /**
  * This is a default TCP Interface implementation.
@@ -70,13 +72,19 @@ class TCPTransportInterface : public TransportInterface
 
 protected:
 
-    std::vector<fastrtps::rtps::IPFinder::info_IP> current_interfaces_;
+    //! Addresses of the local interfaces, updated by update_current_interfaces.
+    mutable std::vector<fastrtps::rtps::IPFinder::info_IP> current_interfaces_;
+    //! Version of the interfaces of the host from which current_interfaces_ was obtained.
+    mutable uint32_t current_interfaces_version_ = 0;
+    //! Protects current_interfaces_ and current_interfaces_version_.
+    mutable std::mutex current_interfaces_mutex_;
     asio::io_service io_service_;
     asio::io_service io_service_timers_;
 #if TLS_FOUND
     asio::ssl::context ssl_context_;
 #endif
-    std::shared_ptr<std::thread> io_service_thread_;
+    //! Threads running io_service_. There are async_io_threads of them when channels are served asynchronously.
+    std::vector<std::thread> io_service_threads_;
     std::shared_ptr<std::thread> io_service_timers_thread_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
@@ -115,13 +123,12 @@ protected:
 
     void calculate_crc(
         TCPHeader &header,
-        const fastrtps::rtps::octet *data,
-        uint32_t size) const;
+        const std::vector<NetworkBuffer>& buffers) const;
 
     void fill_rtcp_header(
         TCPHeader& header,
-        const fastrtps::rtps::octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         uint16_t logical_port) const;
 
     //! Closes the given p_channel_resource and unbind it from every resource.
@@ -134,13 +141,62 @@ protected:
         std::vector<fastrtps::rtps::IPFinder::info_IP>& loc_names,
         bool return_loopback = false) const = 0;
 
+    /**
+     * Obtain current_interfaces_ again when the interfaces of the host have changed since it was last obtained.
+     * Requires current_interfaces_mutex_.
+     */
+    void update_current_interfaces() const;
+
     bool is_input_port_open(uint16_t port) const;
 
+    //! Starts receiving from a new channel, on a thread of its own or asynchronously depending on the configuration.
+    void start_listen_operation(
+            std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Sends the connection request of an outgoing channel, or waits for the bind of an incoming one.
+    bool begin_listen_operation(
+            std::weak_ptr<TCPChannelResource>& channel_weak,
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel);
+
     //! Functions to be called from new threads, which takes cares of performing a blocking receive
     void perform_listen_operation(
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    //! Starts the next asynchronous read of a channel served from the I/O threads.
+    void async_receive(
+            std::weak_ptr<TCPChannelResource> channel_weak,
+            std::weak_ptr<RTCPMessageManager> rtcp_manager,
+            std::shared_ptr<TCPReceiveBuffer> buffer);
+
+    //! Processes all the complete frames received on an asynchronous read, and starts the next one.
+    void on_async_receive(
+            std::weak_ptr<TCPChannelResource> channel_weak,
+            std::weak_ptr<RTCPMessageManager> rtcp_manager,
+            std::shared_ptr<TCPReceiveBuffer> buffer,
+            const asio::error_code& ec,
+            std::size_t bytes_received);
+
+    /**
+     * Processes a frame received on a channel. RTCP control messages are processed here.
+     * @return true when the frame is an RTPS message to be delivered to a receiver.
+     */
+    bool process_received_frame(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            fastrtps::rtps::octet* body,
+            uint32_t body_size,
+            fastrtps::rtps::Locator_t& remote_locator);
+
+    //! Delivers a received RTPS message to the receiver of its logical port.
+    void deliver_received_message(
+            std::shared_ptr<TCPChannelResource>& channel,
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            const fastrtps::rtps::Locator_t& remote_locator);
+
     bool read_body(
         fastrtps::rtps::octet* receive_buffer,
         uint32_t receive_buffer_capacity,
@@ -173,11 +229,11 @@ protected:
     std::string get_password() const;
 
     /**
-     * Send a buffer to a destination
+     * Send a message made of several buffers to a destination
      */
     bool send(
-            const fastrtps::rtps::octet* send_buffer,
-            uint32_t send_buffer_size,
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             std::shared_ptr<TCPChannelResource>& channel,
             const fastrtps::rtps::Locator_t& remote_locator);
 
@@ -313,6 +369,25 @@ public:
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end);
 
+    /**
+    * Blocking Send through the specified channel of a message made of several buffers, which are written to the
+    * socket without joining them.
+    * @param buffers Slices of the message, in order.
+    * @param total_bytes Sum of the sizes of all the buffers.
+    * It must not exceed the send_buffer_size fed to this class during construction.
+    * @param channel channel we're sending from.
+    * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+    * so should not be reuse.
+    * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+    * so should not be reuse.
+    */
+    bool send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::shared_ptr<TCPChannelResource>& channel,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
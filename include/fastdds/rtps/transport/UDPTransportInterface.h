@@ -18,6 +18,7 @@
 #include <asio.hpp>
 #include <thread>
 
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
 #include <fastdds/rtps/transport/TransportInterface.h>
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
@@ -116,6 +117,28 @@ public:
             bool only_multicast_purpose,
             const std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Blocking Send of a message made of several buffers, which are gathered by the socket into a single datagram.
+     * @param buffers Slices of the message, in order.
+     * @param total_bytes Sum of the sizes of all the buffers.
+     * It must not exceed the send_buffer_size fed to this class during construction.
+     * @param socket channel we're sending from.
+     * @param destination_locators_begin pointer to destination locators iterator begin, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param destination_locators_end pointer to destination locators iterator end, the iterator can be advanced inside this fuction
+     * so should not be reuse.
+     * @param only_multicast_purpose
+     * @param max_blocking_time_point maximum blocking time.
+     */
+    virtual bool send(
+            const std::vector<NetworkBuffer>& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+            fastrtps::rtps::LocatorsIterator* destination_locators_end,
+            bool only_multicast_purpose,
+            const std::chrono::steady_clock::time_point& max_blocking_time_point);
+
     /**
      * Performs the locator selection algorithm for this transport.
      *
@@ -124,8 +147,9 @@ public:
      *   - transport handles the selection state of each locator
      *   - if a locator from an entry is selected, selector.select is called for that entry
      *
-     * In the case of UDP, multicast locators are selected when present in more than one entry,
-     * otherwise unicast locators are selected.
+     * In the case of UDP, a multicast locator is selected when it is present in more than one of the entries to
+     * process, and they are at least half of the entries having it, so a single datagram is sent instead of one per
+     * entry without flooding the entries not interested in the message. Otherwise unicast locators are selected.
      *
      * @param [in, out] selector Locator selector.
      */
@@ -161,7 +185,12 @@ protected:
 
     // For UDPv6, the notion of channel corresponds to a port + direction tuple.
     asio::io_service io_service_;
-    std::vector<fastrtps::rtps::IPFinder::info_IP> currentInterfaces;
+    //! Addresses of the local interfaces, updated by update_current_interfaces.
+    mutable std::vector<fastrtps::rtps::IPFinder::info_IP> currentInterfaces;
+    //! Version of the interfaces of the host from which currentInterfaces was obtained.
+    mutable uint32_t current_interfaces_version_ = 0;
+    //! Protects currentInterfaces and current_interfaces_version_.
+    mutable std::mutex current_interfaces_mutex_;
 
     mutable std::recursive_mutex mInputMapMutex;
     std::map<uint16_t, std::vector<UDPChannelResource*>> mInputSockets;
@@ -201,9 +230,15 @@ protected:
     virtual asio::ip::udp generate_protocol() const = 0;
     virtual void get_ips(
             std::vector<fastrtps::rtps::IPFinder::info_IP>& locNames,
-            bool return_loopback = false) = 0;
+            bool return_loopback = false) const = 0;
     virtual const std::string& localhost_name() = 0;
 
+    /**
+     * Obtain currentInterfaces again when the interfaces of the host have changed since it was last obtained.
+     * Requires current_interfaces_mutex_.
+     */
+    void update_current_interfaces() const;
+
     //! Checks if the interfaces white list is empty.
     virtual bool is_interface_whitelist_empty() const = 0;
 
@@ -254,6 +289,18 @@ protected:
             const fastrtps::rtps::Locator_t& remote_locator,
             bool only_multicast_purpose,
             const std::chrono::microseconds& timeout);
+
+private:
+
+    //! Sends a sequence of asio buffers as a single datagram.
+    template<typename ConstBufferSequence>
+    bool send_to(
+            const ConstBufferSequence& buffers,
+            uint32_t total_bytes,
+            eProsimaUDPSocket& socket,
+            const fastrtps::rtps::Locator_t& remote_locator,
+            bool only_multicast_purpose,
+            const std::chrono::microseconds& timeout);
 };
 
 } // namespace rtps
@@ -120,7 +120,7 @@ protected:
     virtual asio::ip::udp generate_protocol() const override;
     virtual void get_ips(
             std::vector<fastrtps::rtps::IPFinder::info_IP>& locNames,
-            bool return_loopback = false) override;
+            bool return_loopback = false) const override;
     virtual const std::string& localhost_name() override;
     eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
@@ -109,6 +109,16 @@ public:
      */
     bool assert_liveliness(LivelinessQosPolicyKind kind);
 
+    /**
+     * @brief Asserts liveliness of the writers of a participant with given liveliness kind
+     * @param kind Liveliness kind
+     * @param guid_prefix Prefix of the participant owning the writers
+     * @return True if liveliness was successfully asserted
+     */
+    bool assert_liveliness(
+            LivelinessQosPolicyKind kind,
+            const GuidPrefix_t& guid_prefix);
+
     /**
      * @brief A method to check any writer of the given kind is alive
      * @param kind The liveliness kind to check for
@@ -328,6 +328,23 @@ public:
         return writer_guid == m_guid;
     }
 
+    /**
+     * Start processing the ACKNACK submessages of a received message on the calling thread.
+     * Until end_acknack_batch is called on the same thread, the writer may defer the work common to the ACKNACK
+     * submessages processed by this thread.
+     */
+    virtual void begin_acknack_batch()
+    {
+    }
+
+    /**
+     * End processing the ACKNACK submessages of a received message, performing the work deferred since
+     * begin_acknack_batch was called.
+     */
+    virtual void end_acknack_batch()
+    {
+    }
+
     /**
      * Process an incoming NACKFRAG submessage.
      * @param[in] writer_guid      GUID of the writer the submessage is directed to.
@@ -407,11 +424,13 @@ public:
     /**
      * Send a message through this interface.
      *
-     * @param message Pointer to the buffer with the message already serialized.
+     * @param buffers Slices of the message already serialized, in order.
+     * @param total_bytes Sum of the sizes of all the buffers.
      * @param max_blocking_time_point Future timepoint where blocking send should end.
      */
     bool send(
-            CDRMessage_t* message,
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const override;
 
     /**
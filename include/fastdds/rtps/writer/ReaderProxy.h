@@ -337,6 +337,26 @@ public:
         return false;
     }
 
+    /**
+     * Called when a heartbeat requiring an answer is sent, to identify the ACKNACK answering it.
+     */
+    void heartbeat_sent()
+    {
+        acknack_count_at_heartbeat_ = last_acknack_count_;
+    }
+
+    /**
+     * Check whether an ACKNACK answers the last heartbeat requiring an answer, being the next one sent by the
+     * reader after that heartbeat.
+     * @param acknack_count The count of the received ACKNACK.
+     * @return true if the ACKNACK answers the heartbeat.
+     */
+    bool answers_heartbeat(
+            uint32_t acknack_count) const
+    {
+        return acknack_count == acknack_count_at_heartbeat_ + 1;
+    }
+
     /**
      * Process an incoming NACKFRAG submessage.
      * @param reader_guid Destination guid of the submessage.
@@ -452,6 +472,8 @@ private:
     std::atomic_bool timers_enabled_;
     //! Last ack/nack count
     uint32_t last_acknack_count_;
+    //! Last ack/nack count when the last heartbeat requiring an answer was sent
+    uint32_t acknack_count_at_heartbeat_;
     //! Last  NACKFRAG count.
     uint32_t last_nackfrag_count_;
 
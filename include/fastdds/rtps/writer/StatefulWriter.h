@@ -26,8 +26,11 @@
 #include <fastdds/rtps/history/IChangePool.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -119,6 +122,22 @@ private:
     //!To avoid notifying twice of the same sequence number
     SequenceNumber_t next_all_acked_notify_sequence_;
     SequenceNumber_t min_readers_low_mark_;
+    //! Number of matched readers whose low mark is min_readers_low_mark_, or 0 when it must be recomputed
+    uint32_t readers_at_min_low_mark_ = 0;
+
+    //! Work deferred until the end of a batch of acknacks processed by a thread
+    struct AcknackBatch
+    {
+        //! Thread processing the batch
+        std::thread::id thread;
+        //! Whether the acknowledgement status must be checked at the end of the batch
+        bool acked_status_pending = false;
+        //! Whether readers acknowledged changes during the batch
+        bool acked_changes_pending = false;
+    };
+
+    //! Batches of acknacks being processed, at most one per thread
+    std::vector<AcknackBatch> acknack_batches_;
 
     // TODO Join this mutex when main mutex would not be recursive.
     std::mutex all_acked_mutex_;
@@ -350,6 +369,10 @@ public:
             bool final_flag,
             bool& result) override;
 
+    void begin_acknack_batch() override;
+
+    void end_acknack_batch() override;
+
     /**
      * Process an incoming NACKFRAG submessage.
      * @param[in] writer_guid      GUID of the writer the submessage is directed to.
@@ -409,6 +432,17 @@ private:
 
     void check_acked_status();
 
+    /**
+     * Update the acknowledgement status after a reader acknowledged changes. All the readers are only walked when
+     * the lowest sequence number acknowledged by all of them may have changed, and not until the end of the batch
+     * of acknacks being processed.
+     * @param reader Reader that acknowledged changes.
+     * @param previous_low_mark Low mark of the reader before processing the acknack.
+     */
+    void reader_acked_changes_nts(
+            const ReaderProxy& reader,
+            const SequenceNumber_t& previous_low_mark);
+
     /**
      * @brief A method called when the ack timer expires
      * @details Only used if disable positive ACKs QoS is enabled
@@ -417,6 +451,27 @@ private:
 
     void send_heartbeat_to_all_readers();
 
+    /**
+     * Tune the heartbeat period and the NACK response delay to the unacknowledged data and to the measured round
+     * trip time. Only used with adaptive reliability.
+     */
+    void adapt_reliability_times_nts();
+
+    /**
+     * Update the round trip time with an acknack answering the last heartbeat requiring an answer.
+     * @param reader Reader that sent the acknack.
+     * @param ack_count Count of the acknack.
+     */
+    void heartbeat_answered_nts(
+            const ReaderProxy& reader,
+            uint32_t ack_count);
+
+    //! Fraction of the history capacity not acknowledged by all the readers, between 0 and 1.
+    double unacknowledged_ratio() const;
+
+    //! Bytes to send before piggybacking a heartbeat.
+    int32_t heartbeat_piggyback_budget() const;
+
     void send_changes_separatedly(
             SequenceNumber_t max_sequence,
             bool& activateHeartbeatPeriod);
@@ -468,6 +523,17 @@ private:
 
     int32_t currentUsageSendBufferSize_;
 
+    //! Smoothed time between sending a heartbeat and receiving the acknacks answering it, in milliseconds
+    double smoothed_rtt_ms_ = 0;
+    //! Time the oldest heartbeat requiring an answer not yet received was sent
+    std::chrono::steady_clock::time_point last_heartbeat_time_;
+    //! Whether a heartbeat requiring an answer is waiting for it
+    bool heartbeat_answer_pending_ = false;
+    //! Number of consecutive periodic heartbeats that did not make the readers acknowledge more changes
+    uint32_t heartbeat_backoff_ = 0;
+    //! Lowest sequence number acknowledged by all readers when the last periodic heartbeat was sent
+    SequenceNumber_t low_mark_at_last_heartbeat_;
+
     std::vector<std::unique_ptr<FlowController>> m_controllers;
 
     bool there_are_remote_readers_ = false;
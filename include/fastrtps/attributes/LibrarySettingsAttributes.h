@@ -20,6 +20,8 @@
 #ifndef LIBRARYSETTINGS_ATTRIBUTES_H_
 #define LIBRARYSETTINGS_ATTRIBUTES_H_
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 namespace eprosima {
 namespace fastrtps {
 
@@ -47,10 +49,14 @@ public:
     bool operator==(
             const LibrarySettingsAttributes& b) const
     {
-        return (intraprocess_delivery == b.intraprocess_delivery);
+        return (intraprocess_delivery == b.intraprocess_delivery) &&
+               (thread_pools == b.thread_pools);
     }
 
     IntraprocessDeliveryType intraprocess_delivery = INTRAPROCESS_FULL;
+
+    //! Threads shared by the participants of the process.
+    fastdds::rtps::SharedThreadPoolsSettings thread_pools;
 };
 
 }  // namespace fastrtps
@@ -145,6 +145,7 @@ protected:
     friend class DynamicDataFactory;
     friend class DynamicPubSubType;
     friend class DynamicDataHelper;
+    friend class DynamicDataLayout;
 
 public:
 
@@ -0,0 +1,196 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_DYNAMIC_DATA_LAYOUT_H
+#define TYPES_DYNAMIC_DATA_LAYOUT_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastcdr {
+class Cdr;
+} // namespace fastcdr
+
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+
+/**
+ * Compiled memory layout of a fixed-size DynamicType.
+ *
+ * The layout places every serializable leaf of the type on a flat buffer with native alignment, and
+ * keeps the list of operations needed to (de)serialize that buffer to CDR in member order.
+ * Only structures whose members are primitives, enumerations, nested structures or arrays of those
+ * can be compiled. Any other type (strings, sequences, maps, unions, bitsets, bitmasks) is rejected and
+ * the caller should keep using the generic DynamicData path.
+ */
+class DynamicDataLayout
+{
+public:
+
+    /**
+     * Serialization step of the compiled plan. Consecutive leaves of the same kind are not merged, so
+     * each step maps to exactly one member (or one array member) of the type.
+     */
+    struct Operation
+    {
+        //! Kind of the primitive stored at @c offset.
+        TypeKind kind;
+        //! Offset of the first element on the flat buffer.
+        size_t offset;
+        //! Number of consecutive elements (1 for non-array members).
+        uint32_t count;
+        //! Whether this leaf is part of the key.
+        bool is_key;
+    };
+
+    /**
+     * Compiles the layout of a type.
+     * @param type Type to compile.
+     * @return The compiled layout, or nullptr when the type does not have a fixed-size representation.
+     */
+    RTPS_DllAPI static std::shared_ptr<const DynamicDataLayout> compile(
+            const DynamicType_ptr& type);
+
+    //! Size in bytes of the flat buffer representing one sample.
+    RTPS_DllAPI size_t flat_size() const
+    {
+        return flat_size_;
+    }
+
+    //! Alignment required by the flat buffer.
+    RTPS_DllAPI size_t flat_alignment() const
+    {
+        return flat_alignment_;
+    }
+
+    //! Size of the CDR representation of one sample, without encapsulation.
+    RTPS_DllAPI size_t serialized_size() const
+    {
+        return serialized_size_;
+    }
+
+    //! Size of the CDR representation of the key members.
+    RTPS_DllAPI size_t key_serialized_size() const
+    {
+        return key_serialized_size_;
+    }
+
+    //! Whether any of the members has been annotated as key.
+    RTPS_DllAPI bool has_key() const
+    {
+        return has_key_;
+    }
+
+    //! Compiled serialization plan, in CDR order.
+    RTPS_DllAPI const std::vector<Operation>& operations() const
+    {
+        return operations_;
+    }
+
+    /**
+     * Retrieves the location of a top-level member on the flat buffer.
+     * @param id Identifier of the member.
+     * @param kind Output kind of the member (TK_STRUCTURE for nested structures).
+     * @param offset Output offset of the member.
+     * @param count Output number of elements (greater than one for arrays).
+     * @return true when the member exists on the layout.
+     */
+    RTPS_DllAPI bool get_member(
+            MemberId id,
+            TypeKind& kind,
+            size_t& offset,
+            uint32_t& count) const;
+
+    //! Writes the default (zero) value of every member on a flat buffer.
+    RTPS_DllAPI void init(
+            octet* flat) const;
+
+    //! Serializes a flat buffer following the compiled plan.
+    RTPS_DllAPI void serialize(
+            const octet* flat,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Deserializes into a flat buffer following the compiled plan.
+    RTPS_DllAPI void deserialize(
+            eprosima::fastcdr::Cdr& cdr,
+            octet* flat) const;
+
+    //! Serializes the key members of a flat buffer.
+    RTPS_DllAPI void serialize_key(
+            const octet* flat,
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    //! Compares the values of every member on two flat buffers, ignoring their padding.
+    RTPS_DllAPI bool equals(
+            const octet* a,
+            const octet* b) const;
+
+    //! Copies the contents of a DynamicData of the compiled type into a flat buffer.
+    RTPS_DllAPI bool load(
+            const DynamicData* data,
+            octet* flat) const;
+
+    //! Copies the contents of a flat buffer into a DynamicData of the compiled type.
+    RTPS_DllAPI bool store(
+            const octet* flat,
+            DynamicData* data) const;
+
+private:
+
+    struct MemberEntry
+    {
+        MemberId id;
+        TypeKind kind;
+        size_t offset;
+        uint32_t count;
+    };
+
+    DynamicDataLayout() = default;
+
+    bool add_struct(
+            const DynamicType_ptr& type,
+            bool is_key,
+            bool top_level);
+
+    bool add_member(
+            MemberId id,
+            const DynamicType_ptr& type,
+            bool is_key,
+            bool top_level);
+
+    static void serialize_operation(
+            const Operation& op,
+            const octet* flat,
+            eprosima::fastcdr::Cdr& cdr);
+
+    std::vector<Operation> operations_;
+    std::vector<MemberEntry> members_;
+    size_t flat_size_ = 0;
+    size_t flat_alignment_ = 1;
+    size_t serialized_size_ = 0;
+    size_t key_serialized_size_ = 0;
+    bool has_key_ = false;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_DYNAMIC_DATA_LAYOUT_H
@@ -19,6 +19,7 @@
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicDataPtr.h>
+#include <fastrtps/types/DynamicDataLayout.h>
 #include <fastrtps/utils/md5.h>
 
 namespace eprosima {
@@ -32,6 +33,8 @@ protected:
     void UpdateDynamicTypeInfo();
 
     DynamicType_ptr dynamic_type_;
+    //! Compiled layout, only available for fixed-size types.
+    std::shared_ptr<const DynamicDataLayout> layout_;
     MD5 m_md5;
     unsigned char* m_keyBuffer;
 
@@ -0,0 +1,347 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_DATA_H
+#define TYPES_FLAT_DYNAMIC_DATA_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicDataLayout.h>
+
+#include <memory>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+class DynamicData;
+
+/**
+ * Sample of a dynamic type stored on a single flat buffer, following a compiled DynamicDataLayout.
+ * Member accessors resolve the member location on the precomputed layout, so they don't perform
+ * any allocation nor map lookup.
+ */
+class FlatDynamicData
+{
+public:
+
+    RTPS_DllAPI explicit FlatDynamicData(
+            std::shared_ptr<const DynamicDataLayout> layout);
+
+    RTPS_DllAPI const std::shared_ptr<const DynamicDataLayout>& layout() const
+    {
+        return layout_;
+    }
+
+    RTPS_DllAPI octet* data()
+    {
+        return buffer_.data();
+    }
+
+    RTPS_DllAPI const octet* data() const
+    {
+        return buffer_.data();
+    }
+
+    //! Resets all the members to zero.
+    RTPS_DllAPI void clear_all_values();
+
+    //! Copies the contents of a DynamicData of the same type.
+    RTPS_DllAPI bool load_from(
+            const DynamicData* data);
+
+    //! Copies the contents of this sample into a DynamicData of the same type.
+    RTPS_DllAPI bool store_to(
+            DynamicData* data) const;
+
+    RTPS_DllAPI bool equals(
+            const FlatDynamicData& other) const;
+
+    // Member accessors. The index selects the element when the member is an array.
+
+    RTPS_DllAPI ReturnCode_t get_int32_value(
+            int32_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_INT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_int32_value(
+            int32_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_INT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_uint32_value(
+            uint32_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_UINT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_uint32_value(
+            uint32_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_UINT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_int16_value(
+            int16_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_INT16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_int16_value(
+            int16_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_INT16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_uint16_value(
+            uint16_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_UINT16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_uint16_value(
+            uint16_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_UINT16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_int64_value(
+            int64_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_INT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_int64_value(
+            int64_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_INT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_uint64_value(
+            uint64_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_UINT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_uint64_value(
+            uint64_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_UINT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_float32_value(
+            float& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_FLOAT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_float32_value(
+            float value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_FLOAT32, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_float64_value(
+            double& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_FLOAT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_float64_value(
+            double value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_FLOAT64, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_float128_value(
+            long double& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_FLOAT128, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_float128_value(
+            long double value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_FLOAT128, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_char8_value(
+            char& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_CHAR8, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_char8_value(
+            char value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_CHAR8, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_char16_value(
+            wchar_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_CHAR16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_char16_value(
+            wchar_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_CHAR16, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_byte_value(
+            octet& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_BYTE, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_byte_value(
+            octet value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_BYTE, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_bool_value(
+            bool& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_BOOLEAN, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_bool_value(
+            bool value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_BOOLEAN, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t get_enum_value(
+            uint32_t& value,
+            MemberId id,
+            uint32_t index = 0) const
+    {
+        return get_value(value, TK_ENUM, id, index);
+    }
+
+    RTPS_DllAPI ReturnCode_t set_enum_value(
+            uint32_t value,
+            MemberId id,
+            uint32_t index = 0)
+    {
+        return set_value(value, TK_ENUM, id, index);
+    }
+
+private:
+
+    template<typename T>
+    ReturnCode_t get_value(
+            T& value,
+            TypeKind kind,
+            MemberId id,
+            uint32_t index) const
+    {
+        const octet* location = locate(kind, id, index, sizeof(T));
+        if (location == nullptr)
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        value = *reinterpret_cast<const T*>(location);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    template<typename T>
+    ReturnCode_t set_value(
+            T value,
+            TypeKind kind,
+            MemberId id,
+            uint32_t index)
+    {
+        octet* location = const_cast<octet*>(locate(kind, id, index, sizeof(T)));
+        if (location == nullptr)
+        {
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+        }
+        *reinterpret_cast<T*>(location) = value;
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    const octet* locate(
+            TypeKind kind,
+            MemberId id,
+            uint32_t index,
+            size_t element_size) const;
+
+    std::shared_ptr<const DynamicDataLayout> layout_;
+
+    //! Allocated through the default operator new, which is aligned for every primitive type.
+    std::vector<octet> buffer_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_DATA_H
@@ -0,0 +1,101 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
+#define TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/DynamicDataLayout.h>
+#include <fastrtps/utils/md5.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * TopicDataType for fixed-size dynamic types whose samples are FlatDynamicData objects.
+ * It is wire compatible with DynamicPubSubType and with the generated types for the same definition,
+ * but serializes by running the compiled layout plan instead of walking DynamicData members.
+ */
+class FlatDynamicPubSubType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    /**
+     * @param type Dynamic type to register. It should be checked with DynamicDataLayout::compile, as
+     * types without a fixed-size representation are not supported: samples of those cannot be created,
+     * serialized nor deserialized. Use is_valid to check it.
+     */
+    RTPS_DllAPI FlatDynamicPubSubType(
+            DynamicType_ptr type);
+
+    RTPS_DllAPI virtual ~FlatDynamicPubSubType();
+
+    RTPS_DllAPI void* createData() override;
+
+    RTPS_DllAPI void deleteData (
+            void* data) override;
+
+    RTPS_DllAPI bool deserialize (
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override;
+
+    RTPS_DllAPI bool getKey(
+            void* data,
+            eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool force_md5 = false) override;
+
+    RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override;
+
+    RTPS_DllAPI bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+    RTPS_DllAPI inline bool is_bounded() const override
+    {
+        return is_valid();
+    }
+
+    //! Whether the type could be compiled into a fixed-size layout.
+    RTPS_DllAPI bool is_valid() const
+    {
+        return static_cast<bool>(layout_);
+    }
+
+    RTPS_DllAPI DynamicType_ptr get_dynamic_type() const
+    {
+        return dynamic_type_;
+    }
+
+    RTPS_DllAPI const std::shared_ptr<const DynamicDataLayout>& get_layout() const
+    {
+        return layout_;
+    }
+
+protected:
+
+    DynamicType_ptr dynamic_type_;
+    std::shared_ptr<const DynamicDataLayout> layout_;
+    MD5 m_md5;
+    std::vector<unsigned char> m_keyBuffer;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_PUB_SUB_TYPE_H
@@ -251,6 +251,20 @@ public:
     RTPS_DllAPI bool typelookup_check_type_identifier(
             const TypeIdentifier& identifier) const;
 
+    /**
+     * @brief Checks if the TypeObjects related to two hashed (EK_MINIMAL or EK_COMPLETE) TypeIdentifiers
+     * are consistent. The result is cached, so checking again the same pair of types with the same
+     * policy doesn't need to traverse the TypeObjects.
+     * @param local
+     * @param remote
+     * @param consistency
+     * @return
+     */
+    RTPS_DllAPI bool check_type_object_consistency(
+            const TypeIdentifier& local,
+            const TypeIdentifier& remote,
+            const fastdds::dds::TypeConsistencyEnforcementQosPolicy& consistency) const;
+
     /**
      * @brief Retrieves the CompleteTypeObject from the given TypeInformation.
      * If it doesn't exist, it returns nullptr.
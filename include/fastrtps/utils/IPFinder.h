@@ -79,10 +79,30 @@ public:
     IPFinder();
     virtual ~IPFinder();
 
+    /**
+     * Get the addresses of the running interfaces of the host.
+     * The interfaces are enumerated once for the whole process and cached. The cache is refreshed when the system
+     * notifies a change on the interfaces or their addresses (netlink on Linux), or every second where such
+     * notifications are not available.
+     * @param[out] vec_name Vector where the addresses are appended.
+     * @param return_loopback Whether to include loopback addresses.
+     */
     RTPS_DllAPI static bool getIPs(
             std::vector<info_IP>* vec_name,
             bool return_loopback = false);
 
+    /**
+     * Get the version of the cached interfaces.
+     * The version changes every time a refresh of the cache finds different addresses, so results computed from
+     * the interfaces can be recomputed only when they are outdated.
+     */
+    RTPS_DllAPI static uint32_t getInterfacesVersion();
+
+    /**
+     * Discard the cached interfaces, so they are enumerated again on the next query.
+     */
+    RTPS_DllAPI static void invalidateIPs();
+
     /**
      * Get the IP4Adresses in all interfaces.
      * @param[out] locators List of locators to be populated with the IP4 addresses.
@@ -126,6 +146,14 @@ public:
      */
     RTPS_DllAPI static bool getAllMACAddress(
             std::vector<info_MAC>* macs);
+
+private:
+
+    friend class InterfacesCache;
+
+    //! Enumerate the addresses of the running interfaces of the host, including loopback ones.
+    static bool enumerateIPs(
+            std::vector<info_IP>* vec_name);
 };
 
 } // namespace rtps
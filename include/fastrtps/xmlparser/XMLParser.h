@@ -504,6 +504,16 @@ protected:
             rtps::SendBuffersAllocationAttributes& allocation,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLThreadPoolsSettings(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::SharedThreadPoolsSettings& settings,
+            uint8_t ident);
+
+    RTPS_DllAPI static XMLP_ret getXMLThreadPoolSettings(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::ThreadPoolSettings& settings,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLDiscoverySettings(
             tinyxml2::XMLElement* elem,
             rtps::DiscoverySettings& settings,
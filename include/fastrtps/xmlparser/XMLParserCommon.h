@@ -69,6 +69,7 @@ extern const char* MAX_LOGICAL_PORT;
 extern const char* LOGICAL_PORT_RANGE;
 extern const char* LOGICAL_PORT_INCREMENT;
 extern const char* ENABLE_TCP_NODELAY;
+extern const char* ASYNC_IO_THREADS;
 extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
@@ -97,6 +98,13 @@ extern const char* DATA_READER;
 
 /// LibrarySettings attributes
 extern const char* INTRAPROCESS_DELIVERY;
+extern const char* THREAD_POOLS;
+extern const char* TIMED_EVENTS;
+extern const char* ASYNC_WRITERS;
+extern const char* NUM_THREADS;
+extern const char* SCHEDULING_POLICY;
+extern const char* PRIORITY;
+extern const char* AFFINITY;
 
 /// RTPS Participant attributes
 extern const char* ALLOCATION;
@@ -179,6 +187,7 @@ extern const char* INIT_HEARTB_DELAY;
 extern const char* HEARTB_PERIOD;
 extern const char* NACK_RESP_DELAY;
 extern const char* NACK_SUPRESSION;
+extern const char* ADAPTIVE_RELIABILITY;
 extern const char* BY_NAME;
 extern const char* BY_VAL;
 extern const char* DURATION_INFINITY;
@@ -276,6 +285,7 @@ extern const char* LEASEDURATION;
 extern const char* LEASE_ANNOUNCE;
 extern const char* INITIAL_ANNOUNCEMENTS;
 extern const char* AVOID_BUILTIN_MULTICAST;
+extern const char* LAZY_BUILTIN_ENDPOINTS;
 extern const char* SIMPLE_EDP;
 extern const char* META_UNI_LOC_LIST;
 extern const char* META_MULTI_LOC_LIST;
@@ -0,0 +1,497 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/DynamicDataLayout.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastcdr/Cdr.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+namespace {
+
+// Size of one element on the flat buffer.
+size_t flat_element_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN: return sizeof(bool);
+        case TK_BYTE: return sizeof(octet);
+        case TK_CHAR8: return sizeof(char);
+        case TK_CHAR16: return sizeof(wchar_t);
+        case TK_INT16: return sizeof(int16_t);
+        case TK_UINT16: return sizeof(uint16_t);
+        case TK_INT32: return sizeof(int32_t);
+        case TK_UINT32: return sizeof(uint32_t);
+        case TK_ENUM: return sizeof(uint32_t);
+        case TK_FLOAT32: return sizeof(float);
+        case TK_INT64: return sizeof(int64_t);
+        case TK_UINT64: return sizeof(uint64_t);
+        case TK_FLOAT64: return sizeof(double);
+        case TK_FLOAT128: return sizeof(long double);
+        default: return 0;
+    }
+}
+
+size_t flat_element_alignment(
+        TypeKind kind)
+{
+    return TK_FLOAT128 == kind ? alignof(long double) : flat_element_size(kind);
+}
+
+// Size of one element on the CDR stream. Must be kept in sync with DynamicData::getCdrSerializedSize.
+size_t cdr_element_size(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+            return 1;
+        case TK_INT16:
+        case TK_UINT16:
+            return 2;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_ENUM:
+        case TK_FLOAT32:
+        case TK_CHAR16: // WCHARS NEED 32 Bits on Linux & MacOS
+            return 4;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            return 8;
+        case TK_FLOAT128:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+size_t cdr_element_alignment(
+        TypeKind kind)
+{
+    return TK_FLOAT128 == kind ? 8 : cdr_element_size(kind);
+}
+
+size_t align_to(
+        size_t position,
+        size_t alignment)
+{
+    return (position + alignment - 1) & ~(alignment - 1);
+}
+
+// Aliases are transparent on the wire.
+DynamicType_ptr resolve_alias(
+        DynamicType_ptr type)
+{
+    while (type && TK_ALIAS == type->get_kind())
+    {
+        type = type->get_descriptor()->get_base_type();
+    }
+    return type;
+}
+
+template<typename T>
+void serialize_elements(
+        const octet* flat,
+        uint32_t count,
+        eprosima::fastcdr::Cdr& cdr)
+{
+    const T* values = reinterpret_cast<const T*>(flat);
+    if (1 == count)
+    {
+        cdr.serialize(*values);
+    }
+    else
+    {
+        cdr.serializeArray(values, count);
+    }
+}
+
+template<typename T>
+void deserialize_elements(
+        eprosima::fastcdr::Cdr& cdr,
+        uint32_t count,
+        octet* flat)
+{
+    T* values = reinterpret_cast<T*>(flat);
+    if (1 == count)
+    {
+        cdr.deserialize(*values);
+    }
+    else
+    {
+        cdr.deserializeArray(values, count);
+    }
+}
+
+template<typename T>
+bool equal_elements(
+        const octet* a,
+        const octet* b,
+        uint32_t count)
+{
+    const T* a_values = reinterpret_cast<const T*>(a);
+    const T* b_values = reinterpret_cast<const T*>(b);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (!(a_values[i] == b_values[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::shared_ptr<const DynamicDataLayout> DynamicDataLayout::compile(
+        const DynamicType_ptr& type)
+{
+    DynamicType_ptr resolved = resolve_alias(type);
+    if (!resolved || TK_STRUCTURE != resolved->get_kind() ||
+            resolved->get_descriptor()->annotation_is_non_serialized())
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<DynamicDataLayout> layout(new DynamicDataLayout());
+    if (!layout->add_struct(resolved, false, true))
+    {
+        return nullptr;
+    }
+
+    layout->flat_size_ = align_to(layout->flat_size_, layout->flat_alignment_);
+
+    // CDR alignment is relative to the end of the encapsulation, so the serialized size is constant.
+    size_t position = 0;
+    size_t key_position = 0;
+    for (const Operation& op : layout->operations_)
+    {
+        size_t cdr_size = cdr_element_size(op.kind);
+        size_t cdr_align = cdr_element_alignment(op.kind);
+        position = align_to(position, cdr_align) + cdr_size * op.count;
+        if (op.is_key)
+        {
+            key_position = align_to(key_position, cdr_align) + cdr_size * op.count;
+        }
+    }
+    layout->serialized_size_ = position;
+    layout->key_serialized_size_ = key_position;
+
+    return layout;
+}
+
+bool DynamicDataLayout::add_struct(
+        const DynamicType_ptr& type,
+        bool is_key,
+        bool top_level)
+{
+    std::map<MemberId, DynamicTypeMember*> members;
+    if (type->get_all_members(members) != ReturnCode_t::RETCODE_OK)
+    {
+        return false;
+    }
+
+    for (auto it = members.begin(); it != members.end(); ++it)
+    {
+        const MemberDescriptor* descriptor = it->second->get_descriptor();
+        if (descriptor->annotation_is_non_serialized())
+        {
+            continue;
+        }
+
+        bool member_is_key = is_key || it->second->key_annotation();
+        has_key_ |= member_is_key;
+        if (!add_member(it->first, descriptor->get_type(), member_is_key, top_level))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DynamicDataLayout::add_member(
+        MemberId id,
+        const DynamicType_ptr& member_type,
+        bool is_key,
+        bool top_level)
+{
+    DynamicType_ptr type = resolve_alias(member_type);
+    if (!type || type->get_descriptor()->annotation_is_non_serialized())
+    {
+        return false;
+    }
+
+    uint32_t count = 1;
+    if (TK_ARRAY == type->get_kind())
+    {
+        count = type->get_total_bounds();
+        type = resolve_alias(type->get_descriptor()->get_element_type());
+        if (!type || 0 == count)
+        {
+            return false;
+        }
+    }
+
+    TypeKind kind = type->get_kind();
+    if (TK_STRUCTURE == kind)
+    {
+        // Nested structures (or arrays of them) are flattened in place.
+        size_t first_operation = operations_.size();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (!add_struct(type, is_key, false))
+            {
+                return false;
+            }
+        }
+
+        if (top_level)
+        {
+            size_t offset = first_operation < operations_.size() ? operations_[first_operation].offset : flat_size_;
+            members_.push_back({id, kind, offset, count});
+        }
+        return true;
+    }
+
+    size_t element_size = flat_element_size(kind);
+    if (0 == element_size)
+    {
+        return false;
+    }
+
+    size_t element_alignment = flat_element_alignment(kind);
+    flat_size_ = align_to(flat_size_, element_alignment);
+    flat_alignment_ = std::max(flat_alignment_, element_alignment);
+    operations_.push_back({kind, flat_size_, count, is_key});
+    if (top_level)
+    {
+        members_.push_back({id, kind, flat_size_, count});
+    }
+    flat_size_ += element_size * count;
+    return true;
+}
+
+bool DynamicDataLayout::get_member(
+        MemberId id,
+        TypeKind& kind,
+        size_t& offset,
+        uint32_t& count) const
+{
+    // Members are usually numbered consecutively from zero.
+    if (id < members_.size() && members_[id].id == id)
+    {
+        kind = members_[id].kind;
+        offset = members_[id].offset;
+        count = members_[id].count;
+        return true;
+    }
+
+    for (const MemberEntry& entry : members_)
+    {
+        if (entry.id == id)
+        {
+            kind = entry.kind;
+            offset = entry.offset;
+            count = entry.count;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DynamicDataLayout::init(
+        octet* flat) const
+{
+    memset(flat, 0, flat_size_);
+}
+
+void DynamicDataLayout::serialize_operation(
+        const Operation& op,
+        const octet* flat,
+        eprosima::fastcdr::Cdr& cdr)
+{
+    const octet* values = flat + op.offset;
+    switch (op.kind)
+    {
+        case TK_BOOLEAN: serialize_elements<bool>(values, op.count, cdr); break;
+        case TK_BYTE: serialize_elements<uint8_t>(values, op.count, cdr); break;
+        case TK_CHAR8: serialize_elements<char>(values, op.count, cdr); break;
+        case TK_CHAR16: serialize_elements<wchar_t>(values, op.count, cdr); break;
+        case TK_INT16: serialize_elements<int16_t>(values, op.count, cdr); break;
+        case TK_UINT16: serialize_elements<uint16_t>(values, op.count, cdr); break;
+        case TK_INT32: serialize_elements<int32_t>(values, op.count, cdr); break;
+        case TK_ENUM:
+        case TK_UINT32: serialize_elements<uint32_t>(values, op.count, cdr); break;
+        case TK_FLOAT32: serialize_elements<float>(values, op.count, cdr); break;
+        case TK_INT64: serialize_elements<int64_t>(values, op.count, cdr); break;
+        case TK_UINT64: serialize_elements<uint64_t>(values, op.count, cdr); break;
+        case TK_FLOAT64: serialize_elements<double>(values, op.count, cdr); break;
+        case TK_FLOAT128: serialize_elements<long double>(values, op.count, cdr); break;
+        default: break;
+    }
+}
+
+void DynamicDataLayout::serialize(
+        const octet* flat,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    for (const Operation& op : operations_)
+    {
+        serialize_operation(op, flat, cdr);
+    }
+}
+
+void DynamicDataLayout::serialize_key(
+        const octet* flat,
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    for (const Operation& op : operations_)
+    {
+        if (op.is_key)
+        {
+            serialize_operation(op, flat, cdr);
+        }
+    }
+}
+
+void DynamicDataLayout::deserialize(
+        eprosima::fastcdr::Cdr& cdr,
+        octet* flat) const
+{
+    for (const Operation& op : operations_)
+    {
+        octet* values = flat + op.offset;
+        switch (op.kind)
+        {
+            case TK_BOOLEAN: deserialize_elements<bool>(cdr, op.count, values); break;
+            case TK_BYTE: deserialize_elements<uint8_t>(cdr, op.count, values); break;
+            case TK_CHAR8: deserialize_elements<char>(cdr, op.count, values); break;
+            case TK_CHAR16: deserialize_elements<wchar_t>(cdr, op.count, values); break;
+            case TK_INT16: deserialize_elements<int16_t>(cdr, op.count, values); break;
+            case TK_UINT16: deserialize_elements<uint16_t>(cdr, op.count, values); break;
+            case TK_INT32: deserialize_elements<int32_t>(cdr, op.count, values); break;
+            case TK_ENUM:
+            case TK_UINT32: deserialize_elements<uint32_t>(cdr, op.count, values); break;
+            case TK_FLOAT32: deserialize_elements<float>(cdr, op.count, values); break;
+            case TK_INT64: deserialize_elements<int64_t>(cdr, op.count, values); break;
+            case TK_UINT64: deserialize_elements<uint64_t>(cdr, op.count, values); break;
+            case TK_FLOAT64: deserialize_elements<double>(cdr, op.count, values); break;
+            case TK_FLOAT128: deserialize_elements<long double>(cdr, op.count, values); break;
+            default: break;
+        }
+    }
+}
+
+bool DynamicDataLayout::equals(
+        const octet* a,
+        const octet* b) const
+{
+    // Values are compared one by one, as the bytes between members and inside some of them (long double) are not
+    // part of the value
+    for (const Operation& op : operations_)
+    {
+        const octet* a_values = a + op.offset;
+        const octet* b_values = b + op.offset;
+        bool equal = true;
+        switch (op.kind)
+        {
+            case TK_BOOLEAN: equal = equal_elements<bool>(a_values, b_values, op.count); break;
+            case TK_BYTE: equal = equal_elements<uint8_t>(a_values, b_values, op.count); break;
+            case TK_CHAR8: equal = equal_elements<char>(a_values, b_values, op.count); break;
+            case TK_CHAR16: equal = equal_elements<wchar_t>(a_values, b_values, op.count); break;
+            case TK_INT16: equal = equal_elements<int16_t>(a_values, b_values, op.count); break;
+            case TK_UINT16: equal = equal_elements<uint16_t>(a_values, b_values, op.count); break;
+            case TK_INT32: equal = equal_elements<int32_t>(a_values, b_values, op.count); break;
+            case TK_ENUM:
+            case TK_UINT32: equal = equal_elements<uint32_t>(a_values, b_values, op.count); break;
+            case TK_FLOAT32: equal = equal_elements<float>(a_values, b_values, op.count); break;
+            case TK_INT64: equal = equal_elements<int64_t>(a_values, b_values, op.count); break;
+            case TK_UINT64: equal = equal_elements<uint64_t>(a_values, b_values, op.count); break;
+            case TK_FLOAT64: equal = equal_elements<double>(a_values, b_values, op.count); break;
+            case TK_FLOAT128: equal = equal_elements<long double>(a_values, b_values, op.count); break;
+            default: break;
+        }
+
+        if (!equal)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DynamicDataLayout::load(
+        const DynamicData* data,
+        octet* flat) const
+{
+    // Conversions go through the CDR representation, which both sides agree on.
+    std::vector<char> buffer(serialized_size_ + 8);
+    eprosima::fastcdr::FastBuffer fastbuffer(buffer.data(), buffer.size());
+    eprosima::fastcdr::Cdr ser(fastbuffer);
+
+    try
+    {
+        data->serialize(ser);
+        ser.reset();
+        deserialize(ser, flat);
+    }
+    catch (eprosima::fastcdr::exception::Exception& exception)
+    {
+        logError(DYN_TYPES, "Error loading flat sample: " << exception.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool DynamicDataLayout::store(
+        const octet* flat,
+        DynamicData* data) const
+{
+    std::vector<char> buffer(serialized_size_ + 8);
+    eprosima::fastcdr::FastBuffer fastbuffer(buffer.data(), buffer.size());
+    eprosima::fastcdr::Cdr ser(fastbuffer);
+
+    try
+    {
+        serialize(flat, ser);
+        ser.reset();
+        return data->deserialize(ser);
+    }
+    catch (eprosima::fastcdr::exception::Exception& exception)
+    {
+        logError(DYN_TYPES, "Error storing flat sample: " << exception.what());
+        return false;
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -30,12 +30,14 @@ DynamicPubSubType::DynamicPubSubType()
     : dynamic_type_(nullptr)
     , m_keyBuffer(nullptr)
 {
+    checks_serialization_bounds(true);
 }
 
 DynamicPubSubType::DynamicPubSubType(DynamicType_ptr pType)
     : dynamic_type_(pType)
     , m_keyBuffer(nullptr)
 {
+    checks_serialization_bounds(true);
     UpdateDynamicTypeInfo();
 }
 
@@ -50,6 +52,7 @@ DynamicPubSubType::~DynamicPubSubType()
 void DynamicPubSubType::CleanDynamicType()
 {
     dynamic_type_ = nullptr;
+    layout_.reset();
 }
 
 DynamicType_ptr DynamicPubSubType::GetDynamicType() const
@@ -162,6 +165,16 @@ bool DynamicPubSubType::getKey(
 
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
 {
+    if (layout_)
+    {
+        // Fixed-size types don't need to walk the sample.
+        uint32_t size = static_cast<uint32_t>(layout_->serialized_size()) + 4 /*encapsulation*/;
+        return [size]() -> uint32_t
+               {
+                   return size;
+               };
+    }
+
     return [data]() -> uint32_t
     {
         return (uint32_t)DynamicData::getCdrSerializedSize((DynamicData*)data) + 4 /*encapsulation*/;
@@ -209,6 +222,7 @@ void DynamicPubSubType::UpdateDynamicTypeInfo()
         }
 
         m_typeSize = static_cast<uint32_t>(DynamicData::getMaxCdrSerializedSize(dynamic_type_) + 4);
+        layout_ = DynamicDataLayout::compile(dynamic_type_);
         setName(dynamic_type_->get_name().c_str());
     }
 }
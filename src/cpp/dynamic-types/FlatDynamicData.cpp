@@ -0,0 +1,71 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicData.h>
+#include <fastrtps/types/DynamicData.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+FlatDynamicData::FlatDynamicData(
+        std::shared_ptr<const DynamicDataLayout> layout)
+    : layout_(std::move(layout))
+    , buffer_(layout_->flat_size(), 0)
+{
+}
+
+void FlatDynamicData::clear_all_values()
+{
+    layout_->init(buffer_.data());
+}
+
+bool FlatDynamicData::load_from(
+        const DynamicData* data)
+{
+    return layout_->load(data, buffer_.data());
+}
+
+bool FlatDynamicData::store_to(
+        DynamicData* data) const
+{
+    return layout_->store(buffer_.data(), data);
+}
+
+bool FlatDynamicData::equals(
+        const FlatDynamicData& other) const
+{
+    return layout_ == other.layout_ && layout_->equals(buffer_.data(), other.buffer_.data());
+}
+
+const octet* FlatDynamicData::locate(
+        TypeKind kind,
+        MemberId id,
+        uint32_t index,
+        size_t element_size) const
+{
+    TypeKind member_kind;
+    size_t offset;
+    uint32_t count;
+    if (!layout_->get_member(id, member_kind, offset, count) || member_kind != kind || index >= count)
+    {
+        return nullptr;
+    }
+
+    return buffer_.data() + offset + index * element_size;
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
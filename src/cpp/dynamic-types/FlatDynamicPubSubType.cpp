@@ -0,0 +1,176 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicPubSubType.h>
+#include <fastrtps/types/FlatDynamicData.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastcdr/Cdr.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+FlatDynamicPubSubType::FlatDynamicPubSubType(
+        DynamicType_ptr type)
+    : dynamic_type_(type)
+    , layout_(DynamicDataLayout::compile(type))
+{
+    if (!layout_)
+    {
+        logError(DYN_TYPES, "Type " << (type ? type->get_name() : "") << " has no fixed-size layout");
+        return;
+    }
+
+    setName(dynamic_type_->get_name().c_str());
+    m_typeSize = static_cast<uint32_t>(layout_->serialized_size() + 4 /*encapsulation*/);
+    m_isGetKeyDefined = layout_->has_key();
+    size_t key_size = layout_->key_serialized_size();
+    m_keyBuffer.assign(key_size > 16 ? key_size : 16, 0);
+}
+
+FlatDynamicPubSubType::~FlatDynamicPubSubType()
+{
+}
+
+void* FlatDynamicPubSubType::createData()
+{
+    if (!layout_)
+    {
+        return nullptr;
+    }
+    return new FlatDynamicData(layout_);
+}
+
+void FlatDynamicPubSubType::deleteData(
+        void* data)
+{
+    delete static_cast<FlatDynamicData*>(data);
+}
+
+bool FlatDynamicPubSubType::serialize(
+        void* data,
+        eprosima::fastrtps::rtps::SerializedPayload_t* payload)
+{
+    if (!layout_)
+    {
+        return false;
+    }
+
+    FlatDynamicData* sample = static_cast<FlatDynamicData*>(data);
+
+    // Object that manages the raw buffer.
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)payload->data, payload->max_size);
+
+    // Object that serializes the data.
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+    payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+    // Serialize encapsulation
+    ser.serialize_encapsulation();
+
+    try
+    {
+        layout_->serialize(sample->data(), ser);
+    }
+    catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+    {
+        return false;
+    }
+
+    payload->length = (uint32_t)ser.getSerializedDataLength(); //Get the serialized length
+    return true;
+}
+
+bool FlatDynamicPubSubType::deserialize(
+        eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+        void* data)
+{
+    if (!layout_)
+    {
+        return false;
+    }
+
+    FlatDynamicData* sample = static_cast<FlatDynamicData*>(data);
+
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)payload->data, payload->length); // Object that manages the raw buffer.
+    eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+            eprosima::fastcdr::Cdr::DDS_CDR); // Object that deserializes the data.
+
+    // Deserialize encapsulation.
+    deser.read_encapsulation();
+    payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+    try
+    {
+        layout_->deserialize(deser, sample->data());
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        return false;
+    }
+    return true;
+}
+
+std::function<uint32_t()> FlatDynamicPubSubType::getSerializedSizeProvider(
+        void* /*data*/)
+{
+    uint32_t size = m_typeSize;
+    return [size]() -> uint32_t
+           {
+               return size;
+           };
+}
+
+bool FlatDynamicPubSubType::getKey(
+        void* data,
+        eprosima::fastrtps::rtps::InstanceHandle_t* handle,
+        bool force_md5)
+{
+    if (!layout_ || !m_isGetKeyDefined)
+    {
+        return false;
+    }
+
+    FlatDynamicData* sample = static_cast<FlatDynamicData*>(data);
+    size_t keyBufferSize = layout_->key_serialized_size();
+
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer.data(), m_keyBuffer.size());
+    eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
+    layout_->serialize_key(sample->data(), ser);
+    if (force_md5 || keyBufferSize > 16)
+    {
+        m_md5.init();
+        m_md5.update(m_keyBuffer.data(), (unsigned int)ser.getSerializedDataLength());
+        m_md5.finalize();
+        for (uint8_t i = 0; i < 16; ++i)
+        {
+            handle->value[i] = m_md5.digest[i];
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < 16; ++i)
+        {
+            handle->value[i] = m_keyBuffer[i];
+        }
+    }
+    return true;
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
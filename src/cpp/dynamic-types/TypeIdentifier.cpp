@@ -1449,19 +1449,7 @@ bool TypeIdentifier::consistent(
                 return false;
             }
 
-            const TypeObject* localObj = TypeObjectFactory::get_instance()->get_type_object(this);
-            const TypeObject* remoteObj = TypeObjectFactory::get_instance()->get_type_object(&x);
-            if (localObj == nullptr)
-            {
-                logWarning(XTYPES, "Local TypeIdentifier doesn't have a related TypeObject");
-                return false;
-            }
-            if (remoteObj == nullptr)
-            {
-                logWarning(XTYPES, "Remote TypeIdentifier doesn't have a related TypeObject");
-                return false;
-            }
-            return localObj->consistent(*remoteObj, consistency);
+            return TypeObjectFactory::get_instance()->check_type_object_consistency(*this, x, consistency);
         }
         default:
             break;
@@ -0,0 +1,307 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeObjectCache.hpp
+ */
+
+#ifndef _FASTRTPS_TYPES_TYPEOBJECTCACHE_HPP_
+#define _FASTRTPS_TYPES_TYPEOBJECTCACHE_HPP_
+
+#include <fastrtps/types/TypeIdentifier.h>
+#include <fastrtps/types/TypeObject.h>
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Index of the hashed (EK_MINIMAL and EK_COMPLETE) TypeIdentifiers registered on the TypeObjectFactory,
+ * together with the results of the consistency checks already performed.
+ *
+ * Both indexes are split in shards with their own mutex, so lookups never contend with the factory mutexes and
+ * rarely with each other, and insertions do not copy the indexes.
+ */
+class TypeObjectCache
+{
+public:
+
+    static bool is_hashed(
+            const TypeIdentifier& identifier)
+    {
+        return identifier._d() == EK_MINIMAL || identifier._d() == EK_COMPLETE;
+    }
+
+    //! Stored identifier and object for a hash.
+    struct Entry
+    {
+        const TypeIdentifier* identifier = nullptr;
+        const TypeObject* object = nullptr;
+    };
+
+    /**
+     * Look for a hashed identifier.
+     * @param identifier Identifier to look for. Must be hashed.
+     * @param entry Stored identifier and object, when found.
+     * @return true when the identifier is registered.
+     */
+    bool find(
+            const TypeIdentifier& identifier,
+            Entry& entry) const
+    {
+        Key key(identifier);
+        const IdentifierShard& shard = identifiers_.shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end())
+        {
+            return false;
+        }
+        entry = it->second;
+        return true;
+    }
+
+    void add_identifier(
+            const TypeIdentifier* identifier)
+    {
+        Key key(*identifier);
+        IdentifierShard& shard = identifiers_.shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Entry& entry = shard.map[key];
+        if (entry.identifier == nullptr)
+        {
+            entry.identifier = identifier;
+        }
+    }
+
+    void add_object(
+            const TypeIdentifier* identifier,
+            const TypeObject* object)
+    {
+        Key key(*identifier);
+        {
+            IdentifierShard& shard = identifiers_.shard(key);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            Entry& entry = shard.map[key];
+            if (entry.identifier == nullptr)
+            {
+                entry.identifier = identifier;
+            }
+            entry.object = object;
+        }
+
+        // Registering an object may turn a previous negative result into a positive one.
+        clear_consistency();
+    }
+
+    /**
+     * Generation of the consistency results. It changes every time the cached results are dropped, so results
+     * computed before that are not added afterwards.
+     */
+    uint64_t consistency_generation() const
+    {
+        return consistency_generation_.load();
+    }
+
+    /**
+     * Look for the result of a consistency check performed previously.
+     * @return true when the result was cached.
+     */
+    bool find_consistency(
+            const TypeIdentifier& local,
+            const TypeIdentifier& remote,
+            const fastdds::dds::TypeConsistencyEnforcementQosPolicy& policy,
+            bool& consistent) const
+    {
+        ConsistencyKey key(local, remote, policy);
+        const ConsistencyShard& shard = consistency_.shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end())
+        {
+            return false;
+        }
+        consistent = it->second;
+        return true;
+    }
+
+    /**
+     * Add the result of a consistency check.
+     * @param generation Value of consistency_generation() before the TypeObjects were looked up. The result is
+     * discarded when the cached results were dropped since then.
+     */
+    void add_consistency(
+            const TypeIdentifier& local,
+            const TypeIdentifier& remote,
+            const fastdds::dds::TypeConsistencyEnforcementQosPolicy& policy,
+            bool consistent,
+            uint64_t generation)
+    {
+        ConsistencyKey key(local, remote, policy);
+        ConsistencyShard& shard = consistency_.shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        // Checked with the shard locked, as clear_consistency changes the generation before clearing the shards
+        if (generation == consistency_generation_.load())
+        {
+            shard.map.emplace(key, consistent);
+        }
+    }
+
+    void clear()
+    {
+        identifiers_.clear();
+        clear_consistency();
+    }
+
+private:
+
+    //! Equivalence kind followed by the equivalence hash.
+    struct Key
+    {
+        explicit Key(
+                const TypeIdentifier& identifier)
+        {
+            bytes[0] = identifier._d();
+            memcpy(&bytes[1], identifier.equivalence_hash(), sizeof(EquivalenceHash));
+        }
+
+        bool operator ==(
+                const Key& other) const
+        {
+            return 0 == memcmp(bytes, other.bytes, sizeof(bytes));
+        }
+
+        octet bytes[1 + sizeof(EquivalenceHash)];
+    };
+
+    struct KeyHash
+    {
+        size_t operator ()(
+                const Key& key) const
+        {
+            // Equivalence hashes are already MD5 based, so their first bytes are evenly distributed.
+            size_t value = key.bytes[0];
+            for (size_t i = 1; i <= sizeof(size_t) && i < sizeof(key.bytes); ++i)
+            {
+                value = (value << 8) ^ key.bytes[i];
+            }
+            return value;
+        }
+
+    };
+
+    struct ConsistencyKey
+    {
+        ConsistencyKey(
+                const TypeIdentifier& local_identifier,
+                const TypeIdentifier& remote_identifier,
+                const fastdds::dds::TypeConsistencyEnforcementQosPolicy& policy)
+            : local(local_identifier)
+            , remote(remote_identifier)
+            , flags(static_cast<octet>(
+                        (static_cast<octet>(policy.m_kind) & 0x03) |
+                        (policy.m_ignore_sequence_bounds ? 0x04 : 0) |
+                        (policy.m_ignore_string_bounds ? 0x08 : 0) |
+                        (policy.m_ignore_member_names ? 0x10 : 0) |
+                        (policy.m_prevent_type_widening ? 0x20 : 0) |
+                        (policy.m_force_type_validation ? 0x40 : 0)))
+        {
+        }
+
+        bool operator ==(
+                const ConsistencyKey& other) const
+        {
+            return flags == other.flags && local == other.local && remote == other.remote;
+        }
+
+        Key local;
+        Key remote;
+        octet flags;
+    };
+
+    struct ConsistencyKeyHash
+    {
+        size_t operator ()(
+                const ConsistencyKey& key) const
+        {
+            KeyHash hash;
+            return (hash(key.local) * 31 + hash(key.remote)) ^ key.flags;
+        }
+
+    };
+
+    //! Map split in shards selected by the hash of the key, each one protected by its own mutex.
+    template<typename K, typename V, typename Hash>
+    struct ShardedMap
+    {
+        static constexpr size_t num_shards = 16;
+
+        struct Shard
+        {
+            mutable std::mutex mutex;
+            std::unordered_map<K, V, Hash> map;
+        };
+
+        Shard& shard(
+                const K& key)
+        {
+            return shards[Hash()(key) % num_shards];
+        }
+
+        const Shard& shard(
+                const K& key) const
+        {
+            return shards[Hash()(key) % num_shards];
+        }
+
+        void clear()
+        {
+            for (Shard& shard : shards)
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.map.clear();
+            }
+        }
+
+        std::array<Shard, num_shards> shards;
+    };
+
+    using IdentifierIndex = ShardedMap<Key, Entry, KeyHash>;
+    using IdentifierShard = IdentifierIndex::Shard;
+    using ConsistencyIndex = ShardedMap<ConsistencyKey, bool, ConsistencyKeyHash>;
+    using ConsistencyShard = ConsistencyIndex::Shard;
+
+    void clear_consistency()
+    {
+        ++consistency_generation_;
+        consistency_.clear();
+    }
+
+    IdentifierIndex identifiers_;
+    ConsistencyIndex consistency_;
+    std::atomic<uint64_t> consistency_generation_{0};
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTRTPS_TYPES_TYPEOBJECTCACHE_HPP_
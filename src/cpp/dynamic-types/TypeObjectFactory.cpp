@@ -27,6 +27,8 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <sstream>
 
+#include "TypeObjectCache.hpp"
+
 namespace eprosima {
 namespace fastrtps {
 namespace types {
@@ -44,6 +46,8 @@ public:
 
 static TypeObjectFactoryReleaser s_releaser;
 static TypeObjectFactory* g_instance = nullptr;
+// Hash index of the EK_MINIMAL and EK_COMPLETE identifiers of g_instance
+static TypeObjectCache* g_cache = nullptr;
 TypeObjectFactory* TypeObjectFactory::get_instance()
 {
     if (g_instance == nullptr)
@@ -67,6 +71,7 @@ ReturnCode_t TypeObjectFactory::delete_instance()
 
 TypeObjectFactory::TypeObjectFactory()
 {
+    g_cache = new TypeObjectCache();
     std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     // Generate basic TypeIdentifiers
     TypeIdentifier* auxIdent;
@@ -192,6 +197,8 @@ TypeObjectFactory::~TypeObjectFactory()
         }
         complete_objects_.clear();
     }
+    delete g_cache;
+    g_cache = nullptr;
 }
 
 void TypeObjectFactory::create_builtin_annotations()
@@ -873,11 +880,18 @@ const TypeObject* TypeObjectFactory::get_type_object(
 const TypeObject* TypeObjectFactory::get_type_object(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier == nullptr)
     {
         return nullptr;
     }
+
+    if (TypeObjectCache::is_hashed(*identifier))
+    {
+        TypeObjectCache::Entry entry;
+        return g_cache->find(*identifier, entry) ? entry.object : nullptr;
+    }
+
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexObjects);
     if (identifier->_d() == EK_COMPLETE)
     {
         if (complete_objects_.find(identifier) != complete_objects_.end())
@@ -1116,11 +1130,18 @@ const TypeIdentifier* TypeObjectFactory::get_type_identifier_trying_complete(
 const TypeIdentifier* TypeObjectFactory::get_stored_type_identifier(
         const TypeIdentifier* identifier) const
 {
-    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier == nullptr)
     {
         return nullptr;
     }
+
+    if (TypeObjectCache::is_hashed(*identifier))
+    {
+        TypeObjectCache::Entry entry;
+        return g_cache->find(*identifier, entry) ? entry.identifier : nullptr;
+    }
+
+    std::unique_lock<std::recursive_mutex> scoped(m_MutexIdentifiers);
     if (identifier->_d() == EK_COMPLETE)
     {
         for (auto& it : complete_identifiers_)
@@ -1363,6 +1384,10 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             complete_identifiers_[type_name] = id;
+            if (TypeObjectCache::is_hashed(*id))
+            {
+                g_cache->add_identifier(id);
+            }
         }
     }
     else
@@ -1373,6 +1398,10 @@ void TypeObjectFactory::add_type_identifier(
             identifiers_created_.push_back(id);
             *id = *identifier;
             identifiers_[type_name] = id;
+            if (TypeObjectCache::is_hashed(*id))
+            {
+                g_cache->add_identifier(id);
+            }
         }
     }
 }
@@ -1398,6 +1427,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     objects_[typeId] = obj;
+                    if (typeId != nullptr && TypeObjectCache::is_hashed(*typeId))
+                    {
+                        g_cache->add_object(typeId, obj);
+                    }
                 }
             }
             else if (object->_d() == EK_COMPLETE)
@@ -1408,6 +1441,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     complete_objects_[typeId] = obj;
+                    if (typeId != nullptr && TypeObjectCache::is_hashed(*typeId))
+                    {
+                        g_cache->add_object(typeId, obj);
+                    }
                 }
             }
         }
@@ -1421,6 +1458,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     objects_[typeId] = obj;
+                    if (typeId != nullptr && TypeObjectCache::is_hashed(*typeId))
+                    {
+                        g_cache->add_object(typeId, obj);
+                    }
                 }
             }
             else if (object->_d() == EK_COMPLETE)
@@ -1430,6 +1471,10 @@ void TypeObjectFactory::add_type_object(
                     TypeObject* obj = new TypeObject();
                     *obj = *object;
                     complete_objects_[typeId] = obj;
+                    if (typeId != nullptr && TypeObjectCache::is_hashed(*typeId))
+                    {
+                        g_cache->add_object(typeId, obj);
+                    }
                 }
             }
         }
@@ -2295,6 +2340,41 @@ bool TypeObjectFactory::typelookup_check_type_identifier(
     return get_stored_type_identifier(&identifier) != nullptr;
 }
 
+bool TypeObjectFactory::check_type_object_consistency(
+        const TypeIdentifier& local,
+        const TypeIdentifier& remote,
+        const fastdds::dds::TypeConsistencyEnforcementQosPolicy& consistency) const
+{
+    bool consistent = false;
+    bool cacheable = TypeObjectCache::is_hashed(local) && TypeObjectCache::is_hashed(remote);
+    uint64_t generation = g_cache->consistency_generation();
+    if (cacheable && g_cache->find_consistency(local, remote, consistency, consistent))
+    {
+        return consistent;
+    }
+
+    const TypeObject* localObj = get_type_object(&local);
+    const TypeObject* remoteObj = get_type_object(&remote);
+    if (localObj == nullptr)
+    {
+        logWarning(XTYPES, "Local TypeIdentifier doesn't have a related TypeObject");
+        return false;
+    }
+    if (remoteObj == nullptr)
+    {
+        logWarning(XTYPES, "Remote TypeIdentifier doesn't have a related TypeObject");
+        return false;
+    }
+
+    // Missing objects are not cached, as they may be received later through TypeLookup.
+    consistent = localObj->consistent(*remoteObj, consistency);
+    if (cacheable)
+    {
+        g_cache->add_consistency(local, remote, consistency, consistent, generation);
+    }
+    return consistent;
+}
+
 const TypeObject* TypeObjectFactory::typelookup_get_type_object_from_information(
         const TypeInformation& information) const
 {
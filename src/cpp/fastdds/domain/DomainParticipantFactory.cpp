@@ -311,6 +311,9 @@ ReturnCode_t DomainParticipantFactory::load_profiles()
         // Only load profile once
         default_xml_profiles_loaded = true;
 
+        // Library settings may have been given on the default XML file
+        factory_qos_.thread_pools(XMLProfileManager::library_settings().thread_pools);
+
         // Only change default participant qos when not explicitly set by the user
         if (default_participant_qos_ == PARTICIPANT_QOS_DEFAULT)
         {
@@ -329,6 +332,7 @@ ReturnCode_t DomainParticipantFactory::load_XML_profiles_file(
         logError(DOMAIN, "Problem loading XML file '" << xml_profile_file << "'");
         return ReturnCode_t::RETCODE_ERROR;
     }
+    factory_qos_.thread_pools(XMLProfileManager::library_settings().thread_pools);
     return ReturnCode_t::RETCODE_OK;
 }
 
@@ -352,6 +356,11 @@ ReturnCode_t DomainParticipantFactory::set_qos(
         return ReturnCode_t::RETCODE_IMMUTABLE_POLICY;
     }
     set_qos(factory_qos_, qos, false);
+
+    // Thread pools are created by the RTPS layer, which takes its settings from the library settings
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings = XMLProfileManager::library_settings();
+    library_settings.thread_pools = factory_qos_.thread_pools();
+    XMLProfileManager::library_settings(library_settings);
     return ReturnCode_t::RETCODE_OK;
 }
 
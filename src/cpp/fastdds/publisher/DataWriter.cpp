@@ -98,6 +98,13 @@ ReturnCode_t DataWriter::write(
     return impl_->write(data, handle);
 }
 
+ReturnCode_t DataWriter::write_shared(
+        const std::shared_ptr<const void>& data,
+        const InstanceHandle_t& handle)
+{
+    return impl_->write_shared(data, handle);
+}
+
 ReturnCode_t DataWriter::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -44,8 +44,11 @@
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
 #include <functional>
 #include <iostream>
+#include <mutex>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -55,6 +58,9 @@ namespace eprosima {
 namespace fastdds {
 namespace dds {
 
+/**
+ * Payloads loaned to the user. Thread safe, as loaned samples are written without blocking the writer.
+ */
 class DataWriterImpl::LoanCollection
 {
 public:
@@ -71,6 +77,7 @@ public:
     {
         static_cast<void>(data);
         assert(data == payload.payload.data + SerializedPayload_t::representation_header_size);
+        std::lock_guard<std::mutex> guard(mutex_);
         return loans_.push_back(payload);
     }
 
@@ -79,6 +86,7 @@ public:
             PayloadInfo_t& payload)
     {
         octet* payload_data = static_cast<octet*>(data) - SerializedPayload_t::representation_header_size;
+        std::lock_guard<std::mutex> guard(mutex_);
         for (auto it = loans_.begin(); it != loans_.end(); ++it)
         {
             if (it->payload.data == payload_data)
@@ -93,6 +101,7 @@ public:
 
     bool is_empty() const
     {
+        std::lock_guard<std::mutex> guard(mutex_);
         return loans_.empty();
     }
 
@@ -109,6 +118,7 @@ private:
             };
     }
 
+    mutable std::mutex mutex_;
     ResourceLimitedVector<PayloadInfo_t> loans_;
 
 };
@@ -514,6 +524,42 @@ ReturnCode_t DataWriterImpl::write(
     return create_new_change_with_params(ALIVE, data, wparams, instance_handle);
 }
 
+ReturnCode_t DataWriterImpl::write_shared(
+        const std::shared_ptr<const void>& data,
+        const InstanceHandle_t& handle)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // The sample is only read, both for serializing it and by the readers sharing it
+    void* sample = const_cast<void*>(data.get());
+    ReturnCode_t ret_code = check_new_change_preconditions(ALIVE, sample);
+    if (!ret_code)
+    {
+        return ret_code;
+    }
+
+    InstanceHandle_t instance_handle;
+    if (type_.get()->m_isGetKeyDefined)
+    {
+        bool is_key_protected = false;
+#if HAVE_SECURITY
+        is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+        type_.get()->getKey(sample, &instance_handle, is_key_protected);
+    }
+
+    if (handle.isDefined() && handle != instance_handle)
+    {
+        return ReturnCode_t::RETCODE_PRECONDITION_NOT_MET;
+    }
+    logInfo(DATA_WRITER, "Writing new shared data");
+    WriteParams wparams;
+    return perform_create_new_change(ALIVE, sample, wparams, instance_handle, data);
+}
+
 InstanceHandle_t DataWriterImpl::register_instance(
         void* key)
 {
@@ -665,36 +711,54 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         ChangeKind_t change_kind,
         void* data,
         WriteParams& wparams,
-        const InstanceHandle_t& handle)
+        const InstanceHandle_t& handle,
+        const std::shared_ptr<const void>& shared_sample)
 {
-    // Block lowlevel writer
     auto max_blocking_time = steady_clock::now() +
             microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
 
+    // Serialize before blocking the lowlevel writer, so large samples do not delay its events, its asynchronous
+    // sending and other threads writing on it. Data sharing pools are only used with the writer blocked.
+    PayloadInfo_t payload;
+    bool was_loaned = check_and_remove_loan(data, payload);
+    ReturnCode_t payload_ret = ReturnCode_t::RETCODE_OK;
+    if (!was_loaned)
+    {
+        payload_ret = is_data_sharing_compatible_ ? ReturnCode_t::RETCODE_OUT_OF_RESOURCES :
+                prepare_payload(change_kind, data, payload, max_blocking_time);
+        if (ReturnCode_t::RETCODE_ERROR == payload_ret)
+        {
+            return payload_ret;
+        }
+    }
+
+    // Block lowlevel writer
 #if HAVE_STRICT_REALTIME
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
     if (!lock.try_lock_until(max_blocking_time))
     {
+        if (was_loaned)
+        {
+            add_loan(data, payload);
+        }
+        else if (ReturnCode_t::RETCODE_OK == payload_ret)
+        {
+            return_payload_to_pool(payload);
+        }
         return ReturnCode_t::RETCODE_TIMEOUT;
     }
 #else
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
-    PayloadInfo_t payload;
-    bool was_loaned = check_and_remove_loan(data, payload);
-    if (!was_loaned)
+    if (!payload_ret)
     {
-        if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload, max_blocking_time))
-        {
-            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
-        }
-
-        if ((ALIVE == change_kind) && !type_->serialize(data, &payload.payload))
+        // Either a data sharing pool, or a pool exhausted by another thread of this writer which may have released
+        // a payload while the writer was being blocked
+        payload_ret = prepare_payload(change_kind, data, payload, max_blocking_time);
+        if (!payload_ret)
         {
-            logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false");
-            return_payload_to_pool(payload);
-            return ReturnCode_t::RETCODE_ERROR;
+            return payload_ret;
         }
     }
 
@@ -704,8 +768,24 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         payload.move_into_change(*ch);
         set_fragment_size_on_change(wparams, ch, high_mark_for_frag_);
 
+        // Intra-process readers may take the change while it is being added, so the sample is added before, with
+        // the sequence number the change will get unless another thread adds a change while this one waits
+        SequenceNumber_t expected_sequence_number = history_.next_sequence_number();
+        if (shared_sample)
+        {
+            if (!shared_samples_)
+            {
+                shared_samples_ = detail::SharedSampleTable::create(guid());
+            }
+            shared_samples_->add(expected_sequence_number, ch->serializedPayload.data, shared_sample);
+        }
+
         if (!this->history_.add_pub_change(ch, wparams, lock, max_blocking_time))
         {
+            if (shared_sample)
+            {
+                shared_samples_->remove(expected_sequence_number);
+            }
             if (was_loaned)
             {
                 payload.move_from_change(*ch);
@@ -715,6 +795,15 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             return ReturnCode_t::RETCODE_TIMEOUT;
         }
 
+        if (shared_sample)
+        {
+            if (ch->sequenceNumber != expected_sequence_number)
+            {
+                shared_samples_->update(expected_sequence_number, ch->sequenceNumber);
+            }
+            shared_samples_->remove_unused(history_);
+        }
+
         if (qos_.deadline().period != c_TimeInfinite)
         {
             if (!history_.set_next_deadline(
@@ -1437,6 +1526,69 @@ void DataWriterImpl::set_fragment_size_on_change(
     }
 }
 
+ReturnCode_t DataWriterImpl::prepare_payload(
+        ChangeKind_t change_kind,
+        void* data,
+        PayloadInfo_t& payload,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    // Reserve the size of the biggest recent sample and serialize in a single pass.
+    // The exact size is only computed for the first sample, for those which do not fit, and for non ALIVE changes.
+    bool size_estimated = false;
+    auto size_getter = [this, change_kind, data, &size_estimated]()
+            {
+                uint32_t estimate = (ALIVE == change_kind && type_->checks_serialization_bounds()) ?
+                        serialized_size_estimate_.get() : 0u;
+                size_estimated = 0u < estimate;
+                return size_estimated ? estimate : type_->getSerializedSizeProvider(data)();
+            };
+    if (!get_free_payload_from_pool(size_getter, payload, max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+    }
+
+    if (ALIVE == change_kind)
+    {
+        bool serialized = serialize_sample(data, payload.payload);
+        if (!serialized && size_estimated)
+        {
+            // The sample is bigger than the estimate
+            return_payload_to_pool(payload);
+            if (!get_free_payload_from_pool(type_->getSerializedSizeProvider(data), payload, max_blocking_time))
+            {
+                return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+            }
+            serialized = serialize_sample(data, payload.payload);
+        }
+
+        if (!serialized)
+        {
+            logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false");
+            return_payload_to_pool(payload);
+            return ReturnCode_t::RETCODE_ERROR;
+        }
+
+        serialized_size_estimate_.update(payload.payload.length);
+    }
+
+    return ReturnCode_t::RETCODE_OK;
+}
+
+bool DataWriterImpl::serialize_sample(
+        void* data,
+        SerializedPayload_t& payload)
+{
+    // Types not catching this exception would otherwise propagate it when the payload is too small
+    try
+    {
+        return type_->serialize(data, &payload);
+    }
+    catch (eprosima::fastcdr::exception::NotEnoughMemoryException&)
+    {
+        return false;
+    }
+}
+
 std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
 {
     if (!payload_pool_)
@@ -40,7 +40,10 @@
 
 #include <fastrtps/types/TypesBase.h>
 
+#include <fastdds/publisher/DataWriterImpl/SharedSampleTable.hpp>
+
 #include <rtps/common/PayloadInfo_t.hpp>
+#include <rtps/common/SerializedSizeEstimate.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 
@@ -159,6 +162,16 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write data with handle, sharing the sample with the intra-process readers.
+     * @param data Shared pointer to the data
+     * @param handle InstanceHandle_t.
+     * @return RETCODE_OK if the data is correctly sent
+     */
+    ReturnCode_t write_shared(
+            const std::shared_ptr<const void>& data,
+            const InstanceHandle_t& handle);
+
     /*!
      * @brief Implementation of the DDS `register_instance` operation.
      * It deduces the instance's key and tries to get resources in the PublisherHistory.
@@ -337,10 +350,16 @@ protected:
 
     uint32_t fixed_payload_size_ = 0u;
 
+    //! Size reserved for the payloads of ALIVE changes of types checking serialization bounds
+    fastrtps::rtps::detail::SerializedSizeEstimate serialized_size_estimate_;
+
     std::shared_ptr<IPayloadPool> payload_pool_;
 
     std::unique_ptr<LoanCollection> loans_;
 
+    //! Samples written with write_shared, created on the first one
+    std::shared_ptr<detail::SharedSampleTable> shared_samples_;
+
     /**
      *
      * @param kind
@@ -406,7 +425,8 @@ protected:
             fastrtps::rtps::ChangeKind_t change_kind,
             void* data,
             fastrtps::rtps::WriteParams& wparams,
-            const InstanceHandle_t& handle);
+            const InstanceHandle_t& handle,
+            const std::shared_ptr<const void>& shared_sample = nullptr);
 
     static fastrtps::TopicAttributes get_topic_attributes(
             const DataWriterQos& qos,
@@ -442,6 +462,26 @@ protected:
             fastrtps::rtps::CacheChange_t* ch,
             const uint32_t& high_mark_for_frag);
 
+    /**
+     * Get a payload from the pool and serialize a sample into it. Does not need the lowlevel writer to be blocked,
+     * except for data sharing pools.
+     * @return RETCODE_OK on success, RETCODE_OUT_OF_RESOURCES when no payload could be taken from the pool, and
+     * RETCODE_ERROR when the sample could not be serialized.
+     */
+    ReturnCode_t prepare_payload(
+            fastrtps::rtps::ChangeKind_t change_kind,
+            void* data,
+            PayloadInfo_t& payload,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    /**
+     * Serialize a sample into a payload.
+     * @return false if serialization failed, including when the payload was not big enough for the sample.
+     */
+    bool serialize_sample(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t& payload);
+
     std::shared_ptr<IPayloadPool> get_payload_pool();
 
     bool release_payload_pool();
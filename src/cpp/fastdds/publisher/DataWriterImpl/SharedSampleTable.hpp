@@ -0,0 +1,209 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedSampleTable.hpp
+ */
+
+#ifndef _FASTDDS_PUBLISHER_DATAWRITERIMPL_SHAREDSAMPLETABLE_HPP_
+#define _FASTDDS_PUBLISHER_DATAWRITERIMPL_SHAREDSAMPLETABLE_HPP_
+
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Samples written with DataWriter::write_shared, kept by their DataWriter while their changes are on its history.
+ *
+ * The table of each DataWriter is registered by its GUID, so only the DataReaders sharing samples look it up.
+ * A sample is identified by the sequence number of its change, and by the payload the change was serialized on,
+ * so it is only handed to the readers receiving that same payload through intra-process delivery.
+ */
+class SharedSampleTable
+{
+public:
+
+    using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using GUID_t = eprosima::fastrtps::rtps::GUID_t;
+    using SequenceNumber_t = eprosima::fastrtps::rtps::SequenceNumber_t;
+    using octet = eprosima::fastrtps::rtps::octet;
+
+    /**
+     * Create the table of a DataWriter. It is unregistered when the DataWriter releases it.
+     *
+     * @param writer  GUID of the DataWriter.
+     */
+    static std::shared_ptr<SharedSampleTable> create(
+            const GUID_t& writer)
+    {
+        std::shared_ptr<SharedSampleTable> table = std::make_shared<SharedSampleTable>();
+
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        // Remove the tables of deleted writers
+        for (auto it = registry.tables.begin(); it != registry.tables.end();)
+        {
+            it = it->second.expired() ? registry.tables.erase(it) : std::next(it);
+        }
+
+        registry.tables[writer] = table;
+        return table;
+    }
+
+    /**
+     * Find the table of a DataWriter.
+     *
+     * @param writer  GUID of the DataWriter.
+     * @return nullptr if the DataWriter never shared a sample, or has been deleted.
+     */
+    static std::shared_ptr<SharedSampleTable> find(
+            const GUID_t& writer)
+    {
+        Registry& registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto it = registry.tables.find(writer);
+        return (it != registry.tables.end()) ? it->second.lock() : nullptr;
+    }
+
+    /**
+     * Add the sample of a change not yet added to the history.
+     *
+     * @param sequence_number  Sequence number the change is expected to get.
+     * @param payload          Data of the payload of the change.
+     * @param sample           Sample the payload was serialized from.
+     */
+    void add(
+            const SequenceNumber_t& sequence_number,
+            const octet* payload,
+            const std::shared_ptr<const void>& sample)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_[sequence_number] = Entry{payload, sample};
+    }
+
+    /**
+     * Update the sequence number of a sample, when its change got a different one than expected.
+     */
+    void update(
+            const SequenceNumber_t& expected,
+            const SequenceNumber_t& sequence_number)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = samples_.find(expected);
+        if (it != samples_.end())
+        {
+            Entry entry = it->second;
+            samples_.erase(it);
+            samples_[sequence_number] = entry;
+        }
+    }
+
+    void remove(
+            const SequenceNumber_t& sequence_number)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_.erase(sequence_number);
+    }
+
+    /**
+     * Get the sample of a change received by a DataReader.
+     *
+     * @param change  Change on the history of the DataReader.
+     * @return nullptr if the change does not carry the payload the sample was serialized on.
+     */
+    std::shared_ptr<const void> get(
+            const CacheChange_t& change) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = samples_.find(change.sequenceNumber);
+        if (it != samples_.end() && it->second.payload == change.serializedPayload.data)
+        {
+            return it->second.sample;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Remove the samples whose changes are no longer on the history of the DataWriter.
+     * Removed changes are only detected here, so the table is kept to at most twice the changes on the history.
+     *
+     * @param history  History of the DataWriter, locked by the caller.
+     */
+    template<typename WriterHistory>
+    void remove_unused(
+            WriterHistory& history)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (samples_.size() <= 2 * history.getHistorySize())
+        {
+            return;
+        }
+
+        // Samples from the next sequence number on belong to changes still being added by other threads
+        SequenceNumber_t next = history.next_sequence_number();
+        auto change = history.changesBegin();
+        auto it = samples_.begin();
+        while (it != samples_.end() && it->first < next)
+        {
+            while (change != history.changesEnd() && (*change)->sequenceNumber < it->first)
+            {
+                ++change;
+            }
+            bool on_history = (change != history.changesEnd()) && ((*change)->sequenceNumber == it->first);
+            it = on_history ? std::next(it) : samples_.erase(it);
+        }
+    }
+
+private:
+
+    struct Entry
+    {
+        const octet* payload;
+        std::shared_ptr<const void> sample;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::map<GUID_t, std::weak_ptr<SharedSampleTable>> tables;
+    };
+
+    static Registry& get_registry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    mutable std::mutex mutex_;
+    std::map<SequenceNumber_t, Entry> samples_;
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_PUBLISHER_DATAWRITERIMPL_SHAREDSAMPLETABLE_HPP_
@@ -31,6 +31,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 
 #include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -46,6 +47,8 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <cstdlib>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
@@ -760,6 +763,12 @@ void DataReaderImpl::InnerDataReaderListener::onReaderMatched(
         RTPSReader* /*reader*/,
         const SubscriptionMatchedStatus& info)
 {
+    // A writer created again with the same GUID restarts its sequence numbers
+    if (info.current_count_change < 0 && data_reader_->sample_pool_)
+    {
+        data_reader_->sample_pool_->writer_unmatched(iHandle2GUID(info.last_publication_handle));
+    }
+
     DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::subscription_matched());
     if (listener != nullptr)
     {
@@ -1363,7 +1372,22 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
     if (!payload_pool_)
     {
         payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
-        sample_pool_ = std::make_shared<detail::SampleLoanManager>(config, type_);
+        const std::string* share_samples_property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+            qos_.properties(), "fastdds.intraprocess_shared_samples");
+        bool share_samples = (nullptr != share_samples_property) && ("true" == *share_samples_property);
+
+        // Readers of the participant with the same type may share the samples deserialized for loans
+        std::shared_ptr<detail::DeserializedSampleCache> sample_cache;
+        const std::string* sample_cache_property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+            qos_.properties(), "fastdds.deserialized_sample_cache");
+        if (nullptr != sample_cache_property)
+        {
+            size_t max_unused = static_cast<size_t>(std::strtoul(sample_cache_property->c_str(), nullptr, 10));
+            sample_cache = detail::DeserializedSampleCache::get(
+                subscriber_->get_participant()->guid().guidPrefix, type_, max_unused);
+        }
+
+        sample_pool_ = std::make_shared<detail::SampleLoanManager>(qos_, type_, share_samples, sample_cache);
     }
 
     payload_pool_->reserve_history(config, true);
@@ -0,0 +1,249 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeserializedSampleCache.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_DATAREADERIMPL_DESERIALIZEDSAMPLECACHE_HPP_
+#define _FASTDDS_SUBSCRIBER_DATAREADERIMPL_DESERIALIZEDSAMPLECACHE_HPP_
+
+#include <cassert>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/SampleIdentity.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Samples deserialized for loans, shared by the DataReaders of a participant with the same type.
+ *
+ * A sample is identified by the writer and sequence number of its change, so readers receiving the same change,
+ * and successive reads of the same change, deserialize it only once. Samples stay cached while loaned, and up to
+ * a maximum number of them are kept after all their loans have been returned, evicting the least recently used.
+ * The samples of a writer are removed when it is unmatched, as a writer created again with the same GUID restarts
+ * its sequence numbers.
+ */
+class DeserializedSampleCache
+{
+public:
+
+    using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using GUID_t = eprosima::fastrtps::rtps::GUID_t;
+    using GuidPrefix_t = eprosima::fastrtps::rtps::GuidPrefix_t;
+    using SampleIdentity = eprosima::fastrtps::rtps::SampleIdentity;
+
+    DeserializedSampleCache(
+            const TypeSupport& type,
+            size_t max_unused)
+        : type_(type)
+        , max_unused_(max_unused)
+    {
+    }
+
+    ~DeserializedSampleCache()
+    {
+        for (auto& entry : entries_)
+        {
+            type_->deleteData(entry.second.sample);
+        }
+        for (auto& entry : removed_)
+        {
+            type_->deleteData(entry.first);
+        }
+    }
+
+    /**
+     * Get the cache of a participant for a type, creating it if necessary.
+     *
+     * @param participant  Prefix of the participant GUID.
+     * @param type         Type of the samples.
+     * @param max_unused   Maximum number of samples kept when not loaned. Only used when the cache is created.
+     */
+    static std::shared_ptr<DeserializedSampleCache> get(
+            const GuidPrefix_t& participant,
+            const TypeSupport& type,
+            size_t max_unused)
+    {
+        static std::mutex registry_mutex;
+        static std::map<std::pair<GuidPrefix_t, std::string>, std::weak_ptr<DeserializedSampleCache>> registry;
+
+        std::lock_guard<std::mutex> lock(registry_mutex);
+
+        // Remove the caches of deleted readers
+        for (auto it = registry.begin(); it != registry.end();)
+        {
+            it = it->second.expired() ? registry.erase(it) : std::next(it);
+        }
+
+        std::weak_ptr<DeserializedSampleCache>& entry = registry[std::make_pair(participant, type.get_type_name())];
+        std::shared_ptr<DeserializedSampleCache> cache = entry.lock();
+        if (!cache)
+        {
+            cache = std::make_shared<DeserializedSampleCache>(type, max_unused);
+            entry = cache;
+        }
+        return cache;
+    }
+
+    /**
+     * Get the deserialized sample of a change, increasing its references.
+     *
+     * @param change  Change with a valid payload.
+     * @param sample  Deserialized sample, only valid until released.
+     * @return false if the payload could not be deserialized.
+     */
+    bool acquire(
+            CacheChange_t* change,
+            void*& sample)
+    {
+        SampleIdentity id;
+        id.writer_guid(change->writerGUID);
+        id.sequence_number(change->sequenceNumber);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = entries_.find(id);
+        if (it == entries_.end())
+        {
+            void* data = type_->createData();
+            if (!type_->deserialize(&change->serializedPayload, data))
+            {
+                type_->deleteData(data);
+                return false;
+            }
+            it = entries_.emplace(id, Entry{data, 0, unused_.end()}).first;
+        }
+        else if (0 == it->second.num_refs)
+        {
+            unused_.erase(it->second.unused_pos);
+            it->second.unused_pos = unused_.end();
+        }
+
+        it->second.num_refs += 1;
+        sample = it->second.sample;
+        return true;
+    }
+
+    /**
+     * Release a sample obtained with acquire.
+     *
+     * @param id      Identity of the change the sample was acquired for.
+     * @param sample  Sample returned by acquire.
+     */
+    void release(
+            const SampleIdentity& id,
+            void* sample)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = entries_.find(id);
+        if (it == entries_.end() || it->second.sample != sample)
+        {
+            // The writer was removed while the sample was loaned
+            auto removed = removed_.find(sample);
+            assert(removed != removed_.end());
+            removed->second -= 1;
+            if (0 == removed->second)
+            {
+                type_->deleteData(removed->first);
+                removed_.erase(removed);
+            }
+            return;
+        }
+
+        assert(it->second.num_refs > 0);
+
+        it->second.num_refs -= 1;
+        if (0 == it->second.num_refs)
+        {
+            it->second.unused_pos = unused_.insert(unused_.end(), id);
+            while (unused_.size() > max_unused_)
+            {
+                auto evicted = entries_.find(unused_.front());
+                type_->deleteData(evicted->second.sample);
+                entries_.erase(evicted);
+                unused_.pop_front();
+            }
+        }
+    }
+
+    /**
+     * Remove the samples of a writer. Those still loaned are deleted when released.
+     *
+     * @param writer  GUID of the writer.
+     */
+    void remove_writer(
+            const GUID_t& writer)
+    {
+        SampleIdentity first;
+        first.writer_guid(writer);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = entries_.lower_bound(first);
+        while (it != entries_.end() && it->first.writer_guid() == writer)
+        {
+            if (0 == it->second.num_refs)
+            {
+                unused_.erase(it->second.unused_pos);
+                type_->deleteData(it->second.sample);
+            }
+            else
+            {
+                removed_.emplace(it->second.sample, it->second.num_refs);
+            }
+            it = entries_.erase(it);
+        }
+    }
+
+private:
+
+    struct Entry
+    {
+        void* sample;
+        uint32_t num_refs;
+        //! Position on unused_, only valid when num_refs is 0
+        std::list<SampleIdentity>::iterator unused_pos;
+    };
+
+    std::mutex mutex_;
+    TypeSupport type_;
+    size_t max_unused_;
+    std::map<SampleIdentity, Entry> entries_;
+    //! Samples not loaned, from least to most recently used
+    std::list<SampleIdentity> unused_;
+    //! Samples of removed writers still loaned, with their references
+    std::map<void*, uint32_t> removed_;
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_SUBSCRIBER_DATAREADERIMPL_DESERIALIZEDSAMPLECACHE_HPP_
@@ -270,10 +270,10 @@ private:
         }
         else
         {
-            // loan
-            void* sample;
+            // loan. Loaned samples are read-only, but sequences only hold pointers to mutable elements
+            const void* sample;
             sample_pool_->get_loan(change, sample);
-            const_cast<void**>(data_values_.buffer())[current_slot_] = sample;
+            const_cast<void**>(data_values_.buffer())[current_slot_] = const_cast<void*>(sample);
         }
     }
 
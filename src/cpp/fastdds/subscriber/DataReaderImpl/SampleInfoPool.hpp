@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
+#include <memory>
 
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
@@ -40,14 +42,20 @@ struct SampleInfoPool
 {
     using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
 
+    /**
+     * The initial items of the sample_infos_allocation configuration are constructed together in advance, so
+     * loaning SampleInfo objects does not allocate unless more of them are loaned at once.
+     */
     explicit SampleInfoPool(
             const DataReaderQos& qos)
-        : free_items_(qos.reader_resource_limits().sample_infos_allocation)
+        : num_preallocated_(qos.reader_resource_limits().sample_infos_allocation.initial)
+        , preallocated_(new SampleInfo[num_preallocated_])
+        , free_items_(qos.reader_resource_limits().sample_infos_allocation)
         , used_items_(qos.reader_resource_limits().sample_infos_allocation)
     {
-        for (size_t n = 0; n < qos.reader_resource_limits().sample_infos_allocation.initial; ++n)
+        for (size_t n = 0; n < num_preallocated_; ++n)
         {
-            free_items_.push_back(new SampleInfo());
+            free_items_.push_back(&preallocated_[n]);
         }
     }
 
@@ -55,7 +63,10 @@ struct SampleInfoPool
     {
         for (SampleInfo* it : free_items_)
         {
-            delete it;
+            if (!is_preallocated(it))
+            {
+                delete it;
+            }
         }
     }
 
@@ -70,7 +81,12 @@ struct SampleInfoPool
 
         if (free_items_.empty())
         {
-            result = used_items_.push_back(new SampleInfo());
+            SampleInfo* item = new SampleInfo();
+            result = used_items_.push_back(item);
+            if (nullptr == result)
+            {
+                delete item;
+            }
         }
         else
         {
@@ -99,6 +115,15 @@ private:
 
     using collection_type = eprosima::fastrtps::ResourceLimitedVector<SampleInfo*>;
 
+    bool is_preallocated(
+            const SampleInfo* item) const
+    {
+        return std::less_equal<const SampleInfo*>()(preallocated_.get(), item) &&
+               std::less<const SampleInfo*>()(item, preallocated_.get() + num_preallocated_);
+    }
+
+    size_t num_preallocated_;
+    std::unique_ptr<SampleInfo[]> preallocated_;
     collection_type free_items_;
     collection_type used_items_;
 };
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
+#include <memory>
 
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
@@ -33,7 +35,8 @@
 #include <fastrtps/utils/collections/ResourceLimitedContainerConfig.hpp>
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 
-#include <rtps/history/PoolConfig.h>
+#include <fastdds/publisher/DataWriterImpl/SharedSampleTable.hpp>
+#include <fastdds/subscriber/DataReaderImpl/DeserializedSampleCache.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -43,21 +46,33 @@ namespace detail {
 struct SampleLoanManager
 {
     using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using GUID_t = eprosima::fastrtps::rtps::GUID_t;
     using IPayloadPool = eprosima::fastrtps::rtps::IPayloadPool;
-    using PoolConfig = eprosima::fastrtps::rtps::PoolConfig;
     using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
     using SampleIdentity = eprosima::fastrtps::rtps::SampleIdentity;
     using SerializedPayload_t = eprosima::fastrtps::rtps::SerializedPayload_t;
 
+    /**
+     * Loans are limited by the max_samples of the resource limits, and the samples of allocated_samples loans are
+     * constructed in advance, so taking with loans does not allocate unless more samples are loaned at once.
+     * With KEEP_LAST, no more samples are constructed in advance than the history can hold.
+     *
+     * @param qos            QoS of the DataReader.
+     * @param type           Type of the samples.
+     * @param share_samples  Whether to loan the samples shared by intra-process writers, instead of deserializing.
+     * @param sample_cache   Cache where samples are deserialized, instead of on samples owned by each loan.
+     */
     SampleLoanManager(
-            const PoolConfig& pool_config,
-            const TypeSupport& type)
-        : limits_(pool_config.initial_size,
-                pool_config.maximum_size ? pool_config.maximum_size : std::numeric_limits<size_t>::max(),
-                1)
+            const DataReaderQos& qos,
+            const TypeSupport& type,
+            bool share_samples = false,
+            std::shared_ptr<DeserializedSampleCache> sample_cache = nullptr)
+        : limits_(loan_limits(qos, type))
         , free_loans_(limits_)
         , used_loans_(limits_)
         , type_(type)
+        , share_samples_(share_samples)
+        , sample_cache_(std::move(sample_cache))
     {
         for (size_t n = 0; n < limits_.initial; ++n)
         {
@@ -87,16 +102,20 @@ struct SampleLoanManager
         return static_cast<int32_t>(used_loans_.size());
     }
 
+    /**
+     * Loan the sample of a change. Loaned samples are read-only, as they may be shared by other loans, or with the
+     * DataWriter that wrote them.
+     */
     void get_loan(
             CacheChange_t* change,
-            void*& sample)
+            const void*& sample)
     {
         // Early return an already loaned item
         OutstandingLoanItem* item = find_by_change(change);
         if (nullptr != item)
         {
             item->num_refs += 1;
-            sample = item->sample;
+            sample = item->loaned_sample();
             return;
         }
 
@@ -127,6 +146,32 @@ struct SampleLoanManager
 
         // Should be the first time we loan this item
         assert(item->num_refs == 0);
+        item->identity.writer_guid(change->writerGUID);
+        item->identity.sequence_number(change->sequenceNumber);
+
+        // Loan the sample written by an intra-process writer, which the loan keeps alive
+        if (share_samples_ && !type_->is_plain())
+        {
+            std::shared_ptr<SharedSampleTable> shared_samples = SharedSampleTable::find(change->writerGUID);
+            if (shared_samples)
+            {
+                item->shared_sample = shared_samples->get(*change);
+            }
+            if (item->shared_sample)
+            {
+                item->num_refs += 1;
+                sample = item->loaned_sample();
+                return;
+            }
+        }
+
+        // Loan the sample deserialized on the cache, which could already be there for another loan
+        if (sample_cache_ && !type_->is_plain() && sample_cache_->acquire(change, item->cached_sample))
+        {
+            item->num_refs += 1;
+            sample = item->loaned_sample();
+            return;
+        }
 
         // Increment references of input payload
         CacheChange_t tmp;
@@ -152,11 +197,11 @@ struct SampleLoanManager
 
         // Increment reference counter and return sample
         item->num_refs += 1;
-        sample = item->sample;
+        sample = item->loaned_sample();
     }
 
     void return_loan(
-            void* sample)
+            const void* sample)
     {
         OutstandingLoanItem* item = find_by_sample(sample);
         assert(nullptr != item);
@@ -164,12 +209,22 @@ struct SampleLoanManager
         item->num_refs -= 1;
         if (item->num_refs == 0)
         {
-            CacheChange_t tmp;
-            tmp.payload_owner(item->owner);
-            tmp.serializedPayload = item->payload;
-            item->owner->release_payload(tmp);
-            item->payload.data = nullptr;
-            item->owner = nullptr;
+            if (nullptr != item->owner)
+            {
+                CacheChange_t tmp;
+                tmp.payload_owner(item->owner);
+                tmp.serializedPayload = item->payload;
+                item->owner->release_payload(tmp);
+                item->payload.data = nullptr;
+                item->owner = nullptr;
+            }
+            item->shared_sample.reset();
+            if (nullptr != item->cached_sample)
+            {
+                sample_cache_->release(item->identity, item->cached_sample);
+                item->cached_sample = nullptr;
+            }
+            item->identity = SampleIdentity::unknown();
 
             item = free_loans_.push_back(*item);
             assert(nullptr != item);
@@ -177,6 +232,20 @@ struct SampleLoanManager
         }
     }
 
+    /**
+     * Forget the samples deserialized from a writer that has been unmatched.
+     *
+     * @param writer  GUID of the writer.
+     */
+    void writer_unmatched(
+            const GUID_t& writer)
+    {
+        if (sample_cache_)
+        {
+            sample_cache_->remove_writer(writer);
+        }
+    }
+
 private:
 
     struct OutstandingLoanItem
@@ -186,6 +255,10 @@ private:
         SerializedPayload_t payload;
         IPayloadPool* owner = nullptr;
         uint32_t num_refs = 0;
+        //! Sample shared by an intra-process writer, loaned instead of sample when set
+        std::shared_ptr<const void> shared_sample;
+        //! Sample on the deserialized sample cache, loaned instead of sample when set
+        void* cached_sample = nullptr;
 
         ~OutstandingLoanItem()
         {
@@ -208,14 +281,58 @@ private:
             return other.sample == sample && other.payload.data == payload.data;
         }
 
+        const void* loaned_sample() const
+        {
+            if (shared_sample)
+            {
+                return shared_sample.get();
+            }
+            return (nullptr != cached_sample) ? cached_sample : sample;
+        }
+
     };
 
     using collection_type = eprosima::fastrtps::ResourceLimitedVector<OutstandingLoanItem>;
 
+    static eprosima::fastrtps::ResourceLimitedContainerConfig loan_limits(
+            const DataReaderQos& qos,
+            const TypeSupport& type)
+    {
+        const ResourceLimitsQosPolicy& resource_limits = qos.resource_limits();
+
+        size_t maximum = std::numeric_limits<size_t>::max();
+        if (resource_limits.max_samples > 0)
+        {
+            maximum = static_cast<size_t>(resource_limits.max_samples);
+        }
+
+        size_t initial = 0;
+        if (resource_limits.allocated_samples > 0)
+        {
+            initial = std::min(static_cast<size_t>(resource_limits.allocated_samples), maximum);
+        }
+
+        // A single take cannot loan more samples than the history holds, so more loans are only needed when the
+        // application keeps loans across takes, and are constructed then
+        if (qos.history().kind == KEEP_LAST_HISTORY_QOS && qos.history().depth > 0)
+        {
+            // Unlimited instances do not bound the history
+            int32_t instances = type->m_isGetKeyDefined ? resource_limits.max_instances : 1;
+            if (instances > 0)
+            {
+                initial = std::min(initial, static_cast<size_t>(qos.history().depth) * static_cast<size_t>(instances));
+            }
+        }
+
+        return eprosima::fastrtps::ResourceLimitedContainerConfig(initial, maximum, 1u);
+    }
+
     eprosima::fastrtps::ResourceLimitedContainerConfig limits_;
     collection_type free_loans_;
     collection_type used_loans_;
     TypeSupport type_;
+    bool share_samples_;
+    std::shared_ptr<DeserializedSampleCache> sample_cache_;
 
     OutstandingLoanItem* find_by_change(
             CacheChange_t* change)
@@ -237,11 +354,11 @@ private:
     }
 
     OutstandingLoanItem* find_by_sample(
-            void* sample)
+            const void* sample)
     {
         auto comp = [sample](const OutstandingLoanItem& item)
                 {
-                    return sample == item.sample;
+                    return sample == item.loaned_sample();
                 };
         auto it = std::find_if(used_loans_.begin(), used_loans_.end(), comp);
         assert(it != used_loans_.end());
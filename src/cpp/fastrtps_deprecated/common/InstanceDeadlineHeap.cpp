@@ -0,0 +1,68 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceDeadlineHeap.cpp
+ *
+ */
+
+#include <fastrtps_deprecated/common/InstanceDeadlineHeap.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace eprosima {
+namespace fastrtps {
+
+namespace {
+
+//! Heaps of the histories, which only protect the collection itself
+struct HeapRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<const void*, std::unique_ptr<InstanceDeadlineHeap>> heaps;
+};
+
+HeapRegistry& registry()
+{
+    static HeapRegistry instance;
+    return instance;
+}
+
+} // namespace
+
+InstanceDeadlineHeap& InstanceDeadlineHeap::of(
+        const void* history)
+{
+    HeapRegistry& heaps = registry();
+    std::lock_guard<std::mutex> guard(heaps.mutex);
+    std::unique_ptr<InstanceDeadlineHeap>& heap = heaps.heaps[history];
+    if (!heap)
+    {
+        heap.reset(new InstanceDeadlineHeap());
+    }
+    return *heap;
+}
+
+void InstanceDeadlineHeap::release(
+        const void* history)
+{
+    HeapRegistry& heaps = registry();
+    std::lock_guard<std::mutex> guard(heaps.mutex);
+    heaps.heaps.erase(history);
+}
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -0,0 +1,229 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InstanceDeadlineHeap.hpp
+ *
+ */
+
+#ifndef _FASTRTPS_DEPRECATED_COMMON_INSTANCEDEADLINEHEAP_HPP_
+#define _FASTRTPS_DEPRECATED_COMMON_INSTANCEDEADLINEHEAP_HPP_
+
+#include <fastdds/rtps/common/InstanceHandle.h>
+#include <fastrtps/common/KeyedChanges.h>
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * @brief Min-heap of the instances of a history, ordered by their next deadline.
+ *
+ * Entries are the elements of the history's instance map, which must not be moved while they are in the heap.
+ * The heap keeps the position of each entry, so updating or removing an instance is O(log n) and getting the
+ * instance that will miss its deadline first is O(1).
+ * @ingroup FASTRTPS_MODULE
+ */
+class InstanceDeadlineHeap
+{
+public:
+
+    //! Element of the instance map of a history
+    using Entry = std::pair<const rtps::InstanceHandle_t, KeyedChanges>;
+
+    /**
+     * @brief Returns the heap of a keyed history, creating it the first time.
+     *
+     * The heaps are kept outside of the exported history classes, so their layout does not change.
+     * The heap returned is protected by the mutex of the history.
+     * @param history The history owning the heap
+     * @return The heap of the history
+     */
+    static InstanceDeadlineHeap& of(
+            const void* history);
+
+    /**
+     * @brief Destroys the heap of a history, if it was ever created
+     * @param history The history owning the heap
+     */
+    static void release(
+            const void* history);
+
+    /**
+     * @brief Adds a new instance to the heap
+     * @param entry The instance to add
+     */
+    void push(
+            Entry* entry)
+    {
+        positions_[entry] = heap_.size();
+        heap_.push_back(entry);
+        sift_up(heap_.size() - 1);
+    }
+
+    /**
+     * @brief Repositions an instance after its next deadline has changed
+     * @param entry The instance whose deadline has changed
+     */
+    void update(
+            Entry* entry)
+    {
+        auto position = positions_.find(entry);
+        if (position == positions_.end())
+        {
+            return;
+        }
+
+        reposition(position->second);
+    }
+
+    /**
+     * @brief Removes an instance from the heap
+     * @param entry The instance to remove
+     */
+    void erase(
+            Entry* entry)
+    {
+        auto position = positions_.find(entry);
+        if (position == positions_.end())
+        {
+            return;
+        }
+
+        size_t index = position->second;
+        size_t last = heap_.size() - 1;
+        positions_.erase(position);
+        if (index != last)
+        {
+            heap_[index] = heap_[last];
+            positions_[heap_[index]] = index;
+            heap_.pop_back();
+            reposition(index);
+        }
+        else
+        {
+            heap_.pop_back();
+        }
+    }
+
+    /**
+     * @brief Returns the instance that will miss its deadline first
+     * @return The instance with the earliest deadline, nullptr if the heap is empty
+     */
+    Entry* top() const
+    {
+        return heap_.empty() ? nullptr : heap_.front();
+    }
+
+    bool empty() const
+    {
+        return heap_.empty();
+    }
+
+    size_t size() const
+    {
+        return heap_.size();
+    }
+
+    void clear()
+    {
+        heap_.clear();
+        positions_.clear();
+    }
+
+private:
+
+    bool less(
+            size_t lhs,
+            size_t rhs) const
+    {
+        return heap_[lhs]->second.next_deadline_us < heap_[rhs]->second.next_deadline_us;
+    }
+
+    void swap(
+            size_t lhs,
+            size_t rhs)
+    {
+        std::swap(heap_[lhs], heap_[rhs]);
+        positions_[heap_[lhs]] = lhs;
+        positions_[heap_[rhs]] = rhs;
+    }
+
+    void reposition(
+            size_t index)
+    {
+        if (index > 0 && less(index, (index - 1) / 2))
+        {
+            sift_up(index);
+        }
+        else
+        {
+            sift_down(index);
+        }
+    }
+
+    void sift_up(
+            size_t index)
+    {
+        while (index > 0)
+        {
+            size_t parent = (index - 1) / 2;
+            if (!less(index, parent))
+            {
+                break;
+            }
+            swap(index, parent);
+            index = parent;
+        }
+    }
+
+    void sift_down(
+            size_t index)
+    {
+        size_t size = heap_.size();
+        while (true)
+        {
+            size_t smallest = index;
+            size_t left = 2 * index + 1;
+            size_t right = left + 1;
+            if (left < size && less(left, smallest))
+            {
+                smallest = left;
+            }
+            if (right < size && less(right, smallest))
+            {
+                smallest = right;
+            }
+            if (smallest == index)
+            {
+                break;
+            }
+            swap(index, smallest);
+            index = smallest;
+        }
+    }
+
+    std::vector<Entry*> heap_;
+
+    //! Position of each entry on heap_
+    std::unordered_map<const Entry*, size_t> positions_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif /* _FASTRTPS_DEPRECATED_COMMON_INSTANCEDEADLINEHEAP_HPP_ */
@@ -23,6 +23,7 @@
 #include <fastrtps/publisher/PublisherHistory.h>
 
 #include <fastrtps_deprecated/publisher/PublisherImpl.h>
+#include <fastrtps_deprecated/common/InstanceDeadlineHeap.hpp>
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
 
@@ -81,6 +82,7 @@ PublisherHistory::PublisherHistory(
 
 PublisherHistory::~PublisherHistory()
 {
+    InstanceDeadlineHeap::release(this);
 }
 
 void PublisherHistory::rebuild_instances()
@@ -246,6 +248,7 @@ bool PublisherHistory::find_or_add_key(
     if (static_cast<int>(keyed_changes_.size()) < resource_limited_qos_.max_instances)
     {
         *vit_out = keyed_changes_.insert(std::make_pair(instance_handle, KeyedChanges())).first;
+        InstanceDeadlineHeap::of(this).push(&**vit_out);
         return true;
     }
 
@@ -387,6 +390,7 @@ bool PublisherHistory::remove_instance_changes(
 
     if (vit->second.cache_changes.empty())
     {
+        InstanceDeadlineHeap::of(this).erase(&*vit);
         keyed_changes_.erase(vit);
     }
 
@@ -411,12 +415,14 @@ bool PublisherHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
+        InstanceDeadlineHeap::of(this).update(&*vit);
         return true;
     }
 
@@ -436,15 +442,11 @@ bool PublisherHistory::get_next_deadline(
 
     if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
+        InstanceDeadlineHeap::Entry* min = InstanceDeadlineHeap::of(this).top();
+        if (min == nullptr)
+        {
+            return false;
+        }
 
         handle = min->first;
         next_deadline_us = min->second.next_deadline_us;
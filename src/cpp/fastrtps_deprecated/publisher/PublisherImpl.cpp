@@ -40,6 +40,8 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+
 using namespace eprosima::fastrtps;
 using namespace ::rtps;
 using namespace std::chrono;
@@ -173,18 +175,44 @@ bool PublisherImpl::create_new_change_with_params(
     std::unique_lock<RecursiveTimedMutex> lock(mp_writer->getMutex());
 #endif // if HAVE_STRICT_REALTIME
     {
-        CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+        // Reserve the size of the biggest recent sample and serialize in a single pass.
+        // The exact size is only computed for the first sample, for those which do not fit, and for non ALIVE
+        // changes.
+        bool size_estimated = false;
+        const std::function<uint32_t()> size_getter = [this, changeKind, data, &size_estimated]()
+                {
+                    uint32_t estimate = (ALIVE == changeKind && mp_type->checks_serialization_bounds()) ?
+                            serialized_size_estimate_.get() : 0u;
+                    size_estimated = 0u < estimate;
+                    return size_estimated ? estimate : mp_type->getSerializedSizeProvider(data)();
+                };
+        CacheChange_t* ch = mp_writer->new_change(size_getter, changeKind, handle);
         if (ch != nullptr)
         {
             if (changeKind == ALIVE)
             {
+                bool serialized = serialize_sample(data, ch->serializedPayload);
+                if (!serialized && size_estimated)
+                {
+                    // The sample is bigger than the estimate
+                    mp_writer->release_change(ch);
+                    ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+                    if (ch == nullptr)
+                    {
+                        return false;
+                    }
+                    serialized = serialize_sample(data, ch->serializedPayload);
+                }
+
                 //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
-                if (!mp_type->serialize(data, &ch->serializedPayload))
+                if (!serialized)
                 {
                     logWarning(RTPS_WRITER, "RTPSWriter:Serialization returns false"; );
                     mp_writer->release_change(ch);
                     return false;
                 }
+
+                serialized_size_estimate_.update(ch->serializedPayload.length);
             }
 
             //TODO(Ricardo) This logic in a class. Then a user of rtps layer can use it.
@@ -627,6 +655,21 @@ bool PublisherImpl::lifespan_expired()
     return false;
 }
 
+bool PublisherImpl::serialize_sample(
+        void* data,
+        SerializedPayload_t& payload)
+{
+    // Types not catching this exception would otherwise propagate it when the payload is too small
+    try
+    {
+        return mp_type->serialize(data, &payload);
+    }
+    catch (eprosima::fastcdr::exception::NotEnoughMemoryException&)
+    {
+        return false;
+    }
+}
+
 void PublisherImpl::get_liveliness_lost_status(
         LivelinessLostStatus& status)
 {
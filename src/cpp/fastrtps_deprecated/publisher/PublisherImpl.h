@@ -34,6 +34,7 @@
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
 
+#include <rtps/common/SerializedSizeEstimate.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
 namespace eprosima {
@@ -244,6 +245,9 @@ private:
 
     uint32_t high_mark_for_frag_;
 
+    //! Size reserved for the payloads of ALIVE changes of types checking serialization bounds
+    rtps::detail::SerializedSizeEstimate serialized_size_estimate_;
+
     //! A timer used to check for deadlines
     rtps::TimedEvent* deadline_timer_;
     //! Deadline duration in microseconds
@@ -276,6 +280,14 @@ private:
      * @return true value when the event has to be rescheduled. false value if not.
      */
     bool lifespan_expired();
+
+    /**
+     * @brief Serializes a sample into a payload
+     * @return false if serialization failed, including when the payload was not big enough for the sample
+     */
+    bool serialize_sample(
+            void* data,
+            rtps::SerializedPayload_t& payload);
 };
 
 
@@ -19,6 +19,7 @@
 
 #include <fastrtps/subscriber/SubscriberHistory.h>
 #include <fastrtps_deprecated/subscriber/SubscriberImpl.h>
+#include <fastrtps_deprecated/common/InstanceDeadlineHeap.hpp>
 
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <rtps/reader/WriterProxy.h>
@@ -126,6 +127,8 @@ SubscriberHistory::SubscriberHistory(
 
 SubscriberHistory::~SubscriberHistory()
 {
+    InstanceDeadlineHeap::release(this);
+
     if (type_->m_isGetKeyDefined)
     {
         type_->deleteData(get_key_object_);
@@ -453,6 +456,7 @@ bool SubscriberHistory::find_key(
     if (keyed_changes_.size() < static_cast<size_t>(resource_limited_qos_.max_instances))
     {
         *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+        InstanceDeadlineHeap::of(this).push(&**vit_out);
         return true;
     }
     else
@@ -461,8 +465,11 @@ bool SubscriberHistory::find_key(
         {
             if (vit->second.cache_changes.size() == 0)
             {
+                InstanceDeadlineHeap& deadline_heap = InstanceDeadlineHeap::of(this);
+                deadline_heap.erase(&*vit);
                 keyed_changes_.erase(vit);
                 *vit_out = keyed_changes_.insert(std::make_pair(a_change->instanceHandle, KeyedChanges())).first;
+                deadline_heap.push(&**vit_out);
                 return true;
             }
         }
@@ -582,12 +589,14 @@ bool SubscriberHistory::set_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        if (keyed_changes_.find(handle) == keyed_changes_.end())
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        if (vit == keyed_changes_.end())
         {
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        vit->second.next_deadline_us = next_deadline_us;
+        InstanceDeadlineHeap::of(this).update(&*vit);
         return true;
     }
 
@@ -612,14 +621,12 @@ bool SubscriberHistory::get_next_deadline(
     }
     else if (topic_att_.getTopicKind() == WITH_KEY)
     {
-        auto min = std::min_element(keyed_changes_.begin(),
-                        keyed_changes_.end(),
-                        [](
-                            const std::pair<InstanceHandle_t, KeyedChanges>& lhs,
-                            const std::pair<InstanceHandle_t, KeyedChanges>& rhs)
-                        {
-                            return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-                        });
+        InstanceDeadlineHeap::Entry* min = InstanceDeadlineHeap::of(this).top();
+        if (min == nullptr)
+        {
+            return false;
+        }
+
         handle = min->first;
         next_deadline_us = min->second.next_deadline_us;
         return true;
@@ -39,6 +39,7 @@
 #include <fastrtps/utils/IPFinder.h>
 
 #include <algorithm>
+#include <mutex>
 
 using namespace eprosima::fastrtps;
 
@@ -46,6 +47,92 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+namespace {
+
+//! Serializes the deferred creation of the WLP and the TypeLookupManager, which happens once per participant.
+std::mutex& lazy_creation_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/**
+ * Match the endpoints of a builtin protocol created after the participant with the participants discovered.
+ * The PDP mutex should be locked by the caller.
+ */
+template<typename Functor>
+void assign_discovered_participants(
+        PDP* pdp,
+        const GUID_t& local_guid,
+        Functor assign)
+{
+    // Participants discovered while the endpoints were created could be matched twice, which has no effect
+    for (auto it = pdp->ParticipantProxiesBegin(); it != pdp->ParticipantProxiesEnd(); ++it)
+    {
+        if ((*it)->m_guid != local_guid)
+        {
+            assign(**it);
+        }
+    }
+}
+
+/**
+ * Create the WLP when it is used and was not created yet, matching it with the participants already discovered.
+ */
+void create_wlp(
+        BuiltinProtocols& builtin)
+{
+    std::lock_guard<std::mutex> guard(lazy_creation_mutex());
+    RTPSParticipantImpl* participant = builtin.mp_participantImpl;
+    if (!builtin.m_att.use_WriterLivelinessProtocol || participant->wlp() != nullptr)
+    {
+        return;
+    }
+
+    WLP* wlp = new WLP(&builtin);
+    wlp->initWL(participant);
+
+    // The public pointer is written under the PDP mutex, while the library reads the one on the participant
+    std::lock_guard<std::recursive_mutex> pdp_guard(*builtin.mp_PDP->getMutex());
+    builtin.mp_WLP = wlp;
+    participant->set_wlp(wlp);
+    assign_discovered_participants(builtin.mp_PDP, participant->getGuid(), [wlp](const ParticipantProxyData& pdata)
+            {
+                wlp->assignRemoteEndpoints(pdata);
+            });
+}
+
+/**
+ * Create the TypeLookupManager when it is used and was not created yet, matching it with the participants already
+ * discovered.
+ */
+void create_typelookup_manager(
+        BuiltinProtocols& builtin)
+{
+    std::lock_guard<std::mutex> guard(lazy_creation_mutex());
+    RTPSParticipantImpl* participant = builtin.mp_participantImpl;
+    if (!(builtin.m_att.typelookup_config.use_client || builtin.m_att.typelookup_config.use_server) ||
+            participant->existing_typelookup_manager() != nullptr)
+    {
+        return;
+    }
+
+    fastdds::dds::builtin::TypeLookupManager* tlm = new fastdds::dds::builtin::TypeLookupManager(&builtin);
+    tlm->init_typelookup_service(participant);
+
+    // The public pointer is written under the PDP mutex, while the library reads the one on the participant
+    std::lock_guard<std::recursive_mutex> pdp_guard(*builtin.mp_PDP->getMutex());
+    builtin.tlm_ = tlm;
+    participant->set_typelookup_manager(tlm);
+    assign_discovered_participants(builtin.mp_PDP, participant->getGuid(),
+            [tlm](const ParticipantProxyData& pdata)
+            {
+                tlm->assign_remote_endpoints(pdata);
+            });
+}
+
+} // namespace
+
 
 BuiltinProtocols::BuiltinProtocols()
     : mp_participantImpl(nullptr)
@@ -63,6 +150,12 @@ BuiltinProtocols::~BuiltinProtocols()
         mp_PDP->announceParticipantState(true, true);
     }
 
+    if (mp_participantImpl != nullptr)
+    {
+        mp_participantImpl->set_wlp(nullptr);
+        mp_participantImpl->set_typelookup_manager(nullptr);
+    }
+
     // TODO Auto-generated destructor stub
     delete mp_WLP;
     delete tlm_;
@@ -125,18 +218,17 @@ bool BuiltinProtocols::initBuiltinProtocols(
         return false;
     }
 
-    // WLP
-    if (m_att.use_WriterLivelinessProtocol)
+    // WLP and TypeLookupManager. Their endpoints are announced from the start, so when their creation is deferred
+    // remote participants match them as usual, and the messages sent to them are ignored until they are created.
+    // The TypeLookup server must answer remote requests, so it is always created with the participant.
+    if (!m_att.lazy_builtin_endpoints)
     {
-        mp_WLP = new WLP(this);
-        mp_WLP->initWL(mp_participantImpl);
+        create_wlp(*this);
     }
 
-    // TypeLookupManager
-    if (m_att.typelookup_config.use_client || m_att.typelookup_config.use_server)
+    if (!m_att.lazy_builtin_endpoints || m_att.typelookup_config.use_server)
     {
-        tlm_ = new fastdds::dds::builtin::TypeLookupManager(this);
-        tlm_->init_typelookup_service(mp_participantImpl);
+        create_typelookup_manager(*this);
     }
 
     mp_PDP->announceParticipantState(true);
@@ -146,6 +238,20 @@ bool BuiltinProtocols::initBuiltinProtocols(
     return true;
 }
 
+fastdds::dds::builtin::TypeLookupManager* BuiltinProtocols::typelookup_manager()
+{
+    if (mp_PDP == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (mp_participantImpl->existing_typelookup_manager() == nullptr)
+    {
+        create_typelookup_manager(*this);
+    }
+    return mp_participantImpl->existing_typelookup_manager();
+}
+
 bool BuiltinProtocols::updateMetatrafficLocators(
         LocatorList_t& loclist)
 {
@@ -177,15 +283,17 @@ bool BuiltinProtocols::addLocalWriter(
     bool ok = false;
     if (mp_PDP != nullptr)
     {
+        create_wlp(*this);
         ok |= mp_PDP->getEDP()->newLocalWriterProxyData(w, topicAtt, wqos);
     }
     else
     {
         logWarning(RTPS_EDP, "EDP is not used in this Participant, register a Writer is impossible");
     }
-    if (mp_WLP != nullptr)
+    WLP* wlp = mp_participantImpl->wlp();
+    if (wlp != nullptr)
     {
-        ok |= mp_WLP->add_local_writer(w, wqos);
+        ok |= wlp->add_local_writer(w, wqos);
     }
     else
     {
@@ -202,15 +310,17 @@ bool BuiltinProtocols::addLocalReader(
     bool ok = false;
     if (mp_PDP != nullptr)
     {
+        create_wlp(*this);
         ok |= mp_PDP->getEDP()->newLocalReaderProxyData(R, topicAtt, rqos);
     }
     else
     {
         logWarning(RTPS_EDP, "EDP is not used in this Participant, register a Reader is impossible");
     }
-    if (mp_WLP != nullptr)
+    WLP* wlp = mp_participantImpl->wlp();
+    if (wlp != nullptr)
     {
-        ok |= mp_WLP->add_local_reader(R, rqos);
+        ok |= wlp->add_local_reader(R, rqos);
     }
     return ok;
 }
@@ -245,9 +355,10 @@ bool BuiltinProtocols::removeLocalWriter(
         RTPSWriter* W)
 {
     bool ok = false;
-    if (mp_WLP != nullptr)
+    WLP* wlp = mp_participantImpl->wlp();
+    if (wlp != nullptr)
     {
-        ok |= mp_WLP->remove_local_writer(W);
+        ok |= wlp->remove_local_writer(W);
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
@@ -260,9 +371,10 @@ bool BuiltinProtocols::removeLocalReader(
         RTPSReader* R)
 {
     bool ok = false;
-    if (mp_WLP != nullptr)
+    WLP* wlp = mp_participantImpl->wlp();
+    if (wlp != nullptr)
     {
-        ok |= mp_WLP->remove_local_reader(R);
+        ok |= wlp->remove_local_reader(R);
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
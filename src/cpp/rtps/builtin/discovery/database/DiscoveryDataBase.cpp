@@ -96,6 +96,7 @@ std::vector<fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::clear()
 
     /* Clear list of dirty topics */
     dirty_topics_.clear();
+    dirty_topic_endpoints_.clear();
 
     /* Clear disposals list */
     disposals_.clear();
@@ -312,10 +313,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        append_backup_queue_record(backup_file_, backup_buffer_, *change);
     }
 
     if (!enabled_)
@@ -344,10 +342,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        append_backup_queue_record(backup_file_, backup_buffer_, *change);
     }
 
     if (!enabled_)
@@ -368,11 +363,12 @@ bool DiscoveryDataBase::update(
     return true;
 }
 
-const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::changes_to_dispose()
+void DiscoveryDataBase::take_changes_to_dispose(
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes)
 {
-    // lock(sharing mode) mutex locally
+    // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
-    return disposals_;
+    disposals_.take(changes);
 }
 
 void DiscoveryDataBase::clear_changes_to_dispose()
@@ -384,11 +380,12 @@ void DiscoveryDataBase::clear_changes_to_dispose()
 
 ////////////
 // Functions to process_to_send_lists()
-const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::pdp_to_send()
+void DiscoveryDataBase::take_pdp_to_send(
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes)
 {
-    // lock(sharing mode) mutex locally
+    // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
-    return pdp_to_send_;
+    pdp_to_send_.take(changes);
 }
 
 void DiscoveryDataBase::clear_pdp_to_send()
@@ -398,11 +395,12 @@ void DiscoveryDataBase::clear_pdp_to_send()
     pdp_to_send_.clear();
 }
 
-const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_publications_to_send()
+void DiscoveryDataBase::take_edp_publications_to_send(
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes)
 {
-    // lock(sharing mode) mutex locally
+    // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
-    return edp_publications_to_send_;
+    edp_publications_to_send_.take(changes);
 }
 
 void DiscoveryDataBase::clear_edp_publications_to_send()
@@ -412,11 +410,12 @@ void DiscoveryDataBase::clear_edp_publications_to_send()
     edp_publications_to_send_.clear();
 }
 
-const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_subscriptions_to_send()
+void DiscoveryDataBase::take_edp_subscriptions_to_send(
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes)
 {
-    // lock(sharing mode) mutex locally
+    // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
-    return edp_subscriptions_to_send_;
+    edp_subscriptions_to_send_.take(changes);
 }
 
 void DiscoveryDataBase::clear_edp_subscriptions_to_send()
@@ -814,7 +813,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             }
         }
         // Update set of dirty_topics
-        set_dirty_topic_(topic_name);
+        set_dirty_topic_(topic_name, writer_guid);
     }
 }
 
@@ -931,7 +930,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             }
         }
         // Update set of dirty_topics
-        set_dirty_topic_(topic_name);
+        set_dirty_topic_(topic_name, reader_guid);
     }
 }
 
@@ -1087,37 +1086,40 @@ void DiscoveryDataBase::match_writer_reader_(
 }
 
 bool DiscoveryDataBase::set_dirty_topic_(
-        std::string topic)
+        std::string topic,
+        const eprosima::fastrtps::rtps::GUID_t& endpoint)
 {
     logInfo(DISCOVERY_DATABASE, "Setting topic " << topic << " as dirty");
 
     // If topic is virtual, we need to set as dirty all the other (non-virtual) topics
     if (topic == virtual_topic_)
     {
-        // Set all topics to dirty
-        dirty_topics_.clear();
-
+        // Set all topics to dirty with all their endpoints pending. Topics that are already dirty keep their
+        // position in the queue.
         // It is enough to use writers_by_topic because the topics are simetrical in writers and readers:
         //  if a topic exists in one, it exists in the other
-        for (auto topic_it : writers_by_topic_)
+        for (const auto& topic_it : writers_by_topic_)
         {
             if (topic_it.first != virtual_topic_)
             {
                 dirty_topics_.push_back(topic_it.first);
+                dirty_topic_endpoints_.erase(topic_it.first);
             }
         }
         return true;
     }
-    else
+
+    if (dirty_topics_.push_back(topic))
     {
-        if (std::find(
-                    dirty_topics_.begin(),
-                    dirty_topics_.end(),
-                    topic) == dirty_topics_.end())
-        {
-            dirty_topics_.push_back(topic);
-            return true;
-        }
+        dirty_topic_endpoints_[topic].insert(endpoint);
+        return true;
+    }
+
+    // A topic already dirty without an entry has all its endpoints pending
+    auto pending_it = dirty_topic_endpoints_.find(topic);
+    if (pending_it != dirty_topic_endpoints_.end())
+    {
+        pending_it->second.insert(endpoint);
     }
     return false;
 }
@@ -1186,10 +1188,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     unmatch_participant_(participant_guid.guidPrefix);
 
     // Add entry to disposals_
-    if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-    {
-        disposals_.push_back(ch);
-    }
+    disposals_.push_back(ch);
 }
 
 void DiscoveryDataBase::process_dispose_writer_(
@@ -1210,10 +1209,7 @@ void DiscoveryDataBase::process_dispose_writer_(
         // Add entry to disposals_
         if (wit->second.topic() != virtual_topic_)
         {
-            if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-            {
-                disposals_.push_back(ch);
-            }
+            disposals_.push_back(ch);
         }
 
         // Any change in the entities known must be reported as a change in the discovery
@@ -1240,10 +1236,7 @@ void DiscoveryDataBase::process_dispose_reader_(
         // Add entry to disposals_
         if (rit->second.topic() != virtual_topic_)
         {
-            if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
-            {
-                disposals_.push_back(ch);
-            }
+            disposals_.push_back(ch);
         }
 
         // Any change in the entities known must be reported as a change in the discovery
@@ -1263,135 +1256,169 @@ bool DiscoveryDataBase::process_dirty_topics()
     // Get shared lock
     std::unique_lock<std::recursive_mutex> lock(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
+    // Iterate over dirty_topics_. Topics that are clean after being processed are removed all at once.
+    dirty_topics_.remove_if([this](const std::string& topic)
+            {
+                return process_dirty_topic_(topic);
+            });
+
+    // Return whether there still are dirty topics
+    logInfo(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
+
+    return !dirty_topics_.empty();
+}
+
+bool DiscoveryDataBase::process_dirty_topic_(
+        const std::string& topic)
+{
+    // Empty list used for topics without writers or readers, so the lists in the database are not copied
+    static const std::vector<fastrtps::rtps::GUID_t> no_endpoints;
+
+    logInfo(DISCOVERY_DATABASE, "Processing topic: " << topic);
 
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+    // Get all the writers in the topic
+    auto ret = writers_by_topic_.find(topic);
+    const std::vector<fastrtps::rtps::GUID_t>& writers =
+            (ret != writers_by_topic_.end()) ? ret->second : no_endpoints;
+    // Get all the readers in the topic
+    ret = readers_by_topic_.find(topic);
+    const std::vector<fastrtps::rtps::GUID_t>& readers =
+            (ret != readers_by_topic_.end()) ? ret->second : no_endpoints;
+
+    // When every endpoint of the topic is pending, processing every writer covers all the pairs
+    auto pending_it = dirty_topic_endpoints_.find(topic);
+    if (pending_it == dirty_topic_endpoints_.end())
     {
-        logInfo(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
+        pending_it = dirty_topic_endpoints_.emplace(topic, std::set<fastrtps::rtps::GUID_t>(
+                            writers.begin(), writers.end())).first;
+    }
+    std::set<fastrtps::rtps::GUID_t>& pending = pending_it->second;
 
-        // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
+    // Only the pairs with a pending endpoint are processed, as the others were already clean
+    for (auto endpoint_it = pending.begin(); endpoint_it != pending.end();)
+    {
+        const fastrtps::rtps::GUID_t& endpoint = *endpoint_it;
+        bool is_clean = true;
+
+        if (is_writer(endpoint))
         {
-            writers = ret->second;
+            // Endpoints removed from the database are not processed any more
+            if (writers_.find(endpoint) != writers_.end())
+            {
+                logInfo(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing writer: " << endpoint);
+                for (const fastrtps::rtps::GUID_t& reader : readers)
+                {
+                    is_clean &= process_dirty_match_(topic, endpoint, reader);
+                }
+            }
         }
-        // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        else if (readers_.find(endpoint) != readers_.end())
         {
-            readers = ret->second;
+            logInfo(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing reader: " << endpoint);
+            for (const fastrtps::rtps::GUID_t& writer : writers)
+            {
+                is_clean &= process_dirty_match_(topic, writer, endpoint);
+            }
         }
 
-        for (fastrtps::rtps::GUID_t writer: writers)
-        // Iterate over writers in the topic:
+        endpoint_it = is_clean ? pending.erase(endpoint_it) : std::next(endpoint_it);
+    }
+
+    // Check whether the topic is still dirty or it can be cleared
+    bool is_clearable = pending.empty();
+    if (is_clearable)
+    {
+        dirty_topic_endpoints_.erase(pending_it);
+        logInfo(DISCOVERY_DATABASE, "Topic " << topic << " has been cleaned");
+    }
+    else
+    {
+        logInfo(DISCOVERY_DATABASE, "Topic " << topic << " is still dirty");
+    }
+    return is_clearable;
+}
+
+bool DiscoveryDataBase::process_dirty_match_(
+        const std::string& topic,
+        const eprosima::fastrtps::rtps::GUID_t& writer,
+        const eprosima::fastrtps::rtps::GUID_t& reader)
+{
+    (void)topic;
+    logInfo(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing writer " << writer << " and reader " << reader);
+
+    // Flag to store whether the pair can be cleared.
+    bool is_clearable = true;
+
+    auto parts_reader_it = participants_.find(reader.guidPrefix);
+    auto parts_writer_it = participants_.find(writer.guidPrefix);
+
+    // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+    // with the writer.
+    if (parts_reader_it != participants_.end())
+    {
+        if (parts_reader_it->second.is_matched(writer.guidPrefix))
         {
-            logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastrtps::rtps::GUID_t reader : readers)
+            // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+            auto readers_it = readers_.find(reader);
+            if (readers_it != readers_.end() &&
+                    readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                    !readers_it->second.is_matched(writer.guidPrefix))
             {
-                logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
-
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
+                // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
+                if (add_edp_subscriptions_to_send_(readers_it->second.change()))
                 {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
-                    {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
-                {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
+                    logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
+                            << readers_it->second.change()->instanceHandle);
                 }
             }
         }
+        else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+        {
+            // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+            if (add_pdp_to_send_(parts_reader_it->second.change()))
+            {
+                logInfo(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
+                        << parts_reader_it->second.change()->instanceHandle);
+            }
+            // Set pair as not-clearable.
+            is_clearable = false;
+        }
+    }
 
-        // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+    // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+    // with the reader.
+    if (parts_writer_it != participants_.end())
+    {
+        if (parts_writer_it->second.is_matched(reader.guidPrefix))
         {
-            // Delete topic from dirty_topics_
-            logInfo(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
-            topic_it = dirty_topics_.erase(topic_it);
+            // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+            auto writers_it = writers_.find(writer);
+            if (writers_it != writers_.end() &&
+                    writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                    !writers_it->second.is_matched(reader.guidPrefix))
+            {
+                // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
+                if (add_edp_publications_to_send_(writers_it->second.change()))
+                {
+                    logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
+                            << writers_it->second.change()->instanceHandle);
+                }
+            }
         }
-        else
+        else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
         {
-            // Proceed with next topic
-            logInfo(DISCOVERY_DATABASE, "Topic " << *topic_it << " is still dirty");
-            ++topic_it;
+            // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+            if (add_pdp_to_send_(parts_writer_it->second.change()))
+            {
+                logInfo(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
+                        << parts_writer_it->second.change()->instanceHandle);
+            }
+            // Set pair as not-clearable.
+            is_clearable = false;
         }
     }
 
-    // Return whether there still are dirty topics
-    logInfo(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
-
-    return !dirty_topics_.empty();
+    return is_clearable;
 }
 
 bool DiscoveryDataBase::delete_entity_of_change(
@@ -2204,14 +2231,10 @@ bool DiscoveryDataBase::add_pdp_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(p) to send in next iteration if it is not already there
-    if (std::find(
-                pdp_to_send_.begin(),
-                pdp_to_send_.end(),
-                change) == pdp_to_send_.end())
+    if (pdp_to_send_.push_back(change))
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(p) to send: "
                 << change->instanceHandle);
-        pdp_to_send_.push_back(change);
         return true;
     }
     return false;
@@ -2221,14 +2244,10 @@ bool DiscoveryDataBase::add_edp_publications_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(w) to send in next iteration if it is not already there
-    if (std::find(
-                edp_publications_to_send_.begin(),
-                edp_publications_to_send_.end(),
-                change) == edp_publications_to_send_.end())
+    if (edp_publications_to_send_.push_back(change))
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
                 << change->instanceHandle);
-        edp_publications_to_send_.push_back(change);
         return true;
     }
     return false;
@@ -2238,14 +2257,10 @@ bool DiscoveryDataBase::add_edp_subscriptions_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(r) to send in next iteration if it is not already there
-    if (std::find(
-                edp_subscriptions_to_send_.begin(),
-                edp_subscriptions_to_send_.end(),
-                change) == edp_subscriptions_to_send_.end())
+    if (edp_subscriptions_to_send_.push_back(change))
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
                 << change->instanceHandle);
-        edp_subscriptions_to_send_.push_back(change);
         return true;
     }
     return false;
@@ -2300,191 +2315,195 @@ void DiscoveryDataBase::to_json(
     // TODO add version
 }
 
-bool DiscoveryDataBase::from_json(
-        nlohmann::json& j,
-        std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map)
+void DiscoveryDataBase::to_backup(
+        eprosima::fastcdr::Cdr& cdr) const
 {
-    // This function will parse each attribute in json backup, casting it to istringstream
-    // std::istringstream(j[""]) >> obj;
-
-    // Changes are taken from changes_map, with already created changes
-
-    // Auxiliar variables to deserialize and create new objects of the ddb
-    fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    fastrtps::rtps::GuidPrefix_t prefix_aux;
-    fastrtps::rtps::GuidPrefix_t prefix_aux_ack;
-    fastrtps::rtps::GUID_t guid_aux;
+    // The own server entities are not stored in the db, because in relaunch the must be created again
+    BackupAckStatus ack_status;
+    auto fill_ack_status = [&ack_status](const DiscoverySharedInfo& info)
+            {
+                ack_status.clear();
+                for (const fastrtps::rtps::GuidPrefix_t& prefix : info.relevant_participants())
+                {
+                    ack_status.emplace_back(prefix, info.is_matched(prefix));
+                }
+            };
 
-    logInfo(DISCOVERY_DATABASE, "Raising DDB from json Backup");
+    serialize_backup_header(cdr);
 
-    try
+    // Participants
+    uint32_t count = 0;
+    for (const auto& participant : participants_)
     {
-        // Participants
-        for (auto it = j["participants"].begin(); it != j["participants"].end(); ++it)
+        count += (participant.first != server_guid_prefix_) ? 1 : 0;
+    }
+    cdr.serialize(count);
+    for (const auto& participant : participants_)
+    {
+        if (participant.first != server_guid_prefix_)
         {
-            // Populate info from participant to charge its change
-            std::istringstream(it.key()) >> prefix_aux;
-            std::istringstream(it.value()["change"]["instance_handle"].get<std::string>()) >> instance_handle_aux;
-
-            // Get change
-            fastrtps::rtps::CacheChange_t* change;
-            change = changes_map[instance_handle_aux];
-
-            // Populate RemoteLocatorList
-            fastrtps::rtps::RemoteLocatorList rll;
-            std::istringstream(it.value()["metatraffic_locators"].get<std::string>()) >> rll;
-
-            // Populate DiscoveryParticipantChangeData
-            DiscoveryParticipantChangeData dpcd(
-                rll,
-                it.value()["is_client"].get<bool>(),
-                it.value()["is_local"].get<bool>());
-
-            // Populate DiscoveryParticipantInfo
-            DiscoveryParticipantInfo dpi(change, server_guid_prefix_, dpcd);
+            serialize_change(cdr, *participant.second.change());
+            serialize_locators(cdr, participant.second.metatraffic_locators());
+            cdr.serialize(participant.second.is_client());
+            cdr.serialize(participant.second.is_local());
+            fill_ack_status(participant.second);
+            serialize_ack_status(cdr, ack_status);
+        }
+    }
 
-            // Add acks
-            for (auto it_ack = it.value()["ack_status"].begin(); it_ack != it.value()["ack_status"].end(); ++it_ack)
+    // Writers and readers
+    for (const std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>* endpoints : {&writers_, &readers_})
+    {
+        count = 0;
+        for (const auto& endpoint : *endpoints)
+        {
+            count += (endpoint.first.guidPrefix != server_guid_prefix_) ? 1 : 0;
+        }
+        cdr.serialize(count);
+        for (const auto& endpoint : *endpoints)
+        {
+            if (endpoint.first.guidPrefix != server_guid_prefix_)
             {
-                // Populate GuidPrefix_t
-                std::istringstream(it_ack.key()) >> prefix_aux_ack;
-
-                dpi.add_or_update_ack_participant(prefix_aux_ack, it_ack.value().get<bool>());
+                serialize_change(cdr, *endpoint.second.change());
+                cdr.serialize(endpoint.second.topic());
+                fill_ack_status(endpoint.second);
+                serialize_ack_status(cdr, ack_status);
             }
+        }
+    }
+}
 
-            // Add Participant
-            participants_.insert(std::make_pair(prefix_aux, dpi));
+bool DiscoveryDataBase::from_backup(
+        const DiscoveryDataBaseBackup& backup,
+        std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map)
+{
+    // Changes are taken from changes_map, with already created changes
+    logInfo(DISCOVERY_DATABASE, "Raising DDB from binary Backup");
 
-            logInfo(DISCOVERY_DATABASE, "Participant " << prefix_aux << " created");
+    // Participants
+    for (const BackupParticipant& backup_participant : backup.participants)
+    {
+        fastrtps::rtps::CacheChange_t* change = changes_map[backup_participant.change->instanceHandle];
+        fastrtps::rtps::GuidPrefix_t prefix = guid_from_change(change).guidPrefix;
 
-            // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
-            if (change->kind != fastrtps::rtps::ALIVE)
-            {
-                disposals_.push_back(change);
-            }
-        }
+        // Populate DiscoveryParticipantChangeData
+        DiscoveryParticipantChangeData dpcd(
+            backup_participant.metatraffic_locators,
+            backup_participant.is_client,
+            backup_participant.is_local);
 
-        // Writers
-        for (auto it = j["writers"].begin(); it != j["writers"].end(); ++it)
-        {
-            // Populate GUID_t
-            std::istringstream(it.key()) >> guid_aux;
-            std::istringstream(it.value()["change"]["instance_handle"].get<std::string>()) >> instance_handle_aux;
+        // Populate DiscoveryParticipantInfo
+        DiscoveryParticipantInfo dpi(change, server_guid_prefix_, dpcd);
 
-            // Get change
-            fastrtps::rtps::CacheChange_t* change;
-            change = changes_map[instance_handle_aux];
+        // Add acks
+        for (const auto& status : backup_participant.ack_status)
+        {
+            dpi.add_or_update_ack_participant(status.first, status.second);
+        }
 
-            // Populate topic
-            std::string topic = it.value()["topic"].get<std::string>();
+        // Add Participant
+        participants_.insert(std::make_pair(prefix, dpi));
 
-            // Populate DiscoveryEndpointInfo
-            DiscoveryEndpointInfo dei(change, topic, topic == virtual_topic_, server_guid_prefix_);
+        logInfo(DISCOVERY_DATABASE, "Participant " << prefix << " created");
 
-            // Add acks
-            for (auto it_ack = it.value()["ack_status"].begin(); it_ack != it.value()["ack_status"].end(); ++it_ack)
-            {
-                // Populate GuidPrefix_t
-                std::istringstream(it_ack.key()) >> prefix_aux_ack;
+        // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
+        if (change->kind != fastrtps::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
 
-                dei.add_or_update_ack_participant(prefix_aux_ack, it_ack.value().get<bool>());
-            }
+    // Writers
+    for (const BackupEndpoint& backup_writer : backup.writers)
+    {
+        fastrtps::rtps::CacheChange_t* change = changes_map[backup_writer.change->instanceHandle];
+        fastrtps::rtps::GUID_t guid = guid_from_change(change);
 
-            // Add Participant
-            auto wit = writers_.insert(std::make_pair(guid_aux, dei));
-            // wit is only used in log message below, so it's potentially unused.
-            static_cast<void>(wit);
+        // Populate DiscoveryEndpointInfo
+        DiscoveryEndpointInfo dei(change, backup_writer.topic, backup_writer.topic == virtual_topic_,
+                server_guid_prefix_);
 
-            // Extra configurations for writers
-            // Add writer to writers_by_topic. This will create the topic if necessary
-            add_writer_to_topic_(guid_aux, topic);
+        // Add acks
+        for (const auto& status : backup_writer.ack_status)
+        {
+            dei.add_or_update_ack_participant(status.first, status.second);
+        }
 
-            // Add writer to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
-                    participants_.find(guid_aux.guidPrefix);
-            if (writer_part_it != participants_.end())
-            {
-                writer_part_it->second.add_writer(guid_aux);
-            }
-            else
-            {
-                // Endpoint without participant, corrupted DDB
-                logError(DISCOVERY_DATABASE, "Writer " << guid_aux << " without participant");
-                // TODO handle error
-                return false;
-            }
+        writers_.insert(std::make_pair(guid, dei));
 
-            logInfo(DISCOVERY_DATABASE,
-                    "Writer " << guid_aux << " created with instance handle " <<
-                    wit.first->second.change()->instanceHandle);
+        // Extra configurations for writers
+        // Add writer to writers_by_topic. This will create the topic if necessary
+        add_writer_to_topic_(guid, backup_writer.topic);
 
-            if (change->kind != fastrtps::rtps::ALIVE)
-            {
-                disposals_.push_back(change);
-            }
+        // Add writer to its participant
+        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+                participants_.find(guid.guidPrefix);
+        if (writer_part_it != participants_.end())
+        {
+            writer_part_it->second.add_writer(guid);
         }
-
-        // Readers
-        for (auto it = j["readers"].begin(); it != j["readers"].end(); ++it)
+        else
         {
-            // Populate GUID_t
-            std::istringstream(it.key()) >> guid_aux;
-            std::istringstream(it.value()["change"]["instance_handle"].get<std::string>()) >> instance_handle_aux;
+            // Endpoint without participant, corrupted DDB
+            logError(DISCOVERY_DATABASE, "Writer " << guid << " without participant");
+            // TODO handle error
+            return false;
+        }
 
-            // Get change
-            fastrtps::rtps::CacheChange_t* change;
-            change = changes_map[instance_handle_aux];
+        logInfo(DISCOVERY_DATABASE, "Writer " << guid << " created with instance handle " << change->instanceHandle);
 
-            // Populate topic
-            std::string topic = it.value()["topic"].get<std::string>();
+        if (change->kind != fastrtps::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
 
-            // Populate DiscoveryEndpointInfo
-            DiscoveryEndpointInfo dei(change, topic, topic == virtual_topic_, server_guid_prefix_);
+    // Readers
+    for (const BackupEndpoint& backup_reader : backup.readers)
+    {
+        fastrtps::rtps::CacheChange_t* change = changes_map[backup_reader.change->instanceHandle];
+        fastrtps::rtps::GUID_t guid = guid_from_change(change);
 
-            // Add acks
-            for (auto it_ack = it.value()["ack_status"].begin(); it_ack != it.value()["ack_status"].end(); ++it_ack)
-            {
-                // Populate GuidPrefix_t
-                std::istringstream(it_ack.key()) >> prefix_aux_ack;
+        // Populate DiscoveryEndpointInfo
+        DiscoveryEndpointInfo dei(change, backup_reader.topic, backup_reader.topic == virtual_topic_,
+                server_guid_prefix_);
 
-                dei.add_or_update_ack_participant(prefix_aux_ack, it_ack.value().get<bool>());
-            }
+        // Add acks
+        for (const auto& status : backup_reader.ack_status)
+        {
+            dei.add_or_update_ack_participant(status.first, status.second);
+        }
 
-            // Add Participant
-            readers_.insert(std::make_pair(guid_aux, dei));
+        readers_.insert(std::make_pair(guid, dei));
 
-            // Extra configurations for readers
-            // Add reader to readers_by_topic. This will create the topic if necessary
-            add_reader_to_topic_(guid_aux, topic);
+        // Extra configurations for readers
+        // Add reader to readers_by_topic. This will create the topic if necessary
+        add_reader_to_topic_(guid, backup_reader.topic);
 
-            // Add reader to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
-                    participants_.find(guid_aux.guidPrefix);
-            if (reader_part_it != participants_.end())
-            {
-                reader_part_it->second.add_reader(guid_aux);
-            }
-            else
-            {
-                // Endpoint without participant, corrupted DDB
-                // TODO handle error
-                return false;
-            }
-            logInfo(DISCOVERY_DATABASE, "Reader " << guid_aux << " created");
+        // Add reader to its participant
+        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+                participants_.find(guid.guidPrefix);
+        if (reader_part_it != participants_.end())
+        {
+            reader_part_it->second.add_reader(guid);
+        }
+        else
+        {
+            // Endpoint without participant, corrupted DDB
+            logError(DISCOVERY_DATABASE, "Reader " << guid << " without participant");
+            // TODO handle error
+            return false;
+        }
+        logInfo(DISCOVERY_DATABASE, "Reader " << guid << " created");
 
-            if (change->kind != fastrtps::rtps::ALIVE)
-            {
-                disposals_.push_back(change);
-            }
+        if (change->kind != fastrtps::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
         }
     }
-    catch (std::ios_base::failure&)
-    {
-        logError(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
-    }
 
     // Set dirty topics to all, so next iteration every message pending is sent
-    set_dirty_topic_(virtual_topic_);
+    set_dirty_topic_(virtual_topic_, fastrtps::rtps::c_Guid_Unknown);
 
     // Announce own server
     server_acked_by_all(false);
@@ -2494,11 +2513,11 @@ bool DiscoveryDataBase::from_json(
 
 void DiscoveryDataBase::clean_backup()
 {
-    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in binary backup");
 
     // This will erase the last backup stored
     backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_file_.open(backup_file_name_, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
 }
 
 void DiscoveryDataBase::persistence_enable(
@@ -2507,7 +2526,7 @@ void DiscoveryDataBase::persistence_enable(
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_file_.open(backup_file_name_, std::ios::app | std::ios::binary);
 }
 
 } // namespace ddb
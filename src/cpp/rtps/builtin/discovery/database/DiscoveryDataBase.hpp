@@ -23,6 +23,7 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <set>
 #include <iostream>
 #include <fstream>
 
@@ -35,6 +36,8 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryUniqueQueue.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 
 #include <json.hpp>
 
@@ -205,11 +208,14 @@ public:
 
     ////////////
     // Functions to process_dirty_topics()
+    // Only the topics marked as dirty since they were last cleaned are processed
     bool process_dirty_topics();
 
     ////////////
     // Functions to process_disposals()
-    const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_dispose();
+    // Move the changes to dispose out of the database, leaving its list empty
+    void take_changes_to_dispose(
+            std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes);
 
     void clear_changes_to_dispose();
 
@@ -222,15 +228,19 @@ public:
 
     ////////////
     // Functions to process_to_send_lists()
-    const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send();
+    // The changes to send are moved out of the database, leaving its list empty
+    void take_pdp_to_send(
+            std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes);
 
     void clear_pdp_to_send();
 
-    const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send();
+    void take_edp_publications_to_send(
+            std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes);
 
     void clear_edp_publications_to_send();
 
-    const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send();
+    void take_edp_subscriptions_to_send(
+            std::vector<eprosima::fastrtps::rtps::CacheChange_t*>& changes);
 
     void clear_edp_subscriptions_to_send();
 
@@ -298,16 +308,23 @@ public:
     // Check if the data queue is empty
     bool data_queue_empty();
 
+    // Export the database as json. The backup itself is stored in binary with to_backup()
     void to_json(
             nlohmann::json& j) const;
 
-    bool from_json(
-            nlohmann::json& j,
+    // Serialize the state of the database into a binary snapshot
+    void to_backup(
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    // Restore the state of the database from a binary snapshot
+    // The changes are taken from changes_map, where they have already been created from their pools
+    bool from_backup(
+            const DiscoveryDataBaseBackup& backup,
             std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map);
 
     // This function erase the last backup and all the changes that has arrived since then and create
     // a new backup that shows the actual state of the database
-    // This way we can simulate the state of the database from a clean state of json backup, or from
+    // This way we can simulate the state of the database from a clean state of the backup, or from
     // an state in the middle of an routine execution, and every message that has arrived and has not
     // been process.
     // By this, we do not lose any change or information in any case
@@ -455,10 +472,24 @@ protected:
             const eprosima::fastrtps::rtps::GUID_t& reader_guid,
             const std::string& topic_name);
 
-    //! Add a topic to the list of dirty topics, unless it's already present
+    // Compute the data to send for the pending endpoints of a dirty topic
+    // Return true if the topic is clean, false if it has to be processed again
+    bool process_dirty_topic_(
+            const std::string& topic);
+
+    // Compute the data to send for a writer and a reader of a dirty topic
+    // Return true if nothing else has to be sent for them, false if they have to be processed again
+    bool process_dirty_match_(
+            const std::string& topic,
+            const eprosima::fastrtps::rtps::GUID_t& writer,
+            const eprosima::fastrtps::rtps::GUID_t& reader);
+
+    //! Add a topic to the list of dirty topics, unless it's already present, with an endpoint that changed in it
+    // If the topic is the virtual one, every endpoint of every topic is set as changed
     // Return true if added, false if already there
     bool set_dirty_topic_(
-            std::string topic);
+            std::string topic,
+            const eprosima::fastrtps::rtps::GUID_t& endpoint);
 
     // Add data in pdp_to_send if not already in it
     bool add_pdp_to_send_(
@@ -505,15 +536,19 @@ protected:
     std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
-    std::vector<std::string> dirty_topics_;
+    DiscoveryUniqueQueue<std::string> dirty_topics_;
+
+    //! Endpoints of each dirty topic whose matches must be recalculated. Only the pairs of a writer and a reader
+    //  with at least one of them in this collection are processed. Topics not present have every endpoint pending
+    std::map<std::string, std::set<eprosima::fastrtps::rtps::GUID_t>> dirty_topic_endpoints_;
 
     //! Collection of changes to take out of the server builtin writers
-    std::vector<eprosima::fastrtps::rtps::CacheChange_t*> disposals_;
+    DiscoveryUniqueQueue<eprosima::fastrtps::rtps::CacheChange_t*> disposals_;
 
     //! Collection of changes to put into the server builtin writers
-    std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send_;
-    std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_;
-    std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_;
+    DiscoveryUniqueQueue<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send_;
+    DiscoveryUniqueQueue<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_;
+    DiscoveryUniqueQueue<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_;
 
     //! changes that are no longer associated to living endpoints and should be returned to it's pool
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_release_;
@@ -553,6 +588,9 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+
+    // Buffer reused to serialize every change appended to the backup file
+    eprosima::fastcdr::FastBuffer backup_buffer_;
 };
 
 
@@ -90,12 +90,12 @@ public:
     void remove_writer(
             const eprosima::fastrtps::rtps::GUID_t& guid);
 
-    bool is_client()
+    bool is_client() const
     {
         return participant_change_data_.is_client();
     }
 
-    bool is_local()
+    bool is_local() const
     {
         return participant_change_data_.is_local();
     }
@@ -105,7 +105,7 @@ public:
         return (!is_local());
     }
 
-    fastrtps::rtps::RemoteLocatorList metatraffic_locators()
+    fastrtps::rtps::RemoteLocatorList metatraffic_locators() const
     {
         return participant_change_data_.metatraffic_locators();
     }
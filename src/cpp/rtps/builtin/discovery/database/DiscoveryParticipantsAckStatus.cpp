@@ -36,13 +36,40 @@ void DiscoveryParticipantsAckStatus::add_or_update_participant(
         const eprosima::fastrtps::rtps::GuidPrefix_t& guid_p,
         bool status = false)
 {
-    relevant_participants_map_[guid_p] = status;
+    auto ret = relevant_participants_map_.insert(std::make_pair(guid_p, status));
+    if (ret.second)
+    {
+        if (!status)
+        {
+            ++pending_acks_;
+        }
+    }
+    else if (ret.first->second != status)
+    {
+        ret.first->second = status;
+        if (status)
+        {
+            --pending_acks_;
+        }
+        else
+        {
+            ++pending_acks_;
+        }
+    }
 }
 
 void DiscoveryParticipantsAckStatus::remove_participant(
         const eprosima::fastrtps::rtps::GuidPrefix_t& guid_p)
 {
-    relevant_participants_map_.erase(guid_p);
+    auto it = relevant_participants_map_.find(guid_p);
+    if (it != relevant_participants_map_.end())
+    {
+        if (!it->second)
+        {
+            --pending_acks_;
+        }
+        relevant_participants_map_.erase(it);
+    }
 }
 
 bool DiscoveryParticipantsAckStatus::is_matched(
@@ -62,6 +89,7 @@ void DiscoveryParticipantsAckStatus::unmatch_all()
     {
         it->second = false;
     }
+    pending_acks_ = relevant_participants_map_.size();
 }
 
 bool DiscoveryParticipantsAckStatus::is_relevant_participant(
@@ -78,6 +106,7 @@ bool DiscoveryParticipantsAckStatus::is_relevant_participant(
 std::vector<eprosima::fastrtps::rtps::GuidPrefix_t> DiscoveryParticipantsAckStatus::relevant_participants() const
 {
     std::vector<eprosima::fastrtps::rtps::GuidPrefix_t> res;
+    res.reserve(relevant_participants_map_.size());
     for (auto it = relevant_participants_map_.begin(); it != relevant_participants_map_.end(); ++it)
     {
         res.push_back(it->first);
@@ -87,14 +116,7 @@ std::vector<eprosima::fastrtps::rtps::GuidPrefix_t> DiscoveryParticipantsAckStat
 
 bool DiscoveryParticipantsAckStatus::is_acked_by_all() const
 {
-    for (auto it = relevant_participants_map_.begin(); it != relevant_participants_map_.end(); ++it)
-    {
-        if (!it->second)
-        {
-            return false;
-        }
-    }
-    return true;
+    return pending_acks_ == 0;
 }
 
 void DiscoveryParticipantsAckStatus::to_json(
@@ -42,6 +42,7 @@ class DiscoveryParticipantsAckStatus
 public:
 
     DiscoveryParticipantsAckStatus()
+        : pending_acks_(0)
     {
     }
 
@@ -74,6 +75,9 @@ public:
 private:
 
     std::map<eprosima::fastrtps::rtps::GuidPrefix_t, bool> relevant_participants_map_;
+
+    // Number of relevant participants that have not acked yet, so is_acked_by_all() does not traverse the map
+    size_t pending_acks_;
 };
 
 } /* namespace ddb */
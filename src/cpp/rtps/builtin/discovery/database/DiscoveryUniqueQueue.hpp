@@ -0,0 +1,141 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryUniqueQueue.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_UNIQUE_QUEUE_H_
+#define _FASTDDS_RTPS_DISCOVERY_UNIQUE_QUEUE_H_
+
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Insertion ordered collection without repeated elements.
+ * Used by the DiscoveryDataBase for the dirty topics and the to-send lists, which are filled on every
+ * routine cycle and must not contain duplicates. Checking whether an element is already present is O(1),
+ * instead of traversing the whole list.
+ *@ingroup DISCOVERY_MODULE
+ */
+template<typename T, typename Hash = std::hash<T>>
+class DiscoveryUniqueQueue
+{
+
+public:
+
+    // Add an element at the end of the queue if it is not already present
+    // Return true if added, false if already there
+    bool push_back(
+            const T& value)
+    {
+        if (!index_.insert(value).second)
+        {
+            return false;
+        }
+        values_.push_back(value);
+        return true;
+    }
+
+    bool contains(
+            const T& value) const
+    {
+        return index_.find(value) != index_.end();
+    }
+
+    // Remove the elements for which the predicate returns true, keeping the order of the others
+    template<typename Predicate>
+    void remove_if(
+            Predicate pred)
+    {
+        auto last = values_.begin();
+        for (auto it = values_.begin(); it != values_.end(); ++it)
+        {
+            if (pred(*it))
+            {
+                index_.erase(*it);
+            }
+            else
+            {
+                if (last != it)
+                {
+                    *last = std::move(*it);
+                }
+                ++last;
+            }
+        }
+        values_.erase(last, values_.end());
+    }
+
+    // Move the elements out of the queue, leaving it empty
+    // The previous contents of values are discarded, and its capacity is reused by the queue
+    void take(
+            std::vector<T>& values)
+    {
+        values.clear();
+        values.swap(values_);
+        index_.clear();
+    }
+
+    void clear()
+    {
+        values_.clear();
+        index_.clear();
+    }
+
+    bool empty() const
+    {
+        return values_.empty();
+    }
+
+    size_t size() const
+    {
+        return values_.size();
+    }
+
+    const std::vector<T>& values() const
+    {
+        return values_;
+    }
+
+    typename std::vector<T>::const_iterator begin() const
+    {
+        return values_.begin();
+    }
+
+    typename std::vector<T>::const_iterator end() const
+    {
+        return values_.end();
+    }
+
+private:
+
+    std::vector<T> values_;
+
+    std::unordered_set<T, Hash> index_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_UNIQUE_QUEUE_H_ */
@@ -0,0 +1,460 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.cpp
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#ifdef _WIN32
+#include <windows.h>
+#endif // ifdef _WIN32
+
+#include <fastcdr/exceptions/Exception.h>
+#include <fastcdr/exceptions/NotEnoughMemoryException.h>
+#include <fastdds/dds/log/Log.hpp>
+
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using eprosima::fastcdr::Cdr;
+using eprosima::fastcdr::FastBuffer;
+
+// "DDBS" in ASCII
+static const uint32_t backup_magic = 0x44444253;
+static const uint32_t backup_version = 1;
+
+// Smallest serialization of each element read after a count
+static const size_t min_change_size = 112;
+static const size_t min_locator_size = 24;
+static const size_t min_ack_status_size = eprosima::fastrtps::rtps::GuidPrefix_t::size + 1;
+
+// Throws if the data left cannot hold count elements, so a corrupted count is never used to allocate memory
+static void check_count(
+        Cdr& cdr,
+        uint32_t count,
+        size_t min_element_size)
+{
+    uint64_t size = static_cast<uint64_t>(count) * min_element_size;
+    Cdr::state state(cdr);
+    bool available = size <= (std::numeric_limits<size_t>::max)() && cdr.jump(static_cast<size_t>(size));
+    cdr.setState(state);
+    if (!available)
+    {
+        throw eprosima::fastcdr::exception::NotEnoughMemoryException(
+                  eprosima::fastcdr::exception::NotEnoughMemoryException::NOT_ENOUGH_MEMORY_MESSAGE_DEFAULT);
+    }
+}
+
+static void serialize_time(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::Time_t& time)
+{
+    cdr.serialize(time.seconds());
+    cdr.serialize(time.fraction());
+}
+
+static void deserialize_time(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::Time_t& time)
+{
+    int32_t seconds = 0;
+    uint32_t fraction = 0;
+    cdr.deserialize(seconds);
+    cdr.deserialize(fraction);
+    time.seconds(seconds);
+    time.fraction(fraction);
+}
+
+static void serialize_guid(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::GUID_t& guid)
+{
+    cdr.serializeArray(guid.guidPrefix.value, eprosima::fastrtps::rtps::GuidPrefix_t::size);
+    cdr.serializeArray(guid.entityId.value, eprosima::fastrtps::rtps::EntityId_t::size);
+}
+
+static void deserialize_guid(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::GUID_t& guid)
+{
+    cdr.deserializeArray(guid.guidPrefix.value, eprosima::fastrtps::rtps::GuidPrefix_t::size);
+    cdr.deserializeArray(guid.entityId.value, eprosima::fastrtps::rtps::EntityId_t::size);
+}
+
+static void serialize_sequence_number(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::SequenceNumber_t& sn)
+{
+    cdr.serialize(sn.high);
+    cdr.serialize(sn.low);
+}
+
+static void deserialize_sequence_number(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::SequenceNumber_t& sn)
+{
+    cdr.deserialize(sn.high);
+    cdr.deserialize(sn.low);
+}
+
+static void serialize_sample_identity(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::SampleIdentity& identity)
+{
+    serialize_guid(cdr, identity.writer_guid());
+    serialize_sequence_number(cdr, identity.sequence_number());
+}
+
+static void deserialize_sample_identity(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::SampleIdentity& identity)
+{
+    deserialize_guid(cdr, identity.writer_guid());
+    deserialize_sequence_number(cdr, identity.sequence_number());
+}
+
+void serialize_change(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    cdr.serialize(static_cast<uint8_t>(change.kind));
+    serialize_guid(cdr, change.writerGUID);
+    cdr.serializeArray(change.instanceHandle.value, 16);
+    serialize_sequence_number(cdr, change.sequenceNumber);
+    cdr.serialize(change.isRead);
+    serialize_time(cdr, change.sourceTimestamp);
+    serialize_time(cdr, change.receptionTimestamp);
+    serialize_sample_identity(cdr, change.write_params.sample_identity());
+    serialize_sample_identity(cdr, change.write_params.related_sample_identity());
+
+    cdr.serialize(change.serializedPayload.encapsulation);
+    cdr.serialize(change.serializedPayload.length);
+    if (change.serializedPayload.length > 0)
+    {
+        cdr.serializeArray(change.serializedPayload.data, change.serializedPayload.length);
+    }
+}
+
+void deserialize_change(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    uint8_t kind = 0;
+    cdr.deserialize(kind);
+    change.kind = static_cast<eprosima::fastrtps::rtps::ChangeKind_t>(kind);
+    deserialize_guid(cdr, change.writerGUID);
+    cdr.deserializeArray(change.instanceHandle.value, 16);
+    deserialize_sequence_number(cdr, change.sequenceNumber);
+    cdr.deserialize(change.isRead);
+    deserialize_time(cdr, change.sourceTimestamp);
+    deserialize_time(cdr, change.receptionTimestamp);
+
+    eprosima::fastrtps::rtps::SampleIdentity identity;
+    deserialize_sample_identity(cdr, identity);
+    change.write_params.sample_identity(identity);
+    deserialize_sample_identity(cdr, identity);
+    change.write_params.related_sample_identity(identity);
+
+    uint32_t length = 0;
+    cdr.deserialize(change.serializedPayload.encapsulation);
+    cdr.deserialize(length);
+    check_count(cdr, length, 1);
+    change.serializedPayload.reserve(length);
+    if (length > 0)
+    {
+        cdr.deserializeArray(change.serializedPayload.data, length);
+    }
+    change.serializedPayload.length = length;
+}
+
+static void serialize_locator_list(
+        Cdr& cdr,
+        const eprosima::fastrtps::ResourceLimitedVector<eprosima::fastrtps::rtps::Locator_t>& locators)
+{
+    cdr.serialize(static_cast<uint32_t>(locators.size()));
+    for (const eprosima::fastrtps::rtps::Locator_t& locator : locators)
+    {
+        cdr.serialize(locator.kind);
+        cdr.serialize(locator.port);
+        cdr.serializeArray(locator.address, 16);
+    }
+}
+
+void serialize_locators(
+        Cdr& cdr,
+        const eprosima::fastrtps::rtps::RemoteLocatorList& locators)
+{
+    serialize_locator_list(cdr, locators.unicast);
+    serialize_locator_list(cdr, locators.multicast);
+}
+
+void deserialize_locators(
+        Cdr& cdr,
+        eprosima::fastrtps::rtps::RemoteLocatorList& locators)
+{
+    std::vector<eprosima::fastrtps::rtps::Locator_t> unicast;
+    std::vector<eprosima::fastrtps::rtps::Locator_t> multicast;
+    for (std::vector<eprosima::fastrtps::rtps::Locator_t>* list : {&unicast, &multicast})
+    {
+        uint32_t count = 0;
+        cdr.deserialize(count);
+        check_count(cdr, count, min_locator_size);
+        list->resize(count);
+        for (eprosima::fastrtps::rtps::Locator_t& locator : *list)
+        {
+            cdr.deserialize(locator.kind);
+            cdr.deserialize(locator.port);
+            cdr.deserializeArray(locator.address, 16);
+        }
+    }
+
+    locators = eprosima::fastrtps::rtps::RemoteLocatorList(unicast.size(), multicast.size());
+    for (const eprosima::fastrtps::rtps::Locator_t& locator : unicast)
+    {
+        locators.add_unicast_locator(locator);
+    }
+    for (const eprosima::fastrtps::rtps::Locator_t& locator : multicast)
+    {
+        locators.add_multicast_locator(locator);
+    }
+}
+
+void serialize_ack_status(
+        Cdr& cdr,
+        const BackupAckStatus& ack_status)
+{
+    cdr.serialize(static_cast<uint32_t>(ack_status.size()));
+    for (const auto& status : ack_status)
+    {
+        cdr.serializeArray(status.first.value, eprosima::fastrtps::rtps::GuidPrefix_t::size);
+        cdr.serialize(status.second);
+    }
+}
+
+void deserialize_ack_status(
+        Cdr& cdr,
+        BackupAckStatus& ack_status)
+{
+    uint32_t count = 0;
+    cdr.deserialize(count);
+    check_count(cdr, count, min_ack_status_size);
+    ack_status.resize(count);
+    for (auto& status : ack_status)
+    {
+        cdr.deserializeArray(status.first.value, eprosima::fastrtps::rtps::GuidPrefix_t::size);
+        cdr.deserialize(status.second);
+    }
+}
+
+void serialize_backup_header(
+        Cdr& cdr)
+{
+    cdr.serialize(backup_magic);
+    cdr.serialize(backup_version);
+}
+
+static void deserialize_endpoints(
+        Cdr& cdr,
+        std::vector<BackupEndpoint>& endpoints)
+{
+    uint32_t count = 0;
+    cdr.deserialize(count);
+    check_count(cdr, count, min_change_size);
+    endpoints.resize(count);
+    for (BackupEndpoint& endpoint : endpoints)
+    {
+        endpoint.change.reset(new eprosima::fastrtps::rtps::CacheChange_t());
+        deserialize_change(cdr, *endpoint.change);
+        cdr.deserialize(endpoint.topic);
+        deserialize_ack_status(cdr, endpoint.ack_status);
+    }
+}
+
+bool deserialize_backup(
+        Cdr& cdr,
+        DiscoveryDataBaseBackup& backup)
+{
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    cdr.deserialize(magic);
+    cdr.deserialize(version);
+    if (magic != backup_magic || version != backup_version)
+    {
+        return false;
+    }
+
+    uint32_t count = 0;
+    cdr.deserialize(count);
+    check_count(cdr, count, min_change_size);
+    backup.participants.resize(count);
+    for (BackupParticipant& participant : backup.participants)
+    {
+        participant.change.reset(new eprosima::fastrtps::rtps::CacheChange_t());
+        deserialize_change(cdr, *participant.change);
+        deserialize_locators(cdr, participant.metatraffic_locators);
+        cdr.deserialize(participant.is_client);
+        cdr.deserialize(participant.is_local);
+        deserialize_ack_status(cdr, participant.ack_status);
+    }
+
+    deserialize_endpoints(cdr, backup.writers);
+    deserialize_endpoints(cdr, backup.readers);
+    return true;
+}
+
+bool write_backup_file(
+        const std::string& file_name,
+        const FastBuffer& buffer,
+        size_t length)
+{
+    std::string tmp_file_name = file_name + ".tmp";
+    std::ofstream file(tmp_file_name, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    file.write(buffer.getBuffer(), static_cast<std::streamsize>(length));
+    file.close();
+    if (!file)
+    {
+        logError(DISCOVERY_DATABASE, "Error writing backup file " << tmp_file_name);
+        return false;
+    }
+
+    // The previous snapshot is replaced atomically, so a crash leaves either the previous or the new one
+#ifdef _WIN32
+    bool renamed = 0 != MoveFileExA(tmp_file_name.c_str(), file_name.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    bool renamed = 0 == std::rename(tmp_file_name.c_str(), file_name.c_str());
+#endif // ifdef _WIN32
+    if (!renamed)
+    {
+        logError(DISCOVERY_DATABASE, "Error renaming backup file " << tmp_file_name);
+        return false;
+    }
+    return true;
+}
+
+static bool read_file(
+        const std::string& file_name,
+        std::vector<char>& contents)
+{
+    std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::streamoff size = file.tellg();
+    if (size < 0)
+    {
+        return false;
+    }
+    contents.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(contents.data(), size));
+}
+
+bool read_backup_file(
+        const std::string& file_name,
+        DiscoveryDataBaseBackup& backup)
+{
+    std::vector<char> contents;
+    if (!read_file(file_name, contents) || contents.empty())
+    {
+        return false;
+    }
+
+    FastBuffer buffer(contents.data(), contents.size());
+    Cdr cdr(buffer);
+    try
+    {
+        if (deserialize_backup(cdr, backup))
+        {
+            return true;
+        }
+    }
+    catch (eprosima::fastcdr::exception::Exception&)
+    {
+        logError(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+    }
+
+    // Nothing read from an invalid snapshot is restored
+    backup = DiscoveryDataBaseBackup();
+    return false;
+}
+
+void append_backup_queue_record(
+        std::ofstream& file,
+        FastBuffer& buffer,
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    Cdr cdr(buffer);
+    serialize_change(cdr, change);
+
+    uint32_t length = static_cast<uint32_t>(cdr.getSerializedDataLength());
+    file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file.write(buffer.getBuffer(), length);
+    file.flush();
+}
+
+bool read_backup_queue_file(
+        const std::string& file_name,
+        std::vector<std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t>>& changes)
+{
+    std::vector<char> contents;
+    if (!read_file(file_name, contents))
+    {
+        return false;
+    }
+
+    size_t position = 0;
+    uint32_t length = 0;
+    while (contents.size() - position >= sizeof(length))
+    {
+        memcpy(&length, &contents[position], sizeof(length));
+        position += sizeof(length);
+        if (contents.size() - position < length)
+        {
+            logWarning(DISCOVERY_DATABASE, "Ignoring truncated record at the end of " << file_name);
+            break;
+        }
+
+        FastBuffer buffer(&contents[position], length);
+        Cdr cdr(buffer);
+        std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t> change(new eprosima::fastrtps::rtps::CacheChange_t());
+        try
+        {
+            deserialize_change(cdr, *change);
+        }
+        catch (eprosima::fastcdr::exception::Exception&)
+        {
+            logWarning(DISCOVERY_DATABASE, "Ignoring corrupted record on " << file_name);
+            break;
+        }
+        changes.push_back(std::move(change));
+        position += length;
+    }
+    return true;
+}
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
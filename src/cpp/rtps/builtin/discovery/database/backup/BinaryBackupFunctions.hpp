@@ -0,0 +1,141 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.hpp
+ *
+ */
+
+#ifndef _BINARY_BACKUP_FUNCTIONS_H_
+#define _BINARY_BACKUP_FUNCTIONS_H_
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+// The binary backup of the discovery server consists of two files:
+//  - A snapshot of the whole database, rewritten on every routine cycle with the incoming data blocked.
+//    It is first written on a temporary file and then renamed, so a crash never leaves a half written snapshot.
+//  - An append-only log with every change received since the last snapshot. Each record is the length of the
+//    record followed by the CDR serialization of the change. A truncated record at the end is ignored.
+// Both are CDR encoded with the native endianness, as they are only read back by the same host.
+
+//! Relevant participants of an entity, with their ack status
+using BackupAckStatus = std::vector<std::pair<eprosima::fastrtps::rtps::GuidPrefix_t, bool>>;
+
+//! Participant stored on a binary snapshot
+struct BackupParticipant
+{
+    std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t> change;
+    eprosima::fastrtps::rtps::RemoteLocatorList metatraffic_locators;
+    bool is_client = false;
+    bool is_local = false;
+    BackupAckStatus ack_status;
+};
+
+//! Writer or reader stored on a binary snapshot
+struct BackupEndpoint
+{
+    std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t> change;
+    std::string topic;
+    BackupAckStatus ack_status;
+};
+
+//! Contents of a binary snapshot of the DiscoveryDataBase
+struct DiscoveryDataBaseBackup
+{
+    std::vector<BackupParticipant> participants;
+    std::vector<BackupEndpoint> writers;
+    std::vector<BackupEndpoint> readers;
+};
+
+// Writes the info from a change, payload included, in CDR
+void serialize_change(
+        eprosima::fastcdr::Cdr& cdr,
+        const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+// Reads a change written with serialize_change. The payload of the change is allocated with the exact size
+void deserialize_change(
+        eprosima::fastcdr::Cdr& cdr,
+        eprosima::fastrtps::rtps::CacheChange_t& change);
+
+void serialize_locators(
+        eprosima::fastcdr::Cdr& cdr,
+        const eprosima::fastrtps::rtps::RemoteLocatorList& locators);
+
+void deserialize_locators(
+        eprosima::fastcdr::Cdr& cdr,
+        eprosima::fastrtps::rtps::RemoteLocatorList& locators);
+
+void serialize_ack_status(
+        eprosima::fastcdr::Cdr& cdr,
+        const BackupAckStatus& ack_status);
+
+void deserialize_ack_status(
+        eprosima::fastcdr::Cdr& cdr,
+        BackupAckStatus& ack_status);
+
+// Writes the header identifying a snapshot file
+void serialize_backup_header(
+        eprosima::fastcdr::Cdr& cdr);
+
+// Reads a whole snapshot. Throws a fastcdr exception if the data is truncated
+// Return false if the header does not belong to a snapshot of a supported version
+bool deserialize_backup(
+        eprosima::fastcdr::Cdr& cdr,
+        DiscoveryDataBaseBackup& backup);
+
+// Replaces the snapshot file with the first length bytes of buffer
+bool write_backup_file(
+        const std::string& file_name,
+        const eprosima::fastcdr::FastBuffer& buffer,
+        size_t length);
+
+// Reads a snapshot file
+// Return false if the file does not exist or is corrupted
+bool read_backup_file(
+        const std::string& file_name,
+        DiscoveryDataBaseBackup& backup);
+
+// Appends a change to the log file, using buffer as scratch space
+void append_backup_queue_record(
+        std::ofstream& file,
+        eprosima::fastcdr::FastBuffer& buffer,
+        const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+// Reads every complete record of a log file
+// Return false if the file does not exist
+bool read_backup_queue_file(
+        const std::string& file_name,
+        std::vector<std::unique_ptr<eprosima::fastrtps::rtps::CacheChange_t>>& changes);
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _BINARY_BACKUP_FUNCTIONS_H_ */
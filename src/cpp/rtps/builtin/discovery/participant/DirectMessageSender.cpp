@@ -91,14 +91,17 @@ const std::vector<GUID_t>& DirectMessageSender::remote_guids() const
 /**
  * Send a message through this interface.
  *
- * @param message Pointer to the buffer with the message already serialized.
+ * @param buffers Slices of the message already serialized, in order.
+ * @param total_bytes Sum of the sizes of all the buffers.
  * @param max_blocking_time_point Future timepoint where blocking send should end.
  */
 bool DirectMessageSender::send(
-        CDRMessage_t* message,
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
-    return participant_->sendSync(message, Locators(locators_->begin()), Locators(locators_->end()), max_blocking_time_point);
+    return participant_->sendSync(buffers, total_bytes, Locators(locators_->begin()), Locators(locators_->end()),
+                   max_blocking_time_point);
 }
 
 } /* namespace rtps */
@@ -948,14 +948,16 @@ bool PDP::remove_remote_participant(
             }
         }
 
-        if (mp_builtin->mp_WLP != nullptr)
+        WLP* wlp = mp_RTPSParticipant->wlp();
+        if (wlp != nullptr)
         {
-            this->mp_builtin->mp_WLP->removeRemoteEndpoints(pdata);
+            wlp->removeRemoteEndpoints(pdata);
         }
 
-        if (mp_builtin->tlm_ != nullptr)
+        fastdds::dds::builtin::TypeLookupManager* tlm = mp_RTPSParticipant->existing_typelookup_manager();
+        if (tlm != nullptr)
         {
-            mp_builtin->tlm_->remove_remote_endpoints(pdata);
+            tlm->remove_remote_endpoints(pdata);
         }
 
         this->mp_EDP->removeRemoteEndpoints(pdata);
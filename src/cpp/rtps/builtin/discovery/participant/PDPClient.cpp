@@ -309,9 +309,10 @@ void PDPClient::notifyAboveRemoteEndpoints(
         const ParticipantProxyData& pdata)
 {
     // No EDP notification needed. EDP endpoints would be match when PDP synchronization is granted
-    if (mp_builtin->mp_WLP != nullptr)
+    WLP* wlp = mp_RTPSParticipant->wlp();
+    if (wlp != nullptr)
     {
-        mp_builtin->mp_WLP->assignRemoteEndpoints(pdata);
+        wlp->assignRemoteEndpoints(pdata);
     }
 }
 
@@ -48,7 +48,7 @@
 #include <rtps/builtin/discovery/endpoint/EDPServer.hpp>
 #include <rtps/builtin/discovery/endpoint/EDPServerListeners.hpp>
 
-#include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -102,15 +102,15 @@ bool PDPServer::init(
         return false;
     }
 
-    std::vector<nlohmann::json> backup_queue;
+    std::vector<std::unique_ptr<fastrtps::rtps::CacheChange_t>> backup_queue;
     if (durability_ == TRANSIENT)
     {
-        nlohmann::json backup_json;
+        ddb::DiscoveryDataBaseBackup backup;
         // If the DS is BACKUP, try to restore DDB from file
         discovery_db().backup_in_progress(true);
-        if (read_backup(backup_json, backup_queue))
+        if (read_backup(backup, backup_queue))
         {
-            if (process_backup_discovery_database_restore(backup_json))
+            if (process_backup_discovery_database_restore(backup))
             {
                 logInfo(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
             }
@@ -118,6 +118,14 @@ bool PDPServer::init(
         else
         {
             logInfo(RTPS_PDP_SERVER, "Error reading backup file. Corrupted or unmissing file, restarting from scratch");
+
+            // Backups stored as json by previous versions cannot be restored
+            std::string legacy_file_name = get_persistence_file_name_().str() + ".json";
+            if (std::ifstream(legacy_file_name).good())
+            {
+                logWarning(RTPS_PDP_SERVER, "Backup file " << legacy_file_name << " has a json format that is no "
+                        "longer supported. It is ignored and the server restarts from scratch");
+            }
         }
 
         discovery_db().backup_in_progress(false);
@@ -159,7 +167,7 @@ bool PDPServer::init(
     // Restoring the queue must be done after starting the routine
     if (durability_ == TRANSIENT)
     {
-        // This vector is empty till backup queue is implemented
+        // The changes received after the snapshot was stored are replayed on top of it
         process_backup_restore_queue(backup_queue);
     }
 
@@ -449,9 +457,10 @@ void PDPServer::notifyAboveRemoteEndpoints(
         mp_EDP->assignRemoteEndpoints(pdata);
     }
 
-    if (mp_builtin->mp_WLP != nullptr)
+    WLP* wlp = mp_RTPSParticipant->wlp();
+    if (wlp != nullptr)
     {
-        mp_builtin->mp_WLP->assignRemoteEndpoints(pdata);
+        wlp->assignRemoteEndpoints(pdata);
     }
 }
 
@@ -520,14 +529,14 @@ std::string PDPServer::get_reader_persistence_file_name() const
 std::string PDPServer::get_ddb_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << ".json";
+    filename << ".ddb";
     return filename.str();
 }
 
 std::string PDPServer::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.ddb";
     return filename.str();
 }
 
@@ -841,8 +850,8 @@ bool PDPServer::server_update_routine()
         process_data_queues();                  // all ddb
         process_dirty_topics();                 // all ddb
         process_changes_release();              // server + ddb(changes_to_release(), clear_changes_to_release())
-        process_disposals();                    // server + ddb(changes_to_dispose(), clear_changes_to_disposes())
-        process_to_send_lists();                // server + ddb(get_to_send, remove_to_send_this)
+        process_disposals();                    // server + ddb(take_changes_to_dispose())
+        process_to_send_lists();                // server + ddb(take_pdp_to_send(), take_edp_*_to_send())
         pending_work = pending_ack();           // all server
 
         logInfo(RTPS_PDP_SERVER, "-------------------- " << mp_RTPSParticipant->getGuid() << " --------------------");
@@ -986,7 +995,8 @@ bool PDPServer::process_disposals()
     fastrtps::rtps::WriterHistory* subs_history = edp->subscriptions_writer_.second;
 
     // Get list of disposals from database
-    std::vector<fastrtps::rtps::CacheChange_t*> disposals = discovery_db_.changes_to_dispose();
+    std::vector<fastrtps::rtps::CacheChange_t*> disposals;
+    discovery_db_.take_changes_to_dispose(disposals);
     // Iterate over disposals
     for (auto change: disposals)
     {
@@ -1053,8 +1063,6 @@ bool PDPServer::process_disposals()
             logError(RTPS_PDP_SERVER, "Wrong DATA received from disposals " << change->instanceHandle);
         }
     }
-    // Clear database disposals list
-    discovery_db_.clear_changes_to_dispose();
     return false;
 }
 
@@ -1209,34 +1217,37 @@ bool PDPServer::process_to_send_lists()
 {
     logInfo(RTPS_PDP_SERVER, "process_to_send_lists start");
 
+    // The lists are moved out of the database, so they are not copied and it is not locked while sending them
+    std::vector<fastrtps::rtps::CacheChange_t*> send_list;
+
+    discovery_db_.take_pdp_to_send(send_list);
     if (discovery_db_.updates_since_last_checked() > 0)
     {
         // Process pdp_to_send_
         logInfo(RTPS_PDP_SERVER, "Processing pdp_to_send");
-        process_to_send_list(discovery_db_.pdp_to_send(), mp_PDPWriter, mp_PDPWriterHistory);
+        process_to_send_list(send_list, mp_PDPWriter, mp_PDPWriterHistory);
     }
     else
     {
         logInfo(RTPS_PDP_SERVER, "Skiping sending PDP data because no entities have been discovered or updated");
     }
-    discovery_db_.clear_pdp_to_send();
 
     // Process edp_publications_to_send_
     logInfo(RTPS_PDP_SERVER, "Processing edp_publications_to_send");
     EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    discovery_db_.take_edp_publications_to_send(send_list);
     process_to_send_list(
-        discovery_db_.edp_publications_to_send(),
+        send_list,
         edp->publications_writer_.first,
         edp->publications_writer_.second);
-    discovery_db_.clear_edp_publications_to_send();
 
     // Process edp_subscriptions_to_send_
     logInfo(RTPS_PDP_SERVER, "Processing edp_subscriptions_to_send");
+    discovery_db_.take_edp_subscriptions_to_send(send_list);
     process_to_send_list(
-        discovery_db_.edp_subscriptions_to_send(),
+        send_list,
         edp->subscriptions_writer_.first,
         edp->subscriptions_writer_.second);
-    discovery_db_.clear_edp_subscriptions_to_send();
 
     return false;
 }
@@ -1394,47 +1405,19 @@ void PDPServer::send_announcement(
 }
 
 bool PDPServer::read_backup(
-        nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        ddb::DiscoveryDataBaseBackup& backup,
+        std::vector<std::unique_ptr<fastrtps::rtps::CacheChange_t>>& new_changes)
 {
-    std::ifstream myfile;
-    bool ret = true;
-    try
-    {
-        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
-        // read json object
-        myfile >> ddb_json;
-        myfile.close();
-    }
-    catch (const std::exception& /* e */)
-    {
-        ret = false;
-    }
+    bool ret = ddb::read_backup_file(get_ddb_persistence_file_name(), backup);
+
+    // The changes in the queue are read, but they are not restored until recover queues is finished
+    ddb::read_backup_queue_file(get_ddb_queue_persistence_file_name(), new_changes);
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
-
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
-
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
-
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
     return ret;
 }
 
 bool PDPServer::process_backup_discovery_database_restore(
-        nlohmann::json& j)
+        const ddb::DiscoveryDataBaseBackup& backup)
 {
     logInfo(RTPS_PDP_SERVER, "Restoring DiscoveryDataBase from backup");
 
@@ -1449,280 +1432,229 @@ bool PDPServer::process_backup_discovery_database_restore(
     std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
     std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
 
-    // Auxiliar variables to load info from json
+    // Auxiliar variables to load info from the backup
     std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*> changes_map;
-    fastrtps::rtps::SampleIdentity sample_identity_aux;
-    uint32_t length = 0;
     fastrtps::rtps::CacheChange_t* change_aux;
 
-    try
+    // Changes only owned by changes_map, with the reader they were reserved from (none for the virtual ones).
+    // The changes passed to a listener are not included, as they are already owned by the database
+    std::vector<std::pair<fastrtps::rtps::RTPSReader*, fastrtps::rtps::CacheChange_t*>> pending_changes;
+    auto release_pending_changes = [&pending_changes]()
+            {
+                for (auto& pending : pending_changes)
+                {
+                    if (pending.first != nullptr)
+                    {
+                        pending.first->releaseCache(pending.second);
+                    }
+                    else
+                    {
+                        delete pending.second;
+                    }
+                }
+            };
+
+    // Create every participant change. If it is external creates it from Reader,
+    // if it is from the server, it is created from the writer
+    for (const ddb::BackupParticipant& participant : backup.participants)
     {
-        // Create every participant change. If it is external creates it from Reader,
-        // if it is from the server, it is created from the writer
-        for (auto it = j["participants"].begin(); it != j["participants"].end(); ++it)
+        // Reserve memory for new change. There will not be changes from own server
+        if (!mp_PDPReader->reserveCache(&change_aux, participant.change->serializedPayload.length))
         {
-            length = it.value()["change"]["serialized_payload"]["length"].get<std::uint32_t>();
-            std::istringstream(it.value()["change"]["sample_identity"].get<std::string>()) >> sample_identity_aux;
+            logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+            release_pending_changes();
+            return false;
+        }
 
-            // Reserve memory for new change. There will not be changes from own server
-            if (!mp_PDPReader->reserveCache(&change_aux, length))
-            {
-                logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-                // TODO release changes and exit
-            }
+        // Copy the stored change into the one from the pool
+        change_aux->copy(participant.change.get());
+        change_aux->receptionTimestamp = participant.change->receptionTimestamp;
 
-            // Deserialize from json to change already created
-            ddb::from_json(it.value()["change"], *change_aux);
+        // Insert into the map so the DDB can store it
+        changes_map.insert(
+            std::make_pair(change_aux->instanceHandle, change_aux));
 
-            // Insert into the map so the DDB can store it
-            changes_map.insert(
-                std::make_pair(change_aux->instanceHandle, change_aux));
+        // If the change was read as is_local we must pass it to listener with his own writer_guid
+        if (participant.is_local &&
+                change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
+                mp_PDPWriter->getGuid().guidPrefix &&
+                change_aux->kind == fastrtps::rtps::ALIVE)
+        {
+            change_aux->writerGUID = change_aux->write_params.sample_identity().writer_guid();
+            change_aux->sequenceNumber = change_aux->write_params.sample_identity().sequence_number();
+            mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
+        }
+        else
+        {
+            pending_changes.emplace_back(mp_PDPReader, change_aux);
+        }
+    }
 
-            // If the change was read as is_local we must pass it to listener with his own writer_guid
-            if (it.value()["is_local"].get<bool>() &&
-                    change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
-                    mp_PDPWriter->getGuid().guidPrefix &&
-                    change_aux->kind == fastrtps::rtps::ALIVE)
+    // Create every writer change. If it is external creates it from Reader,
+    // if it is from the server, it is created from writer
+    for (const ddb::BackupEndpoint& writer : backup.writers)
+    {
+        if (writer.topic == discovery_db().virtual_topic())
+        {
+            change_aux = new fastrtps::rtps::CacheChange_t();
+        }
+        else
+        {
+            // Reserve memory for new change. There will not be changes from own server
+            if (!edp->publications_reader_.first->reserveCache(&change_aux, writer.change->serializedPayload.length))
             {
-                change_aux->writerGUID = change_aux->write_params.sample_identity().writer_guid();
-                change_aux->sequenceNumber = change_aux->write_params.sample_identity().sequence_number();
-                mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
+                logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+                release_pending_changes();
+                return false;
             }
         }
 
-        // Create every writer change. If it is external creates it from Reader,
-        // if it is from the server, it is created from writer
-        for (auto it = j["writers"].begin(); it != j["writers"].end(); ++it)
+        // Copy the stored change into the one just created
+        change_aux->copy(writer.change.get());
+        change_aux->receptionTimestamp = writer.change->receptionTimestamp;
+
+        changes_map.insert(
+            std::make_pair(change_aux->instanceHandle, change_aux));
+
+        // TODO refactor for multiple servers
+        // should not send the virtual changes by the listener
+        // should store in DDB if it is local even for endpoints
+        // call listener to create proxy info for other entities different than server
+        if (change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
+                mp_PDPWriter->getGuid().guidPrefix
+                && change_aux->kind == fastrtps::rtps::ALIVE
+                && writer.topic != discovery_db().virtual_topic())
+        {
+            edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
+        }
+        else
         {
-            length = it.value()["change"]["serialized_payload"]["length"].get<std::uint32_t>();
-            std::istringstream(it.value()["change"]["sample_identity"].get<std::string>()) >> sample_identity_aux;
+            pending_changes.emplace_back(
+                writer.topic == discovery_db().virtual_topic() ? nullptr : edp->publications_reader_.first, change_aux);
+        }
+    }
 
-            if (it.value()["topic"] == discovery_db().virtual_topic())
-            {
-                change_aux = new fastrtps::rtps::CacheChange_t();
-            }
-            else
+    // Create every reader change. If it is external creates it from Reader,
+    // if it is created from the server, it is created from writer
+    for (const ddb::BackupEndpoint& reader : backup.readers)
+    {
+        if (reader.topic == discovery_db().virtual_topic())
+        {
+            change_aux = new fastrtps::rtps::CacheChange_t();
+        }
+        else
+        {
+            // Reserve memory for new change. There will not be changes from own server
+            if (!edp->subscriptions_reader_.first->reserveCache(&change_aux, reader.change->serializedPayload.length))
             {
-                // Reserve memory for new change. There will not be changes from own server
-                if (!edp->publications_reader_.first->reserveCache(&change_aux, length))
-                {
-                    logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-                    // TODO release changes and exit
-                }
+                logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+                release_pending_changes();
+                return false;
             }
+        }
 
-            // deserialize from json to change already created
-            ddb::from_json(it.value()["change"], *change_aux);
+        // Copy the stored change into the one just created
+        change_aux->copy(reader.change.get());
+        change_aux->receptionTimestamp = reader.change->receptionTimestamp;
 
-            changes_map.insert(
-                std::make_pair(change_aux->instanceHandle, change_aux));
+        changes_map.insert(
+            std::make_pair(change_aux->instanceHandle, change_aux));
 
-            // TODO refactor for multiple servers
-            // should not send the virtual changes by the listener
-            // should store in DDB if it is local even for endpoints
-            // call listener to create proxy info for other entities different than server
-            if (change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
-                    mp_PDPWriter->getGuid().guidPrefix
-                    && change_aux->kind == fastrtps::rtps::ALIVE
-                    && it.value()["topic"] != discovery_db().virtual_topic())
-            {
-                edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-            }
+        // call listener to create proxy info for other entities different than server
+        if (change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
+                mp_PDPWriter->getGuid().guidPrefix
+                && change_aux->kind == fastrtps::rtps::ALIVE
+                && reader.topic != discovery_db().virtual_topic())
+        {
+            edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
         }
-
-        // Create every reader change. If it is external creates it from Reader,
-        // if it is created from the server, it is created from writer
-        for (auto it = j["readers"].begin(); it != j["readers"].end(); ++it)
+        else
         {
-            std::istringstream(it.value()["change"]["sample_identity"].get<std::string>()) >> sample_identity_aux;
+            pending_changes.emplace_back(
+                reader.topic == discovery_db().virtual_topic() ? nullptr : edp->subscriptions_reader_.first, change_aux);
+        }
+    }
 
-            if (it.value()["topic"] == discovery_db().virtual_topic())
-            {
-                change_aux = new fastrtps::rtps::CacheChange_t();
-            }
-            else
-            {
-                // Reserve memory for new change. There will not be changes from own server
-                if (!edp->subscriptions_reader_.first->reserveCache(&change_aux, length))
-                {
-                    logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-                    // TODO release changes and exit
-                }
-            }
+    // load database
+    return discovery_db_.from_backup(backup, changes_map);
+}
 
-            // deserialize from json to change already created
-            ddb::from_json(it.value()["change"], *change_aux);
+bool PDPServer::process_backup_restore_queue(
+        std::vector<std::unique_ptr<fastrtps::rtps::CacheChange_t>>& new_changes)
+{
+    if (new_changes.empty())
+    {
+        return true;
+    }
 
-            changes_map.insert(
-                std::make_pair(change_aux->instanceHandle, change_aux));
+    logInfo(RTPS_PDP_SERVER, "Replaying " << new_changes.size() << " changes from the backup log");
 
-            // call listener to create proxy info for other entities different than server
-            if (change_aux->write_params.sample_identity().writer_guid().guidPrefix !=
-                    mp_PDPWriter->getGuid().guidPrefix
-                    && change_aux->kind == fastrtps::rtps::ALIVE
-                    && it.value()["topic"] != discovery_db().virtual_topic())
-            {
-                edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-            }
-        }
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
 
-        // load database
-        discovery_db_.from_json(j, changes_map);
-    }
-    catch (std::ios_base::failure&)
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    bool ret = true;
+
+    // Every change in the log was received from outside the server after the snapshot was stored, so it is passed
+    // again to the listener of the reader that received it, in the same order
+    for (const std::unique_ptr<fastrtps::rtps::CacheChange_t>& new_change : new_changes)
     {
-        // TODO clean changes in case it has been an error
-        logError(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
-        return false;
+        fastrtps::rtps::RTPSReader* reader = nullptr;
+        fastrtps::rtps::ReaderListener* listener = nullptr;
+        if (ddb::DiscoveryDataBase::is_participant(new_change.get()))
+        {
+            reader = mp_PDPReader;
+            listener = mp_listener;
+        }
+        else if (ddb::DiscoveryDataBase::is_writer(new_change.get()))
+        {
+            reader = edp->publications_reader_.first;
+            listener = edp_pub_listener;
+        }
+        else if (ddb::DiscoveryDataBase::is_reader(new_change.get()))
+        {
+            reader = edp->subscriptions_reader_.first;
+            listener = edp_sub_listener;
+        }
+        else
+        {
+            logWarning(RTPS_PDP_SERVER, "Ignoring unknown change from the backup log: " << new_change->instanceHandle);
+            continue;
+        }
+
+        fastrtps::rtps::CacheChange_t* change_aux;
+        if (!reader->reserveCache(&change_aux, new_change->serializedPayload.length))
+        {
+            logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+            ret = false;
+            continue;
+        }
+
+        // Copy the stored change into the one from the pool
+        change_aux->copy(new_change.get());
+        change_aux->receptionTimestamp = new_change->receptionTimestamp;
+        listener->onNewCacheChangeAdded(reader, change_aux);
     }
-    return true;
-}
 
-bool PDPServer::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
-{
-    // fastrtps::rtps::SampleIdentity sample_identity_aux;
-    // fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
-    // EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
-    // EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastrtps::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == mp_PDPWriter->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPWriterHistory->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPReaderHistory->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     logError(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
-    return true;
+    return ret;
 }
 
 void PDPServer::process_backup_store()
 {
-    logInfo(DISCOVERY_DATABASE, "Dump DDB in json backup");
-
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
-
-    // Set j with the json from database dump
-    nlohmann::json j;
-    discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
+    logInfo(DISCOVERY_DATABASE, "Dump DDB in binary backup");
+
+    // Serialize the database dump and replace the last backup stored
+    eprosima::fastcdr::FastBuffer buffer;
+    eprosima::fastcdr::Cdr cdr(buffer);
+    discovery_db().to_backup(cdr);
+    if (!ddb::write_backup_file(get_ddb_persistence_file_name(), buffer, cdr.getSerializedDataLength()))
+    {
+        logError(DISCOVERY_DATABASE, "Error writing backup file " << get_ddb_persistence_file_name());
+    }
 
     // Clear queue ddb backup
     discovery_db_.clean_backup();
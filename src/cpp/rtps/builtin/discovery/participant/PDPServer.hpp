@@ -229,25 +229,25 @@ protected:
 
     bool pending_ack();
 
-    // Method to restore de DiscoveryDataBase from a json object
+    // Method to restore de DiscoveryDataBase from a binary snapshot
     // This method reserve space for every cacheChange from the correspondent pool, and
     // sends these changes stored to the DDB for it to process them
     // This method must be called with the DDB variable backup_in_progress as true
     bool process_backup_discovery_database_restore(
-            nlohmann::json& ddb_json);
+            const ddb::DiscoveryDataBaseBackup& backup);
 
-    // Restore the backup file with the changes that were added to the DDB queues (and so acked)
+    // Replay the changes logged since the snapshot was stored, after the snapshot has been restored
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
     // This method must be called with the DDB variable backup_in_progress as false
     bool process_backup_restore_queue(
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<std::unique_ptr<fastrtps::rtps::CacheChange_t>>& new_changes);
 
-    // Reads the two backup files and stores each json objects in both arguments
-    // The first argument has the json object to restore the DDB
-    // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // Reads the two backup files and stores their contents in both arguments
+    // The first argument has the snapshot to restore the DDB
+    // The second argument has the changes that must be sent again to the queue
     bool read_backup(
-            nlohmann::json& ddb_json,
-            std::vector<nlohmann::json>& new_changes);
+            ddb::DiscoveryDataBaseBackup& backup,
+            std::vector<std::unique_ptr<fastrtps::rtps::CacheChange_t>>& new_changes);
 
     std::vector<fastrtps::rtps::GuidPrefix_t> servers_prefixes();
 
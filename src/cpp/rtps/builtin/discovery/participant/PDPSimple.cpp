@@ -422,14 +422,16 @@ void PDPSimple::notifyAboveRemoteEndpoints(
         mp_EDP->assignRemoteEndpoints(pdata);
     }
 
-    if (mp_builtin->mp_WLP != nullptr)
+    WLP* wlp = mp_RTPSParticipant->wlp();
+    if (wlp != nullptr)
     {
-        mp_builtin->mp_WLP->assignRemoteEndpoints(pdata);
+        wlp->assignRemoteEndpoints(pdata);
     }
 
-    if (mp_builtin->tlm_ != nullptr)
+    fastdds::dds::builtin::TypeLookupManager* tlm = mp_RTPSParticipant->existing_typelookup_manager();
+    if (tlm != nullptr)
     {
-        mp_builtin->tlm_->assign_remote_endpoints(pdata);
+        tlm->assign_remote_endpoints(pdata);
     }
 }
 
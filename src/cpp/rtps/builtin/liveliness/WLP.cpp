@@ -855,6 +855,13 @@ bool WLP::automatic_liveliness_assertion()
 
     if (0 < automatic_writers_.size())
     {
+        // Remote participants assert our automatic writers on any liveliness message, so a single message
+        // asserts both kinds while there are alive manual by participant writers.
+        if (0 < manual_by_participant_writers_.size() &&
+                pub_liveliness_manager_->is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS))
+        {
+            return send_liveliness_message(manual_by_participant_instance_handle_);
+        }
         return send_liveliness_message(automatic_instance_handle_);
     }
 
@@ -867,6 +874,12 @@ bool WLP::participant_liveliness_assertion()
 
     if (0 < manual_by_participant_writers_.size())
     {
+        // The automatic assertion is at least as frequent, and already sends this message when needed
+        if (0 < automatic_writers_.size() && min_automatic_ms_ <= min_manual_by_participant_ms_)
+        {
+            return true;
+        }
+
         if (pub_liveliness_manager_->is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS))
         {
             return send_liveliness_message(manual_by_participant_instance_handle_);
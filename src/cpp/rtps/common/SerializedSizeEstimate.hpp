@@ -0,0 +1,83 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SerializedSizeEstimate.hpp
+ */
+
+#ifndef RTPS_COMMON_SERIALIZEDSIZEESTIMATE_HPP_
+#define RTPS_COMMON_SERIALIZEDSIZEESTIMATE_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace detail {
+
+/**
+ * Size reserved for the payloads of a writer before serializing its samples, so they are serialized in a single
+ * pass. It is the size of the biggest sample in the last window of samples, plus any bigger sample seen since.
+ * Thread safe.
+ */
+class SerializedSizeEstimate
+{
+public:
+
+    //! Number of samples after which the estimate forgets the older ones
+    static constexpr uint32_t window_size = 256u;
+
+    //! @return The size to reserve, or 0 when no sample has been serialized yet.
+    uint32_t get() const
+    {
+        return estimate_.load(std::memory_order_relaxed);
+    }
+
+    //! Account for a sample just serialized
+    void update(
+            uint32_t size)
+    {
+        grow(estimate_, size);
+        grow(window_max_, size);
+        if (0u == (++window_samples_ % window_size))
+        {
+            // A few big samples should not make every later payload oversized
+            estimate_.store(window_max_.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    static void grow(
+            std::atomic<uint32_t>& value,
+            uint32_t size)
+    {
+        uint32_t current = value.load(std::memory_order_relaxed);
+        while (current < size && !value.compare_exchange_weak(current, size, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    std::atomic<uint32_t> estimate_{0u};
+    std::atomic<uint32_t> window_max_{0u};
+    std::atomic<uint32_t> window_samples_{0u};
+};
+
+}  // namespace detail
+}  // namespace rtps
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif  // RTPS_COMMON_SERIALIZEDSIZEESTIMATE_HPP_
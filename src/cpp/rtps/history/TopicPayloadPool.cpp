@@ -42,12 +42,18 @@ bool TopicPayloadPool::do_get_payload(
         CacheChange_t& cache_change,
         bool resizeable)
 {
-    PayloadNode* payload = nullptr;
+    PayloadNode* payload = free_payloads_.pop();
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    if (payload == nullptr)
     {
-        payload = allocate(size); //Allocates a single payload
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // A payload may have been released while waiting for the mutex
+        payload = free_payloads_.pop();
+        if (payload == nullptr)
+        {
+            payload = allocate(size); //Allocates a single payload
+        }
         if (payload == nullptr)
         {
             lock.unlock();
@@ -57,20 +63,14 @@ bool TopicPayloadPool::do_get_payload(
             return false;
         }
     }
-    else
-    {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
-    }
 
-    // Resize if needed
+    // Resize if needed. The payload is not on the free list, so no other thread can access it.
     if (resizeable && size > payload->data_size())
     {
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
-            lock.unlock();
+            free_payloads_.push(payload->free_list_slot());
             logError(RTPS_HISTORY, "Failed to resize the payload");
 
             cache_change.serializedPayload.data = nullptr;
@@ -80,7 +80,6 @@ bool TopicPayloadPool::do_get_payload(
         }
     }
 
-    lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
     cache_change.serializedPayload.max_size = payload->data_size();
@@ -138,9 +137,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        free_payloads_.push(PayloadNode::free_list_slot(cache_change.serializedPayload.data));
     }
 
     cache_change.serializedPayload.length = 0;
@@ -201,6 +198,15 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
         return nullptr;
     }
 
+    uint32_t slot = free_payloads_.add(payload);
+    if (slot == LockFreeFreeList<PayloadNode>::npos)
+    {
+        logWarning(RTPS_HISTORY, "Failure to create a new payload: too many payloads");
+        delete payload;
+        return nullptr;
+    }
+
+    payload->free_list_slot(slot);
     payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
     all_payloads_.push_back(payload);
     return payload;
@@ -253,7 +259,11 @@ void TopicPayloadPool::reserve (
     for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
     {
         PayloadNode* payload = do_allocate(size);
-        free_payloads_.push_back(payload);
+        if (payload == nullptr)
+        {
+            break;
+        }
+        free_payloads_.push(payload->free_list_slot());
     }
 }
 
@@ -264,8 +274,13 @@ bool TopicPayloadPool::shrink (
 
     while (max_num_payloads < all_payloads_.size())
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
+        // Payloads may be concurrently taken by get_payload, which does not lock the mutex
+        PayloadNode* payload = free_payloads_.pop();
+        if (payload == nullptr)
+        {
+            return false;
+        }
+        free_payloads_.remove(payload->free_list_slot());
 
         // Find data in allPayloads, remove element, then delete it
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
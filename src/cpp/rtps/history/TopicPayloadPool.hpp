@@ -25,6 +25,7 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <utils/collections/LockFreeFreeList.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -209,6 +210,23 @@ protected:
             info().data_index = index;
         }
 
+        uint32_t free_list_slot() const
+        {
+            return info().free_list_slot;
+        }
+
+        static uint32_t free_list_slot(
+                octet* data)
+        {
+            return info(data).free_list_slot;
+        }
+
+        void free_list_slot(
+                uint32_t slot)
+        {
+            info().free_list_slot = slot;
+        }
+
         octet* data() const
         {
             return info().data;
@@ -243,6 +261,7 @@ protected:
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
             uint32_t data_index = 0;
+            uint32_t free_list_slot = 0;
             octet data[1];
         };
 
@@ -347,7 +366,8 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
-    std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
+    //! Payloads that are free. Taken and returned without locking mutex_, which protects the rest of the pool.
+    LockFreeFreeList<PayloadNode> free_payloads_;
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
     std::mutex mutex_;
@@ -51,6 +51,7 @@ public:
                 all_payloads_.at(data_index) = all_payloads_.back();
                 all_payloads_.back()->data_index(data_index);
                 all_payloads_.pop_back();
+                free_payloads_.remove(payload->free_list_slot());
                 lock.unlock();
 
                 // Now delete the data
@@ -27,6 +27,7 @@
 #include <fastdds/core/policy/ParameterList.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <mutex>
@@ -277,6 +278,10 @@ void MessageReceiver::removeEndpoint(
                 break;
             }
         }
+
+        acknack_batch_writers_.erase(
+            std::remove(acknack_batch_writers_.begin(), acknack_batch_writers_.end(), var),
+            acknack_batch_writers_.end());
     }
     else
     {
@@ -310,6 +315,16 @@ void MessageReceiver::reset()
     timestamp_ = c_TimeInvalid;
 }
 
+void MessageReceiver::end_acknack_batches()
+{
+    std::lock_guard<std::mutex> guard(mtx_);
+    for (RTPSWriter* writer : acknack_batch_writers_)
+    {
+        writer->end_acknack_batch();
+    }
+    acknack_batch_writers_.clear();
+}
+
 void MessageReceiver::processCDRMsg(
         const Locator_t& loc,
         CDRMessage_t* msg)
@@ -370,6 +385,7 @@ void MessageReceiver::processCDRMsg(
 
         if (decode_ret < 0)
         {
+            end_acknack_batches();
             return;
         }
 
@@ -382,6 +398,7 @@ void MessageReceiver::processCDRMsg(
         //First 4 bytes must contain: ID | flags | octets to next header
         if (!readSubmessageHeader(submessage, &submsgh))
         {
+            end_acknack_batches();
             return;
         }
 
@@ -513,6 +530,7 @@ void MessageReceiver::processCDRMsg(
         submessage->pos = next_msg_pos;
     }
 
+    end_acknack_batches();
     participant_->assert_remote_participant_liveliness(source_guid_prefix_);
 }
 
@@ -1076,6 +1094,15 @@ bool MessageReceiver::proc_Submsg_Acknack(
     //Look for the correct writer to use the acknack
     for (RTPSWriter* it : associated_writers_)
     {
+        // Acknacks of the same message are processed as a batch, which ends after the whole message is processed
+        if (it->getGuid() == writerGUID &&
+                std::find(acknack_batch_writers_.begin(), acknack_batch_writers_.end(), it) ==
+                acknack_batch_writers_.end())
+        {
+            it->begin_acknack_batch();
+            acknack_batch_writers_.push_back(it);
+        }
+
         bool result;
         if (it->process_acknack(writerGUID, readerGUID, Ackcount, SNSet, finalFlag, result))
         {
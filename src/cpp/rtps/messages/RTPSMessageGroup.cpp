@@ -132,6 +132,7 @@ RTPSMessageGroup::RTPSMessageGroup(
 #endif // if HAVE_SECURITY
     , max_blocking_time_point_(max_blocking_time_point)
     , send_buffer_(participant->get_send_buffer())
+    , referenced_payload_bytes_(0)
 {
     // Avoid warning when neither SECURITY nor DEBUG is used
     (void)participant;
@@ -176,6 +177,8 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+    send_buffer_->referenced_payloads_.clear();
+    referenced_payload_bytes_ = 0;
 }
 
 void RTPSMessageGroup::flush()
@@ -191,6 +194,9 @@ void RTPSMessageGroup::send()
 
     if (full_msg_->length > RTPSMESSAGE_HEADER_SIZE)
     {
+        std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers = send_buffer_->buffers_to_send_;
+        buffers.clear();
+
 #if HAVE_SECURITY
         // TODO(Ricardo) Control message size if it will be encrypted.
         if (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection())
@@ -212,11 +218,25 @@ void RTPSMessageGroup::send()
         }
 #endif // if HAVE_SECURITY
 
-        if (!sender_.send(msgToSend, max_blocking_time_point_))
+        // Referenced payloads are sent between the slices of the message they were taken out from
+        uint32_t from = 0;
+        for (const RTPSMessageGroup_t::ReferencedPayload& referenced : send_buffer_->referenced_payloads_)
+        {
+            buffers.emplace_back(&msgToSend->buffer[from], referenced.position - from);
+            buffers.push_back(referenced.payload);
+            from = referenced.position;
+        }
+        if (msgToSend->length > from)
+        {
+            buffers.emplace_back(&msgToSend->buffer[from], msgToSend->length - from);
+        }
+
+        uint32_t total_bytes = msgToSend->length + referenced_payload_bytes_;
+        if (!sender_.send(buffers, total_bytes, max_blocking_time_point_))
         {
             throw timeout();
         }
-        currentBytesSent_ += msgToSend->length;
+        currentBytesSent_ += total_bytes;
     }
 }
 
@@ -245,7 +265,7 @@ bool RTPSMessageGroup::insert_submessage(
         const GuidPrefix_t& destination_guid_prefix,
         bool is_big_submessage)
 {
-    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    if (!append_submessage())
     {
         // Retry
         flush();
@@ -255,12 +275,14 @@ bool RTPSMessageGroup::insert_submessage(
         if (!add_info_dst_in_buffer(full_msg_, destination_guid_prefix))
         {
             logError(RTPS_WRITER, "Cannot add INFO_DST submessage to the CDRMessage. Buffer too small");
+            pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer();
             return false;
         }
 
-        if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+        if (!append_submessage())
         {
             logError(RTPS_WRITER, "Cannot add RTPS submesage to the CDRMessage. Buffer too small");
+            pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer();
             return false;
         }
     }
@@ -274,6 +296,58 @@ bool RTPSMessageGroup::insert_submessage(
     return true;
 }
 
+bool RTPSMessageGroup::append_submessage()
+{
+    // The size of the message includes the payloads that are not copied into it, and their alignment
+    uint32_t pending_size = pending_payload_.size + ((4 - pending_payload_.size % 4) & 3);
+    if (full_msg_->length + referenced_payload_bytes_ + submessage_msg_->length + pending_size > full_msg_->max_size)
+    {
+        return false;
+    }
+
+    if (!CDRMessage::appendMsg(full_msg_, submessage_msg_))
+    {
+        return false;
+    }
+
+    if (nullptr != pending_payload_.buffer)
+    {
+        send_buffer_->referenced_payloads_.push_back({full_msg_->length, pending_payload_});
+        referenced_payload_bytes_ += pending_payload_.size;
+
+        // The alignment of the submessage goes after the payload
+        for (uint32_t count = pending_payload_.size; 0 != (count & 3); ++count)
+        {
+            CDRMessage::addOctet(full_msg_, 0);
+        }
+
+        pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer();
+    }
+
+    return true;
+}
+
+bool RTPSMessageGroup::can_reference_payload(
+        uint32_t payload_size) const
+{
+    if (payload_size < min_referenced_payload_size_ ||
+            send_buffer_->referenced_payloads_.size() >= max_referenced_payloads_)
+    {
+        return false;
+    }
+
+#if HAVE_SECURITY
+    const security::EndpointSecurityAttributes& security_attributes = endpoint_->getAttributes().security_attributes();
+    if (security_attributes.is_payload_protected || security_attributes.is_submessage_protected ||
+            (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection()))
+    {
+        return false;
+    }
+#endif // if HAVE_SECURITY
+
+    return true;
+}
+
 bool RTPSMessageGroup::add_info_dst_in_buffer(
         CDRMessage_t* buffer,
         const GuidPrefix_t& destination_guid_prefix)
@@ -391,11 +465,22 @@ bool RTPSMessageGroup::add_data(
     }
 #endif // if HAVE_SECURITY
 
+    // Big payloads are sent from the change instead of copied into the message
+    bool copy_data = true;
+    if (ALIVE == change_to_add.kind && nullptr != change_to_add.serializedPayload.data &&
+            can_reference_payload(change_to_add.serializedPayload.length))
+    {
+        copy_data = false;
+        pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+    }
+
     // TODO (Ricardo). Check to create special wrapper.
     bool is_big_submessage;
     if (!RTPSMessageCreator::addSubmessageData(submessage_msg_, &change_to_add, endpoint_->getAttributes().topicKind,
-            readerId, expectsInlineQos, inlineQos, &is_big_submessage))
+            readerId, expectsInlineQos, inlineQos, &is_big_submessage, copy_data))
     {
+        pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer();
         logError(RTPS_WRITER, "Cannot add DATA submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
@@ -489,10 +574,21 @@ bool RTPSMessageGroup::add_data_frag(
     }
 #endif // if HAVE_SECURITY
 
+    // Big fragments are sent from the change instead of copied into the message
+    bool copy_data = true;
+    if (ALIVE == change_to_add.kind && nullptr != change_to_add.serializedPayload.data &&
+            can_reference_payload(change_to_add.serializedPayload.length))
+    {
+        copy_data = false;
+        pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer(change_to_add.serializedPayload.data,
+                        change_to_add.serializedPayload.length);
+    }
+
     if (!RTPSMessageCreator::addSubmessageDataFrag(submessage_msg_, &change, fragment_number,
             change_to_add.serializedPayload, endpoint_->getAttributes().topicKind, readerId,
-            expectsInlineQos, inlineQos))
+            expectsInlineQos, inlineQos, copy_data))
     {
+        pending_payload_ = eprosima::fastdds::rtps::NetworkBuffer();
         logError(RTPS_WRITER, "Cannot add DATA_FRAG submsg to the CDRMessage. Buffer too small");
         change_to_add.serializedPayload.data = nullptr;
         return false;
@@ -24,6 +24,9 @@
 #include <fastrtps/rtps/common/CDRMessage_t.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/common/NetworkBuffer.hpp>
+
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -97,13 +100,29 @@ public:
         RTPSMessageCreator::addHeader(&rtpsmsg_fullmsg_, participant_guid);
     }
 
+    //! A payload sent from where it is, between the bytes of the full message before and after position.
+    struct ReferencedPayload
+    {
+        uint32_t position;
+        eprosima::fastdds::rtps::NetworkBuffer payload;
+    };
+
     CDRMessage_t rtpsmsg_submessage_;
 
     CDRMessage_t rtpsmsg_fullmsg_;
 
+    //! Payloads of the full message not copied into it, in order.
+    std::vector<ReferencedPayload> referenced_payloads_;
+
+    //! Slices of the full message and its referenced payloads, as given to the transports.
+    std::vector<eprosima::fastdds::rtps::NetworkBuffer> buffers_to_send_;
+
 #if HAVE_SECURITY
     CDRMessage_t rtpsmsg_encrypt_;
 #endif
+
+    //! Slot of this buffer on the list of free buffers of the SendBuffersManager that created it.
+    uint32_t pool_slot_ = 0;
 };
 
 } // namespace rtps
@@ -26,9 +26,22 @@ namespace rtps {
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing)
-    : allow_growing_(allow_growing)
+    : reserved_size_(reserved_size)
+    , allow_growing_(allow_growing)
 {
-    pool_.reserve(reserved_size);
+}
+
+SendBuffersManager::~SendBuffersManager()
+{
+    std::size_t n_deleted = 0;
+    RTPSMessageGroup_t* buffer = nullptr;
+    while (nullptr != (buffer = free_buffers_.pop()))
+    {
+        delete buffer;
+        ++n_deleted;
+    }
+    assert(n_deleted == n_created_);
+    (void)n_deleted;
 }
 
 void SendBuffersManager::init(
@@ -36,14 +49,14 @@ void SendBuffersManager::init(
 {
     std::lock_guard<std::mutex> guard(mutex_);
 
-    if (n_created_ < pool_.capacity())
+    if (n_created_ < reserved_size_)
     {
         const GuidPrefix_t& guid_prefix = participant->getGuid().guidPrefix;
 
         // Single allocation for the data of all the buffers.
-        // We align the payload size to the size of a pointer, so all buffers will
-        // be aligned as if directly allocated.
-        constexpr size_t align_size = sizeof(octet*) - 1;
+        // We align the payload size to the size of a cache line, so buffers used by different threads
+        // never share a cache line.
+        constexpr size_t align_size = 64u - 1u;
         uint32_t payload_size = participant->getMaxMessageSize();
         assert(payload_size > 0u);
         payload_size = (payload_size + align_size) & ~align_size;
@@ -54,19 +67,22 @@ void SendBuffersManager::init(
 #else
         advance *= 2;
 #endif
-        size_t data_size = advance * (pool_.capacity() - n_created_);
-        common_buffer_.assign(data_size, 0);
+        size_t data_size = advance * (reserved_size_ - n_created_);
+        common_buffer_.assign(data_size + align_size, 0);
 
         octet* raw_buffer = common_buffer_.data();
-        while(n_created_ < pool_.capacity())
+        raw_buffer += (align_size + 1u - (reinterpret_cast<uintptr_t>(raw_buffer) & align_size)) & align_size;
+        while (n_created_ < reserved_size_)
         {
-            pool_.emplace_back(new RTPSMessageGroup_t(
+            RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
                 raw_buffer,
 #if HAVE_SECURITY
                 secure,
 #endif
                 payload_size, guid_prefix
-            ));
+                );
+            new_item->pool_slot_ = free_buffers_.add(new_item);
+            free_buffers_.push(new_item->pool_slot_);
             raw_buffer += advance;
             ++n_created_;
         }
@@ -76,38 +92,56 @@ void SendBuffersManager::init(
 std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    RTPSMessageGroup_t* buffer = free_buffers_.pop();
 
-    std::unique_ptr<RTPSMessageGroup_t> ret_val;
-
-    while (pool_.empty())
+    if (nullptr == buffer)
     {
-        if (allow_growing_ || n_created_ < pool_.capacity())
-        {
-            add_one_buffer(participant);
-        }
-        else
+        n_exhausted_.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        // Announce the waiter before checking the list again, so a buffer returned in between either is taken
+        // here or notifies available_cv_.
+        n_waiting_.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (nullptr == (buffer = free_buffers_.pop()))
         {
+            if (allow_growing_ || n_created_ < reserved_size_)
+            {
+                buffer = add_one_buffer(participant);
+                break;
+            }
+
             logInfo(RTPS_PARTICIPANT, "Waiting for send buffer");
+            n_waits_.fetch_add(1, std::memory_order_relaxed);
             available_cv_.wait(lock);
         }
+        n_waiting_.fetch_sub(1);
     }
 
-    ret_val = std::move(pool_.back());
-    pool_.pop_back();
-
-    return ret_val;
+    return std::unique_ptr<RTPSMessageGroup_t>(buffer);
 }
 
 void SendBuffersManager::return_buffer(
         std::unique_ptr <RTPSMessageGroup_t>&& buffer)
+{
+    free_buffers_.push(buffer.release()->pool_slot_);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0 < n_waiting_.load())
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        available_cv_.notify_one();
+    }
+}
+
+std::size_t SendBuffersManager::buffers_created()
 {
     std::lock_guard<std::mutex> guard(mutex_);
-    pool_.push_back(std::move(buffer));
-    available_cv_.notify_one();
+    return n_created_;
 }
 
-void SendBuffersManager::add_one_buffer(
+RTPSMessageGroup_t* SendBuffersManager::add_one_buffer(
         const RTPSParticipantImpl* participant)
 {
     RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
@@ -115,8 +149,9 @@ void SendBuffersManager::add_one_buffer(
         participant->is_secure(),
 #endif
         participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
-    pool_.emplace_back(new_item);
+    new_item->pool_slot_ = free_buffers_.add(new_item);
     ++n_created_;
+    return new_item;
 }
 
 } /* namespace rtps */
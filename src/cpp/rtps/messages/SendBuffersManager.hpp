@@ -22,7 +22,9 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <utils/collections/LockFreeFreeList.hpp>
 
+#include <atomic>              // std::atomic
 #include <vector>              // std::vector
 #include <memory>              // std::unique_ptr
 #include <mutex>               // std::mutex
@@ -37,6 +39,9 @@ class RTPSParticipantImpl;
 
 /**
  * Manages a pool of send buffers.
+ *
+ * Buffers are taken and returned without locks while the pool has free buffers. The mutex is only taken to
+ * create new buffers or to wait for one to be returned when the pool is exhausted.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
@@ -52,10 +57,7 @@ public:
             size_t reserved_size,
             bool allow_growing);
 
-    ~SendBuffersManager()
-    {
-        assert(pool_.size() == n_created_);
-    }
+    ~SendBuffersManager();
 
     /**
      * Initialization of pool.
@@ -80,23 +82,45 @@ public:
     void return_buffer(
             std::unique_ptr <RTPSMessageGroup_t>&& buffer);
 
+    //! Number of buffers created by the pool.
+    std::size_t buffers_created();
+
+    //! Number of times a buffer was requested while the pool had no free buffers.
+    uint64_t times_exhausted() const
+    {
+        return n_exhausted_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of times a thread had to wait for a buffer to be returned.
+    uint64_t times_waited() const
+    {
+        return n_waits_.load(std::memory_order_relaxed);
+    }
+
 private:
 
-    void add_one_buffer(
+    RTPSMessageGroup_t* add_one_buffer(
             const RTPSParticipantImpl* participant);
 
-    //!Protects all data
+    //!Protects creation of buffers and waiting for them
     std::mutex mutex_;
-    //!Send buffers pool
-    std::vector<std::unique_ptr<RTPSMessageGroup_t>> pool_;
+    //!Free send buffers
+    LockFreeFreeList<RTPSMessageGroup_t> free_buffers_;
+    //!Number of buffers created without allowing growth
+    std::size_t reserved_size_;
     //!Raw buffer shared by the buffers created inside init()
     std::vector<octet> common_buffer_;
     //!Creation counter
     std::size_t n_created_ = 0;
-    //!Whether we allow n_created_ to grow beyond the pool_ capacity.
+    //!Whether we allow n_created_ to grow beyond reserved_size_.
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
     std::condition_variable available_cv_;
+    //!Number of threads waiting on available_cv_, or about to.
+    std::atomic<uint32_t> n_waiting_{0};
+    //!Pool exhaustion counters
+    std::atomic<uint64_t> n_exhausted_{0};
+    std::atomic<uint64_t> n_waits_{0};
 };
 
 } /* namespace rtps */
@@ -56,7 +56,8 @@ bool RTPSMessageCreator::addSubmessageData(
         const EntityId_t& readerId,
         bool expectsInlineQos,
         InlineQosWriter* inlineQos,
-        bool* is_big_submessage)
+        bool* is_big_submessage,
+        bool copy_data)
 {
     octet flags = 0x0;
     //Find out flags
@@ -179,9 +180,18 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     //Add Serialized Payload
+    uint32_t not_copied_size = 0;
     if (dataFlag)
     {
-        added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data, change->serializedPayload.length);
+        if (copy_data)
+        {
+            added_no_error &= CDRMessage::addData(msg, change->serializedPayload.data,
+                            change->serializedPayload.length);
+        }
+        else
+        {
+            not_copied_size = change->serializedPayload.length;
+        }
     }
 
     if (keyFlag)
@@ -205,10 +215,18 @@ bool RTPSMessageCreator::addSubmessageData(
     }
 
     // Align submessage to rtps alignment (4).
-    uint32_t align = (4 - msg->pos % 4) & 3;
-    for (uint32_t count = 0; count < align; ++count)
+    // When the payload is not copied, the caller adds the alignment after it.
+    uint32_t align = (4 - (msg->pos + not_copied_size) % 4) & 3;
+    if (copy_data)
+    {
+        for (uint32_t count = 0; count < align; ++count)
+        {
+            added_no_error &= CDRMessage::addOctet(msg, 0);
+        }
+    }
+    else
     {
-        added_no_error &= CDRMessage::addOctet(msg, 0);
+        not_copied_size += align;
     }
 
     //if(align > 0)
@@ -217,7 +235,7 @@ bool RTPSMessageCreator::addSubmessageData(
         //submsgElem.length += align;
     }
 
-    uint32_t size32 = msg->pos - position_size_count_size;
+    uint32_t size32 = msg->pos - position_size_count_size + not_copied_size;
     if (size32 <= std::numeric_limits<uint16_t>::max())
     {
         submessage_size = static_cast<uint16_t>(size32);
@@ -288,7 +306,8 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
         TopicKind_t topicKind,
         const EntityId_t& readerId,
         bool expectsInlineQos,
-        InlineQosWriter* inlineQos)
+        InlineQosWriter* inlineQos,
+        bool copy_data)
 {
     octet flags = 0x0;
     //Find out flags
@@ -419,9 +438,17 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
     }
 
     //Add Serialized Payload XXX TODO
+    uint32_t not_copied_size = 0;
     if (!keyFlag) // keyflag = 0 means that the serializedPayload SubmessageElement contains the serialized Data
     {
-        added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        if (copy_data)
+        {
+            added_no_error &= CDRMessage::addData(msg, payload.data, payload.length);
+        }
+        else
+        {
+            not_copied_size = payload.length;
+        }
     }
     else
     {
@@ -444,10 +471,14 @@ bool RTPSMessageCreator::addSubmessageDataFrag(
 
     // TODO(Ricardo) This should be on cachechange.
     // Align submessage to rtps alignment (4).
-    submessage_size = uint16_t(msg->pos - position_size_count_size);
+    // When the payload is not copied, the caller adds the alignment after it.
+    submessage_size = uint16_t(msg->pos - position_size_count_size + not_copied_size);
     for (; submessage_size& 3; ++submessage_size)
     {
-        added_no_error &= CDRMessage::addOctet(msg, 0);
+        if (copy_data)
+        {
+            added_no_error &= CDRMessage::addOctet(msg, 0);
+        }
     }
 
     //TODO(Ricardo) Improve.
@@ -166,6 +166,12 @@ bool NetworkFactory::transform_remote_locator(
 void NetworkFactory::select_locators(
         LocatorSelector& selector) const
 {
+    // The selection only depends on the enabled entries and their locators
+    if (selector.restore_selection())
+    {
+        return;
+    }
+
     selector.selection_start();
 
     /* - for each transport:
@@ -177,6 +183,8 @@ void NetworkFactory::select_locators(
     {
         transport->select_locators(selector);
     }
+
+    selector.store_selection();
 }
 
 bool NetworkFactory::is_local_locator(
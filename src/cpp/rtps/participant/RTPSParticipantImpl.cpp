@@ -22,6 +22,7 @@
 #include <rtps/flowcontrol/ThroughputController.h>
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/history/BasicPayloadPool.hpp>
+#include <rtps/resources/SharedThreadPools.hpp>
 
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
@@ -121,7 +122,24 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_mutex(new std::recursive_mutex())
     , is_intraprocess_only_(should_be_intraprocess_only(PParam))
     , has_shm_transport_(false)
+    , wlp_(nullptr)
+    , typelookup_manager_(nullptr)
 {
+    const fastdds::rtps::SharedThreadPoolsSettings& thread_pools =
+            xmlparser::XMLProfileManager::library_settings().thread_pools;
+    if (thread_pools.enabled)
+    {
+        thread_pools_ = SharedThreadPools::get(thread_pools);
+        mp_event_thr = thread_pools_->event_resource();
+        async_thread_ = thread_pools_->async_writer_thread();
+    }
+    else
+    {
+        mp_event_thr = std::make_shared<ResourceEvent>();
+        mp_event_thr->init_thread();
+        async_thread_ = std::make_shared<AsyncWriterThread>();
+    }
+
     // Builtin transports by default
     if (PParam.useBuiltinTransports)
     {
@@ -198,7 +216,6 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
 
     if (!networkFactoryHasRegisteredTransports())
     {
@@ -401,6 +418,11 @@ void RTPSParticipantImpl::disable()
         block.disable();
     }
 
+#if HAVE_SECURITY
+    // Handshake steps use the builtin endpoints, so they should finish before those are destroyed.
+    m_security_manager.stop_handshake_workers();
+#endif // if HAVE_SECURITY
+
     while (m_userReaderList.size() > 0)
     {
         deleteUserEndpoint(static_cast<Endpoint*>(*m_userReaderList.begin()));
@@ -1487,9 +1509,10 @@ bool RTPSParticipantImpl::pairing_remote_reader_with_local_writer_after_security
 
     return_value = mp_builtinProtocols->mp_PDP->getEDP()->pairing_remote_reader_with_local_writer_after_security(
         local_writer, remote_reader_data);
-    if (!return_value && mp_builtinProtocols->mp_WLP != nullptr)
+    WLP* wlp = this->wlp();
+    if (!return_value && wlp != nullptr)
     {
-        return_value = mp_builtinProtocols->mp_WLP->pairing_remote_reader_with_local_writer_after_security(
+        return_value = wlp->pairing_remote_reader_with_local_writer_after_security(
             local_writer, remote_reader_data);
     }
 
@@ -1504,9 +1527,10 @@ bool RTPSParticipantImpl::pairing_remote_writer_with_local_reader_after_security
 
     return_value = mp_builtinProtocols->mp_PDP->getEDP()->pairing_remote_writer_with_local_reader_after_security(
         local_reader, remote_writer_data);
-    if (!return_value && mp_builtinProtocols->mp_WLP != nullptr)
+    WLP* wlp = this->wlp();
+    if (!return_value && wlp != nullptr)
     {
-        return_value = mp_builtinProtocols->mp_WLP->pairing_remote_writer_with_local_reader_after_security(
+        return_value = wlp->pairing_remote_writer_with_local_reader_after_security(
             local_reader, remote_writer_data);
     }
 
@@ -1568,12 +1592,12 @@ PDPSimple* RTPSParticipantImpl::pdpsimple()
 
 WLP* RTPSParticipantImpl::wlp()
 {
-    return mp_builtinProtocols->mp_WLP;
+    return wlp_.load(std::memory_order_acquire);
 }
 
 fastdds::dds::builtin::TypeLookupManager* RTPSParticipantImpl::typelookup_manager() const
 {
-    return mp_builtinProtocols->tlm_;
+    return mp_builtinProtocols->typelookup_manager();
 }
 
 IPersistenceService* RTPSParticipantImpl::get_persistence_service(
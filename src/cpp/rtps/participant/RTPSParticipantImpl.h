@@ -78,6 +78,7 @@ namespace rtps {
 class RTPSParticipant;
 class RTPSParticipantListener;
 class BuiltinProtocols;
+class SharedThreadPools;
 struct CDRMessage_t;
 class Endpoint;
 class RTPSWriter;
@@ -243,12 +244,13 @@ public:
     //!Get Pointer to the Event Resource.
     ResourceEvent& getEventResource()
     {
-        return mp_event_thr;
+        return *mp_event_thr;
     }
 
     /**
      * Send a message to several locations
-     * @param msg Message to send.
+     * @param buffers Slices of the message to send, in order.
+     * @param total_bytes Sum of the sizes of all the buffers.
      * @param destination_locators_begin Iterator at the first destination locator.
      * @param destination_locators_end Iterator at the end destination locator.
      * @param max_blocking_time_point execution time limit timepoint.
@@ -256,7 +258,8 @@ public:
      */
     template<class LocatorIteratorT>
     bool sendSync(
-            CDRMessage_t* msg,
+            const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+            uint32_t total_bytes,
             const LocatorIteratorT& destination_locators_begin,
             const LocatorIteratorT& destination_locators_end,
             std::chrono::steady_clock::time_point& max_blocking_time_point)
@@ -272,7 +275,7 @@ public:
             {
                 LocatorIteratorT locators_begin = destination_locators_begin;
                 LocatorIteratorT locators_end = destination_locators_end;
-                send_resource->send(msg->buffer, msg->length, &locators_begin, &locators_end,
+                send_resource->send(buffers, total_bytes, &locators_begin, &locators_end,
                         max_blocking_time_point);
             }
         }
@@ -389,6 +392,35 @@ public:
 
     fastdds::dds::builtin::TypeLookupManager* typelookup_manager() const;
 
+    /**
+     * Get the TypeLookupManager without creating it when its creation was deferred.
+     * @return Pointer to the TypeLookupManager, or nullptr if it was not created.
+     */
+    fastdds::dds::builtin::TypeLookupManager* existing_typelookup_manager() const
+    {
+        return typelookup_manager_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Publish the WLP of the participant once it is fully initialized.
+     * @param wlp Pointer to the WLP.
+     */
+    void set_wlp(
+            WLP* wlp)
+    {
+        wlp_.store(wlp, std::memory_order_release);
+    }
+
+    /**
+     * Publish the TypeLookupManager of the participant once it is fully initialized.
+     * @param manager Pointer to the TypeLookupManager.
+     */
+    void set_typelookup_manager(
+            fastdds::dds::builtin::TypeLookupManager* manager)
+    {
+        typelookup_manager_.store(manager, std::memory_order_release);
+    }
+
     bool is_intraprocess_only() const
     {
         return is_intraprocess_only_;
@@ -411,7 +443,7 @@ public:
 
     AsyncWriterThread& async_thread()
     {
-        return async_thread_;
+        return *async_thread_;
     }
 
     /***
@@ -471,8 +503,10 @@ private:
     GUID_t m_persistence_guid;
     //! Sending resources. - DEPRECATED -Stays commented for reference purposes
     // ResourceSend* mp_send_thr;
+    //! Threads shared with other participants, when enabled
+    std::shared_ptr<SharedThreadPools> thread_pools_;
     //! Event Resource
-    ResourceEvent mp_event_thr;
+    std::shared_ptr<ResourceEvent> mp_event_thr;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Semaphore to wait for the listen thread creation.
@@ -491,7 +525,7 @@ private:
     //!Network Factory
     NetworkFactory m_network_Factory;
     //!Async writer thread
-    AsyncWriterThread async_thread_;
+    std::shared_ptr<AsyncWriterThread> async_thread_;
     //! Type cheking function
     std::function<bool(const std::string&)> type_check_fn_;
     //!Pool of send buffers
@@ -599,6 +633,12 @@ private:
     //! Indicates whether the participant has shared-memory transport
     bool has_shm_transport_;
 
+    //! WLP of the builtin protocols, which may be created after the participant
+    std::atomic<WLP*> wlp_;
+
+    //! TypeLookupManager of the builtin protocols, which may be created after the participant
+    std::atomic<fastdds::dds::builtin::TypeLookupManager*> typelookup_manager_;
+
     /**
      * Get persistence service from factory, using endpoint attributes (or participant
      * attributes if endpoint does not define a persistence service config)
@@ -14,6 +14,7 @@
 
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <utils/threading.hpp>
 
 #include <mutex>
 #include <algorithm>
@@ -109,6 +110,12 @@ void AsyncWriterThread::wake_up(
 
 void AsyncWriterThread::run()
 {
+    if (!thread_name_.empty())
+    {
+        set_thread_name(thread_name_);
+    }
+    apply_thread_settings(thread_settings_);
+
     std::unique_lock<RecursiveTimedMutex> cond_guard(condition_variable_mutex_);
     while(running_)
     {
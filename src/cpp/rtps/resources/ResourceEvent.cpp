@@ -20,6 +20,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include <utils/threading.hpp>
 
 #include <cassert>
 #include <thread>
@@ -35,6 +36,9 @@ static bool event_compare(
     return lhs->next_trigger_time() < rhs->next_trigger_time();
 }
 
+//! Position on active_timers_ of the next timer to be triggered by the event thread running on this thread.
+static thread_local size_t s_next_trigger_position = 0;
+
 ResourceEvent::~ResourceEvent()
 {
     // All timer should be unregistered before destroying this object.
@@ -73,10 +77,16 @@ void ResourceEvent::unregister_timer(
 
     std::unique_lock<TimedMutex> lock(mutex_);
 
-    cv_manipulation_.wait(lock, [&]()
-            {
-                return allow_vector_manipulation_;
-            });
+    // A callback may delete the timers of other entities using this thread, which happens when it is shared among
+    // participants. The collections are not being iterated while a callback runs, so it doesn't have to wait.
+    bool from_callback = std::this_thread::get_id() == thread_.get_id();
+    if (!from_callback)
+    {
+        cv_manipulation_.wait(lock, [&]()
+                {
+                    return allow_vector_manipulation_;
+                });
+    }
 
     bool should_notify = false;
     std::vector<TimedEventImpl*>::iterator it;
@@ -93,6 +103,11 @@ void ResourceEvent::unregister_timer(
     it = std::find(active_timers_.begin(), active_timers_.end(), event);
     if (it != active_timers_.end())
     {
+        // Keep the trigger loop on the same timer
+        if (from_callback && static_cast<size_t>(it - active_timers_.begin()) < s_next_trigger_position)
+        {
+            --s_next_trigger_position;
+        }
         active_timers_.erase(it);
         should_notify = true;
     }
@@ -231,18 +246,20 @@ void ResourceEvent::do_timer_actions()
         pending_timers_.clear();
     }
 
-    // Trigger active timers
-    for (TimedEventImpl* tp : active_timers_)
+    // Trigger active timers. Callbacks may remove timers from active_timers_ (see unregister_timer), so the loop
+    // advances before triggering each timer.
+    s_next_trigger_position = 0;
+    while (s_next_trigger_position < active_timers_.size())
     {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
-        }
-        else
+        TimedEventImpl* tp = active_timers_[s_next_trigger_position];
+        if (tp->next_trigger_time() > current_time_)
         {
             break;
         }
+
+        did_something = true;
+        ++s_next_trigger_position;
+        tp->trigger(current_time_, cancel_time);
     }
 
     // If an action was made, keep active_timers_ sorted
@@ -273,6 +290,27 @@ void ResourceEvent::init_thread()
     thread_ = std::thread(&ResourceEvent::event_service, this);
 }
 
+void ResourceEvent::init_thread(
+        const fastdds::rtps::ThreadSettings& settings,
+        const std::string& name)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    allow_vector_manipulation_ = false;
+    resize_collections();
+
+    thread_ = std::thread(&ResourceEvent::configured_event_service, this, settings, name);
+}
+
+void ResourceEvent::configured_event_service(
+        const fastdds::rtps::ThreadSettings& settings,
+        const std::string& name)
+{
+    set_thread_name(name);
+    apply_thread_settings(settings);
+    event_service();
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
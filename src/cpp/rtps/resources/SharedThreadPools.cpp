@@ -0,0 +1,91 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedThreadPools.cpp
+ */
+
+#include "SharedThreadPools.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+std::shared_ptr<SharedThreadPools> SharedThreadPools::get(
+        const fastdds::rtps::SharedThreadPoolsSettings& settings)
+{
+    static std::mutex instance_mutex;
+    static std::weak_ptr<SharedThreadPools> instance;
+
+    std::lock_guard<std::mutex> guard(instance_mutex);
+    std::shared_ptr<SharedThreadPools> ret_val = instance.lock();
+    if (!ret_val)
+    {
+        ret_val = std::make_shared<SharedThreadPools>(settings);
+        instance = ret_val;
+    }
+    return ret_val;
+}
+
+SharedThreadPools::SharedThreadPools(
+        const fastdds::rtps::SharedThreadPoolsSettings& settings)
+{
+    uint32_t num_event_threads = std::max(1u, settings.timed_events.num_threads);
+    for (uint32_t i = 0; i < num_event_threads; ++i)
+    {
+        std::shared_ptr<ResourceEvent> event_resource = std::make_shared<ResourceEvent>();
+        event_resource->init_thread(settings.timed_events.thread, "dds.ev." + std::to_string(i));
+        event_resources_.push_back(event_resource);
+    }
+
+    // Asynchronous writer threads are only started while there are writers to serve
+    uint32_t num_async_threads = std::max(1u, settings.async_writers.num_threads);
+    for (uint32_t i = 0; i < num_async_threads; ++i)
+    {
+        async_writer_threads_.push_back(std::make_shared<AsyncWriterThread>(
+                    settings.async_writers.thread, "dds.async." + std::to_string(i)));
+    }
+}
+
+std::shared_ptr<ResourceEvent> SharedThreadPools::event_resource()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return least_used(event_resources_);
+}
+
+std::shared_ptr<AsyncWriterThread> SharedThreadPools::async_writer_thread()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return least_used(async_writer_threads_);
+}
+
+template<typename T>
+std::shared_ptr<T> SharedThreadPools::least_used(
+        const std::vector<std::shared_ptr<T>>& threads)
+{
+    // References are only taken while holding the mutex, so use_count is the number of participants plus the pool
+    auto it = std::min_element(threads.begin(), threads.end(),
+                    [](const std::shared_ptr<T>& a, const std::shared_ptr<T>& b)
+                    {
+                        return a.use_count() < b.use_count();
+                    });
+    return *it;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
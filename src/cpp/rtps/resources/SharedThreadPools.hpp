@@ -0,0 +1,79 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedThreadPools.hpp
+ */
+
+#ifndef _RTPS_RESOURCES_SHAREDTHREADPOOLS_HPP_
+#define _RTPS_RESOURCES_SHAREDTHREADPOOLS_HPP_
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/resources/AsyncWriterThread.h>
+#include <fastdds/rtps/resources/ResourceEvent.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Pools of threads shared by the participants of the process.
+ *
+ * Each participant takes the timed events thread and the asynchronous writers thread used by the fewest
+ * participants. Participants keep a reference to the pools and to the threads they use, so the threads live until
+ * the last participant using them is destroyed.
+ */
+class SharedThreadPools
+{
+public:
+
+    /**
+     * Get the pools of the process, creating them if no participant is using them.
+     * @param settings Settings used to create the pools. Ignored when the pools already exist.
+     * @return The pools of the process.
+     */
+    static std::shared_ptr<SharedThreadPools> get(
+            const fastdds::rtps::SharedThreadPoolsSettings& settings);
+
+    explicit SharedThreadPools(
+            const fastdds::rtps::SharedThreadPoolsSettings& settings);
+
+    //! Take the timed events thread with less participants.
+    std::shared_ptr<ResourceEvent> event_resource();
+
+    //! Take the asynchronous writers thread with less participants.
+    std::shared_ptr<AsyncWriterThread> async_writer_thread();
+
+private:
+
+    template<typename T>
+    static std::shared_ptr<T> least_used(
+            const std::vector<std::shared_ptr<T>>& threads);
+
+    std::mutex mutex_;
+
+    std::vector<std::shared_ptr<ResourceEvent>> event_resources_;
+
+    std::vector<std::shared_ptr<AsyncWriterThread>> async_writer_threads_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif // _RTPS_RESOURCES_SHAREDTHREADPOOLS_HPP_
@@ -0,0 +1,271 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file HandshakeWorkerPool.hpp
+ */
+#ifndef _RTPS_SECURITY_HANDSHAKEWORKERPOOL_HPP_
+#define _RTPS_SECURITY_HANDSHAKEWORKERPOOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/*!
+ * Threads running the authentication handshake steps of every participant of the process, so the expensive
+ * operations of the authentication plugin do not block the threads receiving the handshake messages.
+ *
+ * The pool is created by the first participant using it, with the number of threads that participant asks for,
+ * and destroyed with the last one.
+ */
+class HandshakeWorkerPool
+{
+public:
+
+    using Task = std::function<void ()>;
+
+    //! Get the pool of the process, creating it with num_threads threads if no participant is using it.
+    static std::shared_ptr<HandshakeWorkerPool> get(
+            uint32_t num_threads)
+    {
+        static std::mutex instance_mutex;
+        static std::weak_ptr<HandshakeWorkerPool> instance;
+
+        std::lock_guard<std::mutex> guard(instance_mutex);
+        std::shared_ptr<HandshakeWorkerPool> ret_val = instance.lock();
+        if (!ret_val)
+        {
+            ret_val = std::make_shared<HandshakeWorkerPool>(num_threads);
+            instance = ret_val;
+        }
+        return ret_val;
+    }
+
+    explicit HandshakeWorkerPool(
+            uint32_t num_threads)
+    {
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            threads_.emplace_back(&HandshakeWorkerPool::run, this);
+        }
+    }
+
+    ~HandshakeWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+            cv_.notify_all();
+        }
+
+        for (std::thread& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    uint32_t num_threads() const
+    {
+        return static_cast<uint32_t>(threads_.size());
+    }
+
+    void post(
+            Task&& task)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+        cv_.notify_one();
+    }
+
+private:
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            cv_.wait(lock, [this]()
+                    {
+                        return !running_ || !tasks_.empty();
+                    });
+
+            if (!running_)
+            {
+                break;
+            }
+
+            Task task = std::move(tasks_.front());
+            tasks_.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Task> tasks_;
+    std::vector<std::thread> threads_;
+    bool running_ = true;
+};
+
+/*!
+ * Handshake steps of a participant, run on the HandshakeWorkerPool of the process.
+ *
+ * Jobs receive whether they were cancelled. A job is cancelled when the workers are stopped before the job
+ * started, and it is then called on the thread stopping the workers, so it can release what it holds.
+ */
+class HandshakeWorkers
+{
+public:
+
+    using Job = std::function<void (bool cancelled)>;
+
+    HandshakeWorkers() = default;
+
+    ~HandshakeWorkers()
+    {
+        stop();
+    }
+
+    //! Start running the jobs on the pool of the process. Jobs are not accepted when num_threads is zero.
+    void start(
+            uint32_t num_threads)
+    {
+        if (num_threads > 0)
+        {
+            pool_ = HandshakeWorkerPool::get(num_threads);
+        }
+
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->running = static_cast<bool>(pool_);
+    }
+
+    /*!
+     * Queue a job.
+     * @return false when the workers are not running, in which case the job is not queued.
+     */
+    bool post(
+            Job&& job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (!state_->running)
+            {
+                return false;
+            }
+            state_->jobs.push_back(std::move(job));
+        }
+
+        // The task keeps the state, as the pool may run it after this participant is destroyed
+        std::shared_ptr<State> state = state_;
+        pool_->post([state]()
+                {
+                    state->run_one();
+                });
+        return true;
+    }
+
+    //! Wait for the running jobs to finish and cancel the queued ones.
+    void stop()
+    {
+        std::deque<Job> cancelled;
+
+        {
+            std::unique_lock<std::mutex> lock(state_->mutex);
+            state_->running = false;
+            state_->stopping = true;
+            cancelled.swap(state_->jobs);
+            state_->idle_cv.wait(lock, [this]()
+                    {
+                        return 0u == state_->running_jobs;
+                    });
+        }
+
+        for (Job& job : cancelled)
+        {
+            job(true);
+        }
+    }
+
+    //! Whether stop() has been called, so no more handshake steps should be started.
+    bool stopping() const
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->stopping;
+    }
+
+    //! The pool running the jobs, or nullptr when they run on the calling thread.
+    const HandshakeWorkerPool* pool() const
+    {
+        return pool_.get();
+    }
+
+private:
+
+    struct State
+    {
+        void run_one()
+        {
+            Job job;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (jobs.empty())
+                {
+                    // Cancelled
+                    return;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+                ++running_jobs;
+            }
+
+            job(false);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                --running_jobs;
+            }
+            idle_cv.notify_all();
+        }
+
+        std::mutex mutex;
+        std::condition_variable idle_cv;
+        std::deque<Job> jobs;
+        uint32_t running_jobs = 0;
+        bool running = false;
+        bool stopping = false;
+    };
+
+    std::shared_ptr<State> state_ = std::make_shared<State>();
+    std::shared_ptr<HandshakeWorkerPool> pool_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // _RTPS_SECURITY_HANDSHAKEWORKERPOOL_HPP_
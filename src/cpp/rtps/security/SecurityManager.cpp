@@ -47,8 +47,10 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
 #include <mutex>
 
@@ -94,6 +96,7 @@ SecurityManager::SecurityManager(
     , access_plugin_(nullptr)
     , crypto_plugin_(nullptr)
     , domain_id_(0)
+    , handshake_threads_(0)
     , local_identity_handle_(nullptr)
     , local_permissions_handle_(nullptr)
     , local_participant_crypto_handle_(nullptr)
@@ -220,6 +223,17 @@ bool SecurityManager::init(
     {
         authentication_plugin_->set_logger(logging_plugin_, exception);
 
+        // Handshakes with different participants are independent, so a few threads are enough to keep the
+        // receiving thread free while bringing up many participants at once. The threads are shared by all the
+        // participants of the process.
+        handshake_threads_ = std::min(std::max(std::thread::hardware_concurrency(), 1u), 2u);
+        const std::string* handshake_threads = PropertyPolicyHelper::find_property(participant_properties,
+                        "dds.sec.auth.handshake_threads");
+        if (handshake_threads != nullptr)
+        {
+            handshake_threads_ = static_cast<uint32_t>(std::strtoul(handshake_threads->c_str(), nullptr, 10));
+        }
+
         // Validate local participant
         GUID_t adjusted_participant_key;
         ValidationResult_t ret = VALIDATION_FAILED;
@@ -419,10 +433,18 @@ void SecurityManager::cancel_init()
     authentication_plugin_ = nullptr;
 }
 
+void SecurityManager::stop_handshake_workers()
+{
+    handshake_workers_.stop();
+}
+
 void SecurityManager::destroy()
 {
     if (authentication_plugin_ != nullptr)
     {
+        // Cancelled handshakes restore their participant info, so it is released below.
+        handshake_workers_.stop();
+
         mutex_.lock();
 
         for (auto& local_reader : reader_handles_)
@@ -479,6 +501,7 @@ void SecurityManager::destroy()
         }
 
         discovered_participants_.clear();
+        deferred_handshake_messages_.clear();
 
         if (local_participant_crypto_handle_ != nullptr)
         {
@@ -551,18 +574,41 @@ bool SecurityManager::restore_discovered_participant_info(
 {
     SecurityException exception;
     bool returned_value = false;
+    ParticipantGenericMessage deferred_message;
+    bool has_deferred_message = false;
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    auto dp_it = discovered_participants_.find(remote_participant_key);
-
-    if (dp_it != discovered_participants_.end())
     {
-        dp_it->second.set_auth(auth_ptr);
-        returned_value = true;
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto dp_it = discovered_participants_.find(remote_participant_key);
+
+        if (dp_it != discovered_participants_.end())
+        {
+            dp_it->second.set_auth(auth_ptr);
+            returned_value = true;
+
+            auto deferred_it = deferred_handshake_messages_.find(remote_participant_key);
+            if (deferred_it != deferred_handshake_messages_.end())
+            {
+                // Messages are dropped while stopping, as this may be the thread disabling the participant
+                if (!handshake_workers_.stopping())
+                {
+                    deferred_message = std::move(deferred_it->second);
+                    has_deferred_message = true;
+                }
+                deferred_handshake_messages_.erase(deferred_it);
+            }
+        }
+        else
+        {
+            remove_discovered_participant_info(std::move(auth_ptr));
+        }
     }
-    else
+
+    // A handshake message arrived while the participant info was in use. Process it now instead of waiting
+    // for the remote participant to resend it.
+    if (has_deferred_message)
     {
-        remove_discovered_participant_info(std::move(auth_ptr));
+        process_authentication_message(deferred_message);
     }
 
     return returned_value;
@@ -643,6 +689,7 @@ bool SecurityManager::discovered_participant(
                 // Remove created element, because authentication failed.
                 mutex_.lock();
                 discovered_participants_.erase(participant_data.m_guid);
+                deferred_handshake_messages_.erase(participant_data.m_guid);
                 mutex_.unlock();
 
                 logInfo(SECURITY, "Authentication failed for participant " <<
@@ -689,18 +736,16 @@ bool SecurityManager::discovered_participant(
         }
     }
 
-    bool returnedValue = true;
-
     if (remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND)
     {
         // Maybe send request.
-        returnedValue = on_process_handshake(participant_data, remote_participant_info,
-                        MessageIdentity(), HandshakeMessageToken());
+        return dispatch_handshake(participant_data, remote_participant_info,
+                       MessageIdentity(), HandshakeMessageToken());
     }
 
     restore_discovered_participant_info(participant_data.m_guid, remote_participant_info);
 
-    return returnedValue;
+    return true;
 }
 
 void SecurityManager::remove_participant(
@@ -739,6 +784,7 @@ void SecurityManager::remove_participant(
         remove_discovered_participant_info(dp_it->second.get_auth());
 
         discovered_participants_.erase(dp_it);
+        deferred_handshake_messages_.erase(participant_data.m_guid);
     }
 }
 
@@ -946,12 +992,71 @@ bool SecurityManager::on_process_handshake(
     return returnedValue;
 }
 
+bool SecurityManager::dispatch_handshake(
+        const ParticipantProxyData& participant_data,
+        DiscoveredParticipantInfo::AuthUniquePtr& remote_participant_info,
+        MessageIdentity&& message_identity,
+        HandshakeMessageToken&& message)
+{
+    // std::function needs a copyable callable, so the step is shared with the job.
+    struct HandshakeStep
+    {
+        HandshakeStep(
+                const ParticipantProxyData& data)
+            : participant_data(data)
+        {
+        }
+
+        ParticipantProxyData participant_data;
+        DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
+        MessageIdentity message_identity;
+        HandshakeMessageToken message;
+    };
+
+    if (handshake_threads_ > 0)
+    {
+        // The participant data is copied, as the discovered participant may be removed while the step is queued.
+        std::shared_ptr<HandshakeStep> step = std::make_shared<HandshakeStep>(participant_data);
+        step->remote_participant_info = std::move(remote_participant_info);
+        step->message_identity = std::move(message_identity);
+        step->message = std::move(message);
+
+        bool posted = handshake_workers_.post([this, step](bool cancelled)
+                        {
+                            if (!cancelled)
+                            {
+                                on_process_handshake(step->participant_data, step->remote_participant_info,
+                                std::move(step->message_identity), std::move(step->message));
+                            }
+
+                            restore_discovered_participant_info(step->participant_data.m_guid,
+                            step->remote_participant_info);
+                        });
+
+        if (posted)
+        {
+            return true;
+        }
+
+        // Workers already stopped
+        remote_participant_info = std::move(step->remote_participant_info);
+        message_identity = std::move(step->message_identity);
+        message = std::move(step->message);
+    }
+
+    bool returned_value = on_process_handshake(participant_data, remote_participant_info,
+                    std::move(message_identity), std::move(message));
+    restore_discovered_participant_info(participant_data.m_guid, remote_participant_info);
+    return returned_value;
+}
+
 bool SecurityManager::create_entities()
 {
     if (create_participant_stateless_message_entities())
     {
         if (crypto_plugin_ == nullptr || create_participant_volatile_message_secure_entities())
         {
+            handshake_workers_.start(handshake_threads_);
             logInfo(SECURITY, "Initialized security manager for participant " << participant_->getGuid());
             return true;
         }
@@ -1384,148 +1489,97 @@ void SecurityManager::process_participant_stateless_message(
 
     if (message.message_class_id().compare(AUTHENTICATION_PARTICIPANT_STATELESS_MESSAGE) == 0)
     {
-        if (message.message_identity().source_guid() == GUID_t::unknown())
-        {
-            logInfo(SECURITY, "Bad ParticipantGenericMessage. message_identity.source_guid is GUID_t::unknown()");
-            return;
-        }
-        if (message.destination_participant_key() != participant_->getGuid())
-        {
-            logInfo(SECURITY, "Destination of ParticipantGenericMessage is not me");
-            return;
-        }
-        if (message.destination_endpoint_key() != GUID_t::unknown())
-        {
-            logInfo(SECURITY, "Bad ParticipantGenericMessage. destination_endpoint_key is not GUID_t::unknown()");
-            return;
-        }
-        if (message.source_endpoint_key() != GUID_t::unknown())
-        {
-            logInfo(SECURITY, "Bad ParticipantGenericMessage. source_endpoint_key is not GUID_t::unknown()");
-            return;
-        }
+        process_authentication_message(message);
+    }
+    else
+    {
+        logInfo(SECURITY, "Discarted ParticipantGenericMessage with class id " << message.message_class_id());
+    }
+}
 
-        const GUID_t remote_participant_key(message.message_identity().source_guid().guidPrefix,
-                c_EntityId_RTPSParticipant);
-        DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
-        const ParticipantProxyData* participant_data = nullptr;
+void SecurityManager::process_authentication_message(
+        ParticipantGenericMessage& message)
+{
+    if (message.message_identity().source_guid() == GUID_t::unknown())
+    {
+        logInfo(SECURITY, "Bad ParticipantGenericMessage. message_identity.source_guid is GUID_t::unknown()");
+        return;
+    }
+    if (message.destination_participant_key() != participant_->getGuid())
+    {
+        logInfo(SECURITY, "Destination of ParticipantGenericMessage is not me");
+        return;
+    }
+    if (message.destination_endpoint_key() != GUID_t::unknown())
+    {
+        logInfo(SECURITY, "Bad ParticipantGenericMessage. destination_endpoint_key is not GUID_t::unknown()");
+        return;
+    }
+    if (message.source_endpoint_key() != GUID_t::unknown())
+    {
+        logInfo(SECURITY, "Bad ParticipantGenericMessage. source_endpoint_key is not GUID_t::unknown()");
+        return;
+    }
 
-        mutex_.lock();
-        auto dp_it = discovered_participants_.find(remote_participant_key);
-        if (dp_it != discovered_participants_.end())
+    const GUID_t remote_participant_key(message.message_identity().source_guid().guidPrefix,
+            c_EntityId_RTPSParticipant);
+    DiscoveredParticipantInfo::AuthUniquePtr remote_participant_info;
+    const ParticipantProxyData* participant_data = nullptr;
+
+    mutex_.lock();
+    auto dp_it = discovered_participants_.find(remote_participant_key);
+    if (dp_it != discovered_participants_.end())
+    {
+        remote_participant_info = dp_it->second.get_auth();
+        participant_data = &(dp_it->second.participant_data());
+
+        if (!remote_participant_info)
         {
-            remote_participant_info = dp_it->second.get_auth();
-            participant_data = &(dp_it->second.participant_data());
+            // Another thread is processing a handshake step with this participant. Keep the message until
+            // it finishes.
+            logInfo(SECURITY, "Deferred Authentication message from participant " << remote_participant_key);
+            deferred_handshake_messages_[remote_participant_key] = std::move(message);
+            mutex_.unlock();
+            return;
         }
-        mutex_.unlock();
+    }
+    mutex_.unlock();
 
-        if (remote_participant_info && participant_data)
+    if (remote_participant_info && participant_data)
+    {
+        if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REQUEST)
         {
-            if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REQUEST)
-            {
-                assert(!remote_participant_info->handshake_handle_);
+            assert(!remote_participant_info->handshake_handle_);
 
-                // Preconditions
-                if (message.related_message_identity().source_guid() != GUID_t::unknown())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not GUID_t::unknown()");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-            }
-            else if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REPLY ||
-                    remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
+            // Preconditions
+            if (message.related_message_identity().source_guid() != GUID_t::unknown())
             {
-                assert(remote_participant_info->handshake_handle_);
-
-                if (message.related_message_identity().source_guid() == GUID_t::unknown() &&
-                        remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
-                {
-                    // Maybe the reply was missed. Resent.
-                    if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
-                    {
-                        // Remove previous change and send a new one.
-                        CacheChange_t* p_change =
-                                participant_stateless_message_writer_history_->remove_change_and_reuse(
-                            remote_participant_info->change_sequence_number_);
-                        remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
-
-                        if (p_change != nullptr)
-                        {
-                            if (participant_stateless_message_writer_history_->add_change(p_change))
-                            {
-                                remote_participant_info->change_sequence_number_ = p_change->sequenceNumber;
-                            }
-                            //TODO (Ricardo) What to do if not added?
-                        }
-
-                        restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                        return;
-                    }
-                }
-
-                // Preconditions
-                if (message.related_message_identity().source_guid()
-                        != participant_stateless_message_writer_->getGuid())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.related_message_identity().sequence_number()
-                        != remote_participant_info->expected_sequence_number_)
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not GUID_t::unknown()");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
             }
-            else if (remote_participant_info->auth_status_ == AUTHENTICATION_OK)
+            if (message.message_data().size() != 1)
             {
-                // Preconditions
-                if (message.related_message_identity().source_guid()
-                        != participant_stateless_message_writer_->getGuid())
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.related_message_identity().sequence_number()
-                        != remote_participant_info->expected_sequence_number_)
-                {
-                    logInfo(SECURITY,
-                            "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
-                if (message.message_data().size() != 1)
-                {
-                    logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
-                    restore_discovered_participant_info(remote_participant_key, remote_participant_info);
-                    return;
-                }
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+        }
+        else if (remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REPLY ||
+                remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
+        {
+            assert(remote_participant_info->handshake_handle_);
 
-                // Maybe final message was missed. Resent.
+            if (message.related_message_identity().source_guid() == GUID_t::unknown() &&
+                    remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_FINAL)
+            {
+                // Maybe the reply was missed. Resent.
                 if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
                 {
                     // Remove previous change and send a new one.
-                    CacheChange_t* p_change = participant_stateless_message_writer_history_->remove_change_and_reuse(
+                    CacheChange_t* p_change =
+                            participant_stateless_message_writer_history_->remove_change_and_reuse(
                         remote_participant_info->change_sequence_number_);
                     remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
 
@@ -1542,25 +1596,90 @@ void SecurityManager::process_participant_stateless_message(
                     return;
                 }
             }
-            else
+
+            // Preconditions
+            if (message.related_message_identity().source_guid()
+                    != participant_stateless_message_writer_->getGuid())
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.related_message_identity().sequence_number()
+                    != remote_participant_info->expected_sequence_number_)
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.message_data().size() != 1)
+            {
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+        }
+        else if (remote_participant_info->auth_status_ == AUTHENTICATION_OK)
+        {
+            // Preconditions
+            if (message.related_message_identity().source_guid()
+                    != participant_stateless_message_writer_->getGuid())
+            {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.source_guid is not mine");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.related_message_identity().sequence_number()
+                    != remote_participant_info->expected_sequence_number_)
             {
+                logInfo(SECURITY,
+                        "Bad ParticipantGenericMessage. related_message_identity.sequence_number is not expected");
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
+            if (message.message_data().size() != 1)
+            {
+                logInfo(SECURITY, "Bad ParticipantGenericMessage. message_data size is not 1");
                 restore_discovered_participant_info(remote_participant_key, remote_participant_info);
                 return;
             }
 
-            on_process_handshake(*participant_data, remote_participant_info,
-                    std::move(message.message_identity()), std::move(message.message_data().at(0)));
+            // Maybe final message was missed. Resent.
+            if (remote_participant_info->change_sequence_number_ != SequenceNumber_t::unknown())
+            {
+                // Remove previous change and send a new one.
+                CacheChange_t* p_change = participant_stateless_message_writer_history_->remove_change_and_reuse(
+                    remote_participant_info->change_sequence_number_);
+                remote_participant_info->change_sequence_number_ = SequenceNumber_t::unknown();
 
-            restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                if (p_change != nullptr)
+                {
+                    if (participant_stateless_message_writer_history_->add_change(p_change))
+                    {
+                        remote_participant_info->change_sequence_number_ = p_change->sequenceNumber;
+                    }
+                    //TODO (Ricardo) What to do if not added?
+                }
+
+                restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+                return;
+            }
         }
         else
         {
-            logInfo(SECURITY, "Received Authentication message but not found related remote_participant_key");
+            restore_discovered_participant_info(remote_participant_key, remote_participant_info);
+            return;
         }
+
+        dispatch_handshake(*participant_data, remote_participant_info,
+                std::move(message.message_identity()), std::move(message.message_data().at(0)));
     }
     else
     {
-        logInfo(SECURITY, "Discarted ParticipantGenericMessage with class id " << message.message_class_id());
+        logInfo(SECURITY, "Received Authentication message but not found related remote_participant_key");
     }
 }
 
@@ -19,6 +19,7 @@
 #define _RTPS_SECURITY_SECURITYMANAGER_H_
 
 #include <rtps/security/SecurityPluginFactory.h>
+#include <rtps/security/HandshakeWorkerPool.hpp>
 
 #include <fastdds/rtps/security/authentication/Handshake.h>
 #include <fastdds/rtps/security/common/ParticipantGenericMessage.h>
@@ -74,6 +75,13 @@ public:
 
     bool create_entities();
 
+    /*!
+     * Stop processing authentication handshakes on the worker threads.
+     * Called before the builtin protocols are destroyed. Handshake steps received afterwards are processed
+     * on the receiving thread.
+     */
+    void stop_handshake_workers();
+
     void destroy();
 
     bool discovered_participant(
@@ -484,6 +492,9 @@ private:
     void process_participant_stateless_message(
             const CacheChange_t* const change);
 
+    void process_authentication_message(
+            ParticipantGenericMessage& message);
+
     void process_participant_volatile_message_secure(
             const CacheChange_t* const change);
 
@@ -493,6 +504,16 @@ private:
             MessageIdentity&& message_identity,
             HandshakeMessageToken&& message);
 
+    /*!
+     * Run a handshake step on the worker threads, or on the calling thread when they are not running.
+     * Takes ownership of remote_participant_info, which is restored once the step is processed.
+     */
+    bool dispatch_handshake(
+            const ParticipantProxyData& participant_data,
+            DiscoveredParticipantInfo::AuthUniquePtr& remote_participant_info,
+            MessageIdentity&& message_identity,
+            HandshakeMessageToken&& message);
+
     ParticipantGenericMessage generate_authentication_message(
             const MessageIdentity& related_message_identity,
             const GUID_t& destination_participant_key,
@@ -543,6 +564,9 @@ private:
 
     uint32_t domain_id_;
 
+    //! Number of threads processing the authentication handshakes. Zero to process them on the receiving thread
+    uint32_t handshake_threads_;
+
     IdentityHandle* local_identity_handle_;
 
     PermissionsHandle* local_permissions_handle_;
@@ -551,6 +575,9 @@ private:
 
     std::map<GUID_t, DiscoveredParticipantInfo> discovered_participants_;
 
+    //! Last handshake message received while the participant info was being used by another thread
+    std::map<GUID_t, ParticipantGenericMessage> deferred_handshake_messages_;
+
     GUID_t auth_source_guid;
 
     std::mutex mutex_;
@@ -608,6 +635,9 @@ private:
 
     HistoryAttributes participant_volatile_message_secure_hattr_;
     std::shared_ptr<ITopicPayloadPool> participant_volatile_message_secure_pool_;
+
+    // Last member, so it is stopped before the rest is destroyed
+    HandshakeWorkers handshake_workers_;
 };
 
 } //namespace security
@@ -38,7 +38,13 @@ TCPChannelResourceBasic::TCPChannelResourceBasic(
         uint32_t maxMsgSize)
     : TCPChannelResource(parent, locator, maxMsgSize)
     , service_(service)
+    , strand_(service)
+    , max_pending_send_bytes_(parent->configuration()->sendBufferSize)
 {
+    if (0 < parent->configuration()->async_io_threads)
+    {
+        send_queue_ = std::make_shared<SendQueue>();
+    }
 }
 
 TCPChannelResourceBasic::TCPChannelResourceBasic(
@@ -49,7 +55,13 @@ TCPChannelResourceBasic::TCPChannelResourceBasic(
     : TCPChannelResource(parent, maxMsgSize)
     , service_(service)
     , socket_(socket)
+    , strand_(service)
+    , max_pending_send_bytes_(parent->configuration()->sendBufferSize)
 {
+    if (0 < parent->configuration()->async_io_threads)
+    {
+        send_queue_ = std::make_shared<SendQueue>();
+    }
 }
 
 TCPChannelResourceBasic::~TCPChannelResourceBasic()
@@ -155,6 +167,12 @@ size_t TCPChannelResourceBasic::send(
 
     if (eConnecting < connection_status_)
     {
+        if (send_queue_)
+        {
+            std::vector<NetworkBuffer> buffers(1, NetworkBuffer(data, static_cast<uint32_t>(size)));
+            return enqueue(header, header_size, buffers, static_cast<uint32_t>(size), ec);
+        }
+
         if (header_size > 0)
         {
             std::array<asio::const_buffer, 2> buffers;
@@ -171,6 +189,131 @@ size_t TCPChannelResourceBasic::send(
     return bytes_sent;
 }
 
+size_t TCPChannelResourceBasic::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        asio::error_code& ec)
+{
+    size_t bytes_sent = 0;
+
+    if (eConnecting < connection_status_)
+    {
+        if (send_queue_)
+        {
+            return enqueue(header, header_size, buffers, total_bytes, ec);
+        }
+
+        static thread_local std::vector<asio::const_buffer> asio_buffers;
+        asio_buffers.clear();
+        if (header_size > 0)
+        {
+            asio_buffers.push_back(asio::buffer(header, header_size));
+        }
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            asio_buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
+        bytes_sent = asio::write(*socket_.get(), asio_buffers, ec);
+    }
+
+    return bytes_sent;
+}
+
+size_t TCPChannelResourceBasic::enqueue(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        asio::error_code& ec)
+{
+    size_t size = header_size + total_bytes;
+    std::lock_guard<std::mutex> lock(send_queue_->mutex);
+
+    // A message is always accepted when nothing is pending, so messages bigger than the limit are not refused
+    if (!send_queue_->pending.empty() && send_queue_->pending.size() + size > max_pending_send_bytes_)
+    {
+        ec = asio::error::would_block;
+        return 0;
+    }
+
+    std::vector<octet>& pending = send_queue_->pending;
+    pending.insert(pending.end(), header, header + header_size);
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        pending.insert(pending.end(), buffer.buffer, buffer.buffer + buffer.size);
+    }
+
+    if (!send_queue_->write_in_progress)
+    {
+        send_queue_->write_in_progress = true;
+        auto queue = send_queue_;
+        auto socket = socket_;
+        auto strand = strand_;
+        strand_.post([queue, socket, strand]()
+                {
+                    write_pending(queue, socket, strand);
+                });
+    }
+
+    return size;
+}
+
+void TCPChannelResourceBasic::write_pending(
+        std::shared_ptr<SendQueue> queue,
+        std::shared_ptr<asio::ip::tcp::socket> socket,
+        asio::io_service::strand strand)
+{
+    {
+        // Everything sent since the previous write is coalesced on this one
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->writing.swap(queue->pending);
+    }
+
+    asio::async_write(*socket, asio::buffer(queue->writing), strand.wrap(
+                [queue, socket, strand](const asio::error_code& ec, std::size_t) mutable
+                {
+                    std::unique_lock<std::mutex> lock(queue->mutex);
+                    queue->writing.clear();
+
+                    if (ec)
+                    {
+                        logWarning(RTCP, "Error writing on TCP socket: " << ec.message());
+                        queue->pending.clear();
+                    }
+
+                    if (queue->pending.empty())
+                    {
+                        queue->write_in_progress = false;
+                        return;
+                    }
+
+                    lock.unlock();
+                    write_pending(queue, socket, strand);
+                }));
+}
+
+bool TCPChannelResourceBasic::async_read_some(
+        octet* buffer,
+        std::size_t size,
+        const std::function<void(const asio::error_code&, std::size_t)>& handler)
+{
+    if (!send_queue_ || eConnecting >= connection_status_)
+    {
+        return false;
+    }
+
+    auto socket = socket_;
+    auto strand = strand_;
+    strand_.dispatch([socket, strand, buffer, size, handler]() mutable
+            {
+                socket->async_read_some(asio::buffer(buffer, size), strand.wrap(handler));
+            });
+
+    return true;
+}
+
 asio::ip::tcp::endpoint TCPChannelResourceBasic::remote_endpoint() const
 {
     return socket_->remote_endpoint();
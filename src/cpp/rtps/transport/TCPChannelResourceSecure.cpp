@@ -200,6 +200,17 @@ size_t TCPChannelResourceSecure::send(
         const octet* data,
         size_t size,
         asio::error_code& ec)
+{
+    std::vector<NetworkBuffer> data_buffers(1, NetworkBuffer(data, static_cast<uint32_t>(size)));
+    return send(header, header_size, data_buffers, static_cast<uint32_t>(size), ec);
+}
+
+size_t TCPChannelResourceSecure::send(
+        const octet* header,
+        size_t header_size,
+        const std::vector<NetworkBuffer>& data_buffers,
+        uint32_t,
+        asio::error_code& ec)
 {
     size_t bytes_sent = 0;
 
@@ -210,7 +221,10 @@ size_t TCPChannelResourceSecure::send(
         {
             buffers.push_back(asio::buffer(header, header_size));
         }
-        buffers.push_back(asio::buffer(data, size));
+        for (const NetworkBuffer& buffer : data_buffers)
+        {
+            buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
 
         // Work around meanwhile
         std::promise<size_t> write_bytes_promise;
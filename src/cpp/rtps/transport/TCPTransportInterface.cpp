@@ -15,6 +15,7 @@
 #include <fastdds/rtps/transport/TCPTransportInterface.h>
 #include <fastdds/rtps/transport/tcp/RTCPMessageManager.h>
 #include <rtps/transport/TCPSenderResource.hpp>
+#include <rtps/transport/tcp/TCPReceiveBuffer.hpp>
 //#include "TCPSenderResource.hpp"
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/utils/IPLocator.h>
@@ -46,6 +47,7 @@ using octet = fastrtps::rtps::octet;
 using Locator_t = fastrtps::rtps::Locator_t;
 using LocatorList_t = fastrtps::rtps::LocatorList_t;
 using IPLocator = fastrtps::rtps::IPLocator;
+using IPFinder = fastrtps::rtps::IPFinder;
 using SenderResource = fastrtps::rtps::SenderResource;
 using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
@@ -71,6 +73,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , calculate_crc(true)
     , check_crc(true)
     , apply_security(false)
+    , async_io_threads(0)
 {
 }
 
@@ -89,6 +92,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , calculate_crc(t.calculate_crc)
     , check_crc(t.check_crc)
     , apply_security(t.apply_security)
+    , async_io_threads(t.async_io_threads)
     , tls_config(t.tls_config)
 {
 }
@@ -114,6 +118,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     calculate_crc = t.calculate_crc;
     check_crc = t.check_crc;
     apply_security = t.apply_security;
+    async_io_threads = t.async_io_threads;
     tls_config = t.tls_config;
     return *this;
 }
@@ -185,11 +190,14 @@ void TCPTransportInterface::clean()
         }
     }
 
-    if (io_service_thread_)
+    if (!io_service_threads_.empty())
     {
         io_service_.stop();
-        io_service_thread_->join();
-        io_service_thread_ = nullptr;
+        for (std::thread& thread : io_service_threads_)
+        {
+            thread.join();
+        }
+        io_service_threads_.clear();
     }
 }
 
@@ -221,13 +229,15 @@ bool TCPTransportInterface::check_crc(
 
 void TCPTransportInterface::calculate_crc(
         TCPHeader& header,
-        const octet* data,
-        uint32_t size) const
+        const std::vector<NetworkBuffer>& buffers) const
 {
     uint32_t crc(0);
-    for (uint32_t i = 0; i < size; ++i)
+    for (const NetworkBuffer& buffer : buffers)
     {
-        crc = RTCPMessageManager::addToCRC(crc, data[i]);
+        for (uint32_t i = 0; i < buffer.size; ++i)
+        {
+            crc = RTCPMessageManager::addToCRC(crc, buffer.buffer[i]);
+        }
     }
     header.crc = crc;
 }
@@ -307,15 +317,15 @@ bool TCPTransportInterface::create_acceptor_socket(
 
 void TCPTransportInterface::fill_rtcp_header(
         TCPHeader& header,
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         uint16_t logical_port) const
 {
-    header.length = send_buffer_size + static_cast<uint32_t>(TCPHeader::size());
+    header.length = total_bytes + static_cast<uint32_t>(TCPHeader::size());
     header.logical_port = logical_port;
     if (configuration()->calculate_crc)
     {
-        calculate_crc(header, send_buffer, send_buffer_size);
+        calculate_crc(header, buffers);
     }
 }
 
@@ -385,8 +395,10 @@ bool TCPTransportInterface::init()
         rtcp_message_manager_ = std::make_shared<RTCPMessageManager>(this);
     }
 
-    // TODO(Ricardo) Create an event that update this list.
-    get_ips(current_interfaces_);
+    {
+        std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+        update_current_interfaces();
+    }
 
     auto ioServiceFunction = [&]()
             {
@@ -397,7 +409,12 @@ bool TCPTransportInterface::init()
 #endif // if ASIO_VERSION >= 101200
                 io_service_.run();
             };
-    io_service_thread_ = std::make_shared<std::thread>(ioServiceFunction);
+    // Channels served asynchronously share the threads running the io_service, instead of having one each
+    size_t num_io_threads = std::max<size_t>(1u, configuration()->async_io_threads);
+    for (size_t i = 0; i < num_io_threads; ++i)
+    {
+        io_service_threads_.emplace_back(ioServiceFunction);
+    }
 
     if (0 < configuration()->keep_alive_frequency_ms)
     {
@@ -417,6 +434,17 @@ bool TCPTransportInterface::init()
     return true;
 }
 
+void TCPTransportInterface::update_current_interfaces() const
+{
+    uint32_t version = IPFinder::getInterfacesVersion();
+    if (version != current_interfaces_version_)
+    {
+        current_interfaces_.clear();
+        get_ips(current_interfaces_);
+        current_interfaces_version_ = version;
+    }
+}
+
 bool TCPTransportInterface::is_input_port_open(
         uint16_t port) const
 {
@@ -742,14 +770,35 @@ void TCPTransportInterface::keep_alive()
      */
 }
 
-void TCPTransportInterface::perform_listen_operation(
-        std::weak_ptr<TCPChannelResource> channel_weak,
-        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+void TCPTransportInterface::start_listen_operation(
+        std::shared_ptr<TCPChannelResource>& channel)
+{
+    std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
+    std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
+
+    // Secure channels are always served from a thread of their own
+    if (0 < configuration()->async_io_threads && !configuration()->apply_security)
+    {
+        std::shared_ptr<TCPChannelResource> locked_channel;
+        if (begin_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr, locked_channel) && locked_channel)
+        {
+            auto buffer = std::make_shared<TCPReceiveBuffer>(locked_channel->message_buffer().max_size);
+            async_receive(channel_weak_ptr, rtcp_manager_weak_ptr, buffer);
+        }
+    }
+    else
+    {
+        channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
+                channel_weak_ptr, rtcp_manager_weak_ptr));
+    }
+}
+
+bool TCPTransportInterface::begin_listen_operation(
+        std::weak_ptr<TCPChannelResource>& channel_weak,
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel)
 {
-    Locator_t remote_locator;
-    uint16_t logicalPort(0);
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-    std::shared_ptr<TCPChannelResource> channel;
     rtcp_message_manager = rtcp_manager.lock();
 
     // RTCP Control Message
@@ -772,8 +821,20 @@ void TCPTransportInterface::perform_listen_operation(
         std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
         rtcp_message_manager.reset();
         rtcp_message_manager_cv_.notify_one();
+        return true;
     }
-    else
+
+    return false;
+}
+
+void TCPTransportInterface::perform_listen_operation(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager)
+{
+    Locator_t remote_locator;
+    std::shared_ptr<TCPChannelResource> channel;
+
+    if (!begin_listen_operation(channel_weak, rtcp_manager, channel))
     {
         return;
     }
@@ -791,29 +852,174 @@ void TCPTransportInterface::perform_listen_operation(
         if (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
         {
             // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
-            if (it != receiver_resources_.end())
-            {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use = true;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use = false;
-                receiver_in_use->cv.notify_one();
-            }
-            else
+            deliver_received_message(channel, msg.buffer, msg.length, remote_locator);
+        }
+    }
+
+    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+}
+
+void TCPTransportInterface::async_receive(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager,
+        std::shared_ptr<TCPReceiveBuffer> buffer)
+{
+    std::shared_ptr<TCPChannelResource> channel = channel_weak.lock();
+    if (!channel || !alive_.load())
+    {
+        return;
+    }
+
+    bool reading = TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status() &&
+            channel->async_read_some(buffer->write_position(), buffer->free_space(),
+                    [this, channel_weak, rtcp_manager, buffer](const asio::error_code& ec, std::size_t bytes)
+                    {
+                        on_async_receive(channel_weak, rtcp_manager, buffer, ec, bytes);
+                    });
+
+    if (!reading)
+    {
+        logInfo(RTCP, "End asynchronous listen operation " << channel->locator());
+    }
+}
+
+void TCPTransportInterface::on_async_receive(
+        std::weak_ptr<TCPChannelResource> channel_weak,
+        std::weak_ptr<RTCPMessageManager> rtcp_manager,
+        std::shared_ptr<TCPReceiveBuffer> buffer,
+        const asio::error_code& ec,
+        std::size_t bytes_received)
+{
+    std::shared_ptr<TCPChannelResource> channel = channel_weak.lock();
+    if (!channel)
+    {
+        return;
+    }
+
+    if (ec)
+    {
+        if (ec != asio::error::operation_aborted)
+        {
+            logWarning(DEBUG, "Error reading from TCP socket: " << ec.message());
+            close_tcp_socket(channel);
+        }
+        return;
+    }
+
+    buffer->commit(bytes_received);
+
+    // All the frames completed by this read are processed before reading again
+    TCPHeader tcp_header;
+    octet* body = nullptr;
+    uint32_t body_size = 0;
+    uint32_t dropped_frames = buffer->dropped_frames();
+    TCPReceiveBuffer::Result result = TCPReceiveBuffer::Result::NEED_MORE_DATA;
+    while (TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status() &&
+            TCPReceiveBuffer::Result::FRAME == (result = buffer->next_frame(tcp_header, body, body_size)))
+    {
+        Locator_t remote_locator = channel->locator();
+        if (process_received_frame(rtcp_manager, channel, tcp_header, body, body_size, remote_locator) &&
+                TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
+        {
+            deliver_received_message(channel, body, body_size, remote_locator);
+        }
+    }
+
+    if (dropped_frames != buffer->dropped_frames())
+    {
+        logError(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer capacity: "
+                << channel->message_buffer().max_size << ". The full message will be dropped.");
+    }
+
+    if (TCPReceiveBuffer::Result::BAD_HEADER == result)
+    {
+        logError(RTCP_MSG_IN, "Bad RTCP header identifier, closing connection.");
+        close_tcp_socket(channel);
+        return;
+    }
+
+    buffer->compact();
+    async_receive(channel_weak, rtcp_manager, buffer);
+}
+
+bool TCPTransportInterface::process_received_frame(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* body,
+        uint32_t body_size,
+        Locator_t& remote_locator)
+{
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, body, body_size))
+    {
+        logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
+
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, body, body_size);
+
+            if (responseCode != RETCODE_OK)
             {
-                logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+                close_tcp_socket(channel);
             }
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            close_tcp_socket(channel);
         }
+
+        return false;
     }
 
-    logInfo(RTCP, "End PerformListenOperation " << channel->locator());
+    IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+    logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                            << " - " << body_size << " bytes.");
+    return true;
+}
+
+void TCPTransportInterface::deliver_received_message(
+        std::shared_ptr<TCPChannelResource>& channel,
+        const octet* data,
+        uint32_t size,
+        const Locator_t& remote_locator)
+{
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    //TransportReceiverInterface* receiver = channel->GetMessageReceiver(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use = true;
+        scopedLock.unlock();
+        receiver->OnDataReceived(data, size, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use = false;
+        receiver_in_use->cv.notify_one();
+    }
+    else
+    {
+        logWarning(RTCP, "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
+    }
 }
 
 bool TCPTransportInterface::read_body(
@@ -929,51 +1135,8 @@ bool TCPTransportInterface::Receive(
 
                     if (success)
                     {
-                        if (configuration()->check_crc
-                                && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                        {
-                            logWarning(RTCP_MSG_IN, "Bad TCP header CRC");
-                        }
-
-                        if (tcp_header.logical_port == 0)
-                        {
-                            std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                            if (TCPChannelResource::eConnectionStatus::eDisconnected != channel->connection_status())
-
-                            {
-                                std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                                rtcp_message_manager = rtcp_manager.lock();
-                            }
-
-                            if (rtcp_message_manager)
-                            {
-                                // The channel is not going to be deleted because we lock it for reading.
-                                ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                    channel, receive_buffer, body_size);
-
-                                if (responseCode != RETCODE_OK)
-                                {
-                                    close_tcp_socket(channel);
-                                }
-                                success = false;
-
-                                std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                                rtcp_message_manager.reset();
-                                rtcp_message_manager_cv_.notify_one();
-                            }
-                            else
-                            {
-                                success = false;
-                                close_tcp_socket(channel);
-                            }
-
-                        }
-                        else
-                        {
-                            IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                            logInfo(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                    << " - " << receive_buffer_size << " bytes.");
-                        }
+                        success = process_received_frame(rtcp_manager, channel, tcp_header, receive_buffer,
+                                        receive_buffer_size, remote_locator);
                     }
                     // Error message already shown by read_body method.
                 }
@@ -1012,6 +1175,17 @@ bool TCPTransportInterface::send(
         std::shared_ptr<TCPChannelResource>& channel,
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end)
+{
+    std::vector<NetworkBuffer> buffers(1, NetworkBuffer(send_buffer, send_buffer_size));
+    return send(buffers, send_buffer_size, channel, destination_locators_begin, destination_locators_end);
+}
+
+bool TCPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        std::shared_ptr<TCPChannelResource>& channel,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -1021,7 +1195,7 @@ bool TCPTransportInterface::send(
     {
         if (IsLocatorSupported(*it))
         {
-            ret &= send(send_buffer, send_buffer_size, channel, *it);
+            ret &= send(buffers, total_bytes, channel, *it);
         }
 
         ++it;
@@ -1031,8 +1205,8 @@ bool TCPTransportInterface::send(
 }
 
 bool TCPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::shared_ptr<TCPChannelResource>& channel,
         const Locator_t& remote_locator)
 {
@@ -1057,7 +1231,7 @@ bool TCPTransportInterface::send(
         }
     }
 
-    if (locator_mismatch || send_buffer_size > configuration()->sendBufferSize)
+    if (locator_mismatch || total_bytes > configuration()->sendBufferSize)
     {
         //std::cout << "ChannelLocator: " << IPLocator::to_string(channel->locator()) << std::endl;
         //std::cout << "RemoteLocator: " << IPLocator::to_string(remote_locator) << std::endl;
@@ -1090,21 +1264,21 @@ bool TCPTransportInterface::send(
             if (channel->is_logical_port_opened(logical_port))
             {
                 TCPHeader tcp_header;
-                fill_rtcp_header(tcp_header, send_buffer, send_buffer_size, logical_port);
+                fill_rtcp_header(tcp_header, buffers, total_bytes, logical_port);
 
                 {
                     asio::error_code ec;
                     size_t sent = channel->send(
                         (octet*)&tcp_header,
                         static_cast<uint32_t>(TCPHeader::size()),
-                        send_buffer,
-                        send_buffer_size,
+                        buffers,
+                        total_bytes,
                         ec);
 
-                    if (sent != static_cast<uint32_t>(TCPHeader::size() + send_buffer_size) || ec)
+                    if (sent != static_cast<uint32_t>(TCPHeader::size() + total_bytes) || ec)
                     {
                         logWarning(DEBUG, "Failed to send RTCP message (" << sent << " of " <<
-                                TCPHeader::size() + send_buffer_size << " b): " << ec.message());
+                                TCPHeader::size() + total_bytes << " b): " << ec.message());
                         success = false;
                     }
                     else
@@ -1177,10 +1351,7 @@ void TCPTransportInterface::SocketAccepted(
             }
 
             channel->set_options(configuration());
-            std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
-            std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                    channel_weak_ptr, rtcp_manager_weak_ptr));
+            start_listen_operation(channel);
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                                                           << ", remote: " << channel->remote_endpoint().address()
@@ -1223,10 +1394,7 @@ void TCPTransportInterface::SecureSocketAccepted(
             }
 
             secure_channel->set_options(configuration());
-            std::weak_ptr<TCPChannelResource> channel_weak_ptr = secure_channel;
-            std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            secure_channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                    channel_weak_ptr, rtcp_manager_weak_ptr));
+            start_listen_operation(secure_channel);
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                                                           << ", remote: " << socket->lowest_layer().remote_endpoint().address()
@@ -1268,10 +1436,7 @@ void TCPTransportInterface::SocketConnected(
                 {
                     channel->change_status(TCPChannelResource::eConnectionStatus::eConnected);
                     channel->set_options(configuration());
-
-                    std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-                    channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                            channel_weak_ptr, rtcp_manager_weak_ptr));
+                    start_listen_operation(channel);
                 }
             }
             else
@@ -261,6 +261,8 @@ bool TCPv4Transport::is_local_locator(const Locator_t& locator) const
     /*
      * Check case: Address is one of our addresses.
      */
+    std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+    update_current_interfaces();
     for (const IPFinder::info_IP& localInterface : current_interfaces_)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
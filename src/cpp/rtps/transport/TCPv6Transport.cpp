@@ -237,6 +237,8 @@ bool TCPv6Transport::is_local_locator(const Locator_t& locator) const
         return true;
     }
 
+    std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+    update_current_interfaces();
     for (const IPFinder::info_IP& localInterface : current_interfaces_)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
@@ -43,6 +43,9 @@ using PortParameters = fastrtps::rtps::PortParameters;
 using SenderResource = fastrtps::rtps::SenderResource;
 using Log = fastdds::dds::Log;
 
+//! Maximum number of buffers asio gathers in a single send.
+static constexpr size_t max_gathered_buffers = 64;
+
 struct MultiUniLocatorsLinkage
 {
     MultiUniLocatorsLinkage(
@@ -182,12 +185,23 @@ bool UDPTransportInterface::init()
         return false;
     }
 
-    // TODO(Ricardo) Create an event that update this list.
-    get_ips(currentInterfaces);
+    std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+    update_current_interfaces();
 
     return true;
 }
 
+void UDPTransportInterface::update_current_interfaces() const
+{
+    uint32_t version = IPFinder::getInterfacesVersion();
+    if (version != current_interfaces_version_)
+    {
+        currentInterfaces.clear();
+        get_ips(currentInterfaces);
+        current_interfaces_version_ = version;
+    }
+}
+
 bool UDPTransportInterface::IsInputChannelOpen(
         const Locator_t& locator) const
 {
@@ -494,15 +508,16 @@ bool UDPTransportInterface::send(
     return ret;
 }
 
-bool UDPTransportInterface::send(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+template<typename ConstBufferSequence>
+bool UDPTransportInterface::send_to(
+        const ConstBufferSequence& buffers,
+        uint32_t total_bytes,
         eProsimaUDPSocket& socket,
         const fastrtps::rtps::Locator_t& remote_locator,
         bool only_multicast_purpose,
         const std::chrono::microseconds& timeout)
 {
-    if (send_buffer_size > configuration()->sendBufferSize)
+    if (total_bytes > configuration()->sendBufferSize)
     {
         return false;
     }
@@ -528,8 +543,7 @@ bool UDPTransportInterface::send(
 #endif // ifndef _WIN32
 
             asio::error_code ec;
-            bytesSent = getSocketPtr(socket)->send_to(asio::buffer(send_buffer,
-                            send_buffer_size), destinationEndpoint, 0, ec);
+            bytesSent = getSocketPtr(socket)->send_to(buffers, destinationEndpoint, 0, ec);
             if (!!ec)
             {
                 if ((ec.value() == asio::error::would_block) ||
@@ -549,7 +563,13 @@ bool UDPTransportInterface::send(
             return false;
         }
 
-        (void)bytesSent;
+        if (bytesSent != total_bytes)
+        {
+            logWarning(RTPS_MSG_OUT, "UDPTransport: only " << bytesSent << " of " << total_bytes <<
+                    " bytes sent TO endpoint: " << destinationEndpoint);
+            return false;
+        }
+
         logInfo(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
                                                << " FROM " << getSocketPtr(socket)->local_endpoint());
         success = true;
@@ -558,6 +578,126 @@ bool UDPTransportInterface::send(
     return success;
 }
 
+bool UDPTransportInterface::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    // Kept between calls to avoid allocations
+    static thread_local std::vector<asio::const_buffer> asio_buffers;
+    static thread_local std::vector<octet> gathered_buffer;
+    asio_buffers.clear();
+    if (buffers.size() <= max_gathered_buffers)
+    {
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            asio_buffers.push_back(asio::buffer(buffer.buffer, buffer.size));
+        }
+    }
+    else
+    {
+        // asio silently sends only the first buffers of longer sequences
+        gathered_buffer.clear();
+        for (const NetworkBuffer& buffer : buffers)
+        {
+            gathered_buffer.insert(gathered_buffer.end(), buffer.buffer, buffer.buffer + buffer.size);
+        }
+        asio_buffers.push_back(asio::buffer(gathered_buffer));
+    }
+
+    fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
+
+    bool ret = true;
+
+    auto time_out = std::chrono::duration_cast<std::chrono::microseconds>(
+        max_blocking_time_point - std::chrono::steady_clock::now());
+
+    while (it != *destination_locators_end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            ret &= send_to(asio_buffers,
+                            total_bytes,
+                            socket,
+                            *it,
+                            only_multicast_purpose,
+                            time_out);
+        }
+
+        ++it;
+    }
+
+    return ret;
+}
+
+bool UDPTransportInterface::send(
+        const octet* send_buffer,
+        uint32_t send_buffer_size,
+        eProsimaUDPSocket& socket,
+        const fastrtps::rtps::Locator_t& remote_locator,
+        bool only_multicast_purpose,
+        const std::chrono::microseconds& timeout)
+{
+    return send_to(asio::buffer(send_buffer, send_buffer_size), send_buffer_size, socket, remote_locator,
+                   only_multicast_purpose, timeout);
+}
+
+/**
+ * Check whether a locator is on the multicast list of a selector entry.
+ *
+ * @param entry     Selector entry to check
+ * @param locator   Locator to be searched
+ *
+ * @return true when the locator is on the multicast list of the entry, false otherwise
+ */
+static bool has_multicast_locator(
+        const LocatorSelectorEntry* entry,
+        const Locator_t& locator)
+{
+    return std::find(entry->multicast.begin(), entry->multicast.end(), locator) != entry->multicast.end();
+}
+
+/**
+ * Decide whether sending to a multicast locator is cheaper than sending to the unicast locators of the
+ * interested entries.
+ *
+ * All the entries having 'locator' on their multicast list receive the datagrams sent to it, so the multicast
+ * locator is only worth using when at least two of the entries from 'index' onwards should be processed, and
+ * they are at least half of all the entries listening on it.
+ *
+ * @param entries   Selector entries collection to process
+ * @param index     Index of the entry being processed
+ * @param locator   Multicast locator being considered
+ *
+ * @return Number of interested entries when the locator should be used, 0 otherwise
+ */
+static size_t multicast_interested_entries(
+        const fastrtps::ResourceLimitedVector<LocatorSelectorEntry*>& entries,
+        size_t index,
+        const Locator_t& locator)
+{
+    size_t interested = 0;
+    size_t listeners = 0;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const LocatorSelectorEntry* entry = entries[i];
+        if (has_multicast_locator(entry, locator))
+        {
+            ++listeners;
+            if (i >= index && entry->transport_should_process)
+            {
+                ++interested;
+            }
+        }
+    }
+
+    return (interested >= 2 && interested * 2 >= listeners) ? interested : 0;
+}
+
 /**
  * Invalidate all selector entries containing certain multicast locator.
  *
@@ -565,38 +705,23 @@ bool UDPTransportInterface::send(
  * of them has 'locator' on its multicast list, will invalidate them
  * (i.e. their 'transport_should_process' flag will be changed to false).
  *
- * If this function returns true, the locator received should be selected.
- *
  * @param entries   Selector entries collection to process
  * @param index     Starting index to process
  * @param locator   Locator to be searched
- *
- * @return true when at least one entry was invalidated, false otherwise
  */
-static bool check_and_invalidate(
+static void invalidate(
         fastrtps::ResourceLimitedVector<LocatorSelectorEntry*>& entries,
         size_t index,
         const Locator_t& locator)
 {
-    bool ret_val = false;
     for (; index < entries.size(); ++index)
     {
         LocatorSelectorEntry* entry = entries[index];
-        if (entry->transport_should_process)
+        if (entry->transport_should_process && has_multicast_locator(entry, locator))
         {
-            for (const Locator_t& loc : entry->multicast)
-            {
-                if (loc == locator)
-                {
-                    entry->transport_should_process = false;
-                    ret_val = true;
-                    break;
-                }
-            }
+            entry->transport_should_process = false;
         }
     }
-
-    return ret_val;
 }
 
 void UDPTransportInterface::select_locators(
@@ -611,24 +736,31 @@ void UDPTransportInterface::select_locators(
         {
             bool selected = false;
 
-            // First try to find a multicast locator which is at least on another list.
-            for (size_t j = 0; j < entry->multicast.size() && !selected; ++j)
+            // First try to find the multicast locator reaching more interested entries, when it is cheaper than
+            // sending to their unicast locators.
+            size_t best_multicast = entry->multicast.size();
+            size_t best_interested = 0;
+            for (size_t j = 0; j < entry->multicast.size(); ++j)
             {
                 if (IsLocatorSupported(entry->multicast[j]))
                 {
-                    if (check_and_invalidate(entries, i + 1, entry->multicast[j]))
+                    size_t interested = multicast_interested_entries(entries, i, entry->multicast[j]);
+                    if (interested > best_interested ||
+                            (best_multicast == entry->multicast.size() && entry->unicast.size() == 0))
                     {
-                        entry->state.multicast.push_back(j);
-                        selected = true;
-                    }
-                    else if (entry->unicast.size() == 0)
-                    {
-                        entry->state.multicast.push_back(j);
-                        selected = true;
+                        best_multicast = j;
+                        best_interested = interested;
                     }
                 }
             }
 
+            if (best_multicast < entry->multicast.size())
+            {
+                invalidate(entries, i + 1, entry->multicast[best_multicast]);
+                entry->state.multicast.push_back(best_multicast);
+                selected = true;
+            }
+
             // If we couldn't find a multicast locator, select all unicast locators
             if (!selected)
             {
@@ -272,7 +272,7 @@ asio::ip::udp UDPv4Transport::generate_protocol() const
 
 void UDPv4Transport::get_ips(
         std::vector<IPFinder::info_IP>& locNames,
-        bool return_loopback)
+        bool return_loopback) const
 {
     get_ipv4s(locNames, return_loopback);
 }
@@ -523,6 +523,8 @@ bool UDPv4Transport::is_local_locator(
         return true;
     }
 
+    std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+    update_current_interfaces();
     for (const IPFinder::info_IP& localInterface : currentInterfaces)
     {
         if (IPLocator::compareAddress(locator, localInterface.locator))
@@ -284,7 +284,7 @@ asio::ip::udp UDPv6Transport::generate_protocol() const
 
 void UDPv6Transport::get_ips(
         std::vector<IPFinder::info_IP>& locNames,
-        bool return_loopback)
+        bool return_loopback) const
 {
     get_ipv6s(locNames, return_loopback);
 }
@@ -488,6 +488,8 @@ bool UDPv6Transport::is_local_locator(
         return true;
     }
 
+    std::lock_guard<std::mutex> guard(current_interfaces_mutex_);
+    update_current_interfaces();
     for (const IPFinder::info_IP& localInterface : currentInterfaces)
     {
         if (IPLocator::compareAddress(localInterface.locator, locator))
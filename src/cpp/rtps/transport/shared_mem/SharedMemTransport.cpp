@@ -388,16 +388,21 @@ bool SharedMemTransport::transform_remote_locator(
 }
 
 std::shared_ptr<SharedMemManager::Buffer> SharedMemTransport::copy_to_shared_buffer(
-        const octet* send_buffer,
-        uint32_t send_buffer_size,
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     assert(shared_mem_segment_);
 
     std::shared_ptr<SharedMemManager::Buffer> shared_buffer =
-            shared_mem_segment_->alloc_buffer(send_buffer_size, max_blocking_time_point);
+            shared_mem_segment_->alloc_buffer(total_bytes, max_blocking_time_point);
 
-    memcpy(shared_buffer->data(), send_buffer, send_buffer_size);
+    octet* pos = static_cast<octet*>(shared_buffer->data());
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        memcpy(pos, buffer.buffer, buffer.size);
+        pos += buffer.size;
+    }
 
     return shared_buffer;
 }
@@ -408,6 +413,29 @@ bool SharedMemTransport::send(
         fastrtps::rtps::LocatorsIterator* destination_locators_begin,
         fastrtps::rtps::LocatorsIterator* destination_locators_end,
         const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    std::vector<NetworkBuffer> buffers(1, NetworkBuffer(send_buffer, send_buffer_size));
+    return send_to_locators(buffers, send_buffer_size, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    return send_to_locators(buffers, total_bytes, destination_locators_begin, destination_locators_end,
+                   max_blocking_time_point);
+}
+
+bool SharedMemTransport::send_to_locators(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
     fastrtps::rtps::LocatorsIterator& it = *destination_locators_begin;
 
@@ -424,7 +452,7 @@ bool SharedMemTransport::send(
                 // Only copy the first time
                 if (shared_buffer == nullptr)
                 {
-                    shared_buffer = copy_to_shared_buffer(send_buffer, send_buffer_size, max_blocking_time_point);
+                    shared_buffer = copy_to_shared_buffer(buffers, total_bytes, max_blocking_time_point);
                 }
 
                 ret &= send(shared_buffer, *it);
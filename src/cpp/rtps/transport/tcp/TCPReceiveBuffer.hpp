@@ -0,0 +1,173 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TCPReceiveBuffer.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_TRANSPORT_TCP_TCPRECEIVEBUFFER_HPP_
+#define _FASTDDS_RTPS_TRANSPORT_TCP_TCPRECEIVEBUFFER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/transport/tcp/RTCPHeader.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Reassembles the frames received on a TCP stream, each of them made of a TCPHeader followed by its body.
+ *
+ * Bytes are read from the socket directly into the free space of the buffer, which is big enough to receive
+ * several frames on a single read. Complete frames are then taken one after the other, and the bytes of an
+ * incomplete frame are kept for the next read. Frames whose body does not fit on the buffer are skipped.
+ */
+class TCPReceiveBuffer
+{
+public:
+
+    enum class Result
+    {
+        //! A complete frame has been taken.
+        FRAME,
+        //! More bytes are needed to complete the next frame.
+        NEED_MORE_DATA,
+        //! The stream does not contain a valid header, so the connection should be closed.
+        BAD_HEADER
+    };
+
+    /**
+     * @param max_body_size  Maximum size of the body of the frames. Bigger frames are skipped.
+     * @param num_frames     Number of frames of maximum size that fit on the buffer.
+     */
+    TCPReceiveBuffer(
+            uint32_t max_body_size,
+            uint32_t num_frames = 2)
+        : max_body_size_(max_body_size)
+        , buffer_((max_body_size + TCPHeader::size()) * (num_frames > 0 ? num_frames : 1))
+    {
+    }
+
+    //! Position where the next read should store its bytes.
+    fastrtps::rtps::octet* write_position()
+    {
+        return buffer_.data() + end_;
+    }
+
+    //! Number of bytes that can be read into write_position().
+    size_t free_space() const
+    {
+        return buffer_.size() - end_;
+    }
+
+    /**
+     * Account for the bytes read into write_position().
+     * @param bytes  Number of bytes read, which should not exceed free_space().
+     */
+    void commit(
+            size_t bytes)
+    {
+        end_ += bytes;
+
+        // Discard the bytes of a frame being skipped
+        size_t skipped = std::min(bytes_to_skip_, end_ - begin_);
+        begin_ += skipped;
+        bytes_to_skip_ -= skipped;
+    }
+
+    /**
+     * Take the next complete frame.
+     * @param [out] header     Header of the frame.
+     * @param [out] body       Body of the frame. Only valid until the next call to compact().
+     * @param [out] body_size  Size of the body of the frame.
+     * @return Whether a frame was taken.
+     */
+    Result next_frame(
+            TCPHeader& header,
+            fastrtps::rtps::octet*& body,
+            uint32_t& body_size)
+    {
+        while (end_ - begin_ >= TCPHeader::size())
+        {
+            memcpy(header.address(), buffer_.data() + begin_, TCPHeader::size());
+            if (header.rtcp[0] != 'R' || header.rtcp[1] != 'T' || header.rtcp[2] != 'C' || header.rtcp[3] != 'P' ||
+                    header.length < TCPHeader::size())
+            {
+                return Result::BAD_HEADER;
+            }
+
+            body_size = header.length - static_cast<uint32_t>(TCPHeader::size());
+            if (body_size > max_body_size_)
+            {
+                // Skip the whole frame, including the bytes not yet received
+                begin_ += TCPHeader::size();
+                bytes_to_skip_ = body_size;
+                commit(0);
+                ++dropped_frames_;
+                continue;
+            }
+
+            if (end_ - begin_ < TCPHeader::size() + body_size)
+            {
+                break;
+            }
+
+            body = buffer_.data() + begin_ + TCPHeader::size();
+            begin_ += TCPHeader::size() + body_size;
+            return Result::FRAME;
+        }
+
+        return Result::NEED_MORE_DATA;
+    }
+
+    //! Move the bytes of the incomplete frame to the beginning of the buffer, invalidating the frames taken.
+    void compact()
+    {
+        if (begin_ < end_ && 0 < begin_)
+        {
+            memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        }
+        end_ -= begin_;
+        begin_ = 0;
+    }
+
+    //! Number of frames skipped because they were too big.
+    uint32_t dropped_frames() const
+    {
+        return dropped_frames_;
+    }
+
+private:
+
+    uint32_t max_body_size_;
+    std::vector<fastrtps::rtps::octet> buffer_;
+    //! Beginning of the bytes not taken yet.
+    size_t begin_ = 0;
+    //! End of the bytes received.
+    size_t end_ = 0;
+    //! Bytes of a skipped frame still to be received.
+    size_t bytes_to_skip_ = 0;
+    uint32_t dropped_frames_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_TRANSPORT_TCP_TCPRECEIVEBUFFER_HPP_
@@ -114,7 +114,7 @@ TransportInterface* test_UDPv4TransportDescriptor::create_transport() const
 
 void test_UDPv4Transport::get_ips(
         std::vector<fastrtps::rtps::IPFinder::info_IP>& locNames,
-        bool return_loopback)
+        bool return_loopback) const
 {
 
     if (!simulate_no_interfaces)
@@ -173,6 +173,26 @@ bool test_UDPv4Transport::send(
     return ret;
 }
 
+bool test_UDPv4Transport::send(
+        const std::vector<NetworkBuffer>& buffers,
+        uint32_t total_bytes,
+        eProsimaUDPSocket& socket,
+        fastrtps::rtps::LocatorsIterator* destination_locators_begin,
+        fastrtps::rtps::LocatorsIterator* destination_locators_end,
+        bool only_multicast_purpose,
+        const std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    std::vector<octet> message;
+    message.reserve(total_bytes);
+    for (const NetworkBuffer& buffer : buffers)
+    {
+        message.insert(message.end(), buffer.buffer, buffer.buffer + buffer.size);
+    }
+
+    return send(message.data(), total_bytes, socket, destination_locators_begin, destination_locators_end,
+                   only_multicast_purpose, max_blocking_time_point);
+}
+
 bool test_UDPv4Transport::send(
         const octet* send_buffer,
         uint32_t send_buffer_size,
@@ -2,6 +2,11 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 using namespace std::chrono;
 
@@ -9,7 +14,250 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-using LivelinessDataIterator = ResourceLimitedVector<LivelinessData>::iterator;
+namespace {
+
+constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+//! Identifies a writer on the set
+struct WriterKey
+{
+    GUID_t guid;
+    LivelinessQosPolicyKind kind;
+    Duration_t lease_duration;
+
+    bool operator <(
+            const WriterKey& other) const
+    {
+        if (guid != other.guid)
+        {
+            return guid < other.guid;
+        }
+        if (kind != other.kind)
+        {
+            return kind < other.kind;
+        }
+        return lease_duration < other.lease_duration;
+    }
+
+};
+
+/**
+ * Indexes on the writers of a LivelinessManager.
+ * They are kept outside of the exported class, so its layout does not change, and are protected by its mutex.
+ */
+struct WriterIndex
+{
+    //! Position on writers_ of each writer
+    std::map<WriterKey, size_t> positions;
+
+    //! Positions on writers_ of the alive writers, as a min-heap on their liveliness time
+    std::vector<size_t> alive_heap;
+
+    //! Position on alive_heap of each writer on writers_, or npos if the writer is not alive
+    std::vector<size_t> heap_slots;
+
+    //! Number of alive writers of each liveliness kind
+    uint32_t alive_count[3] = {0, 0, 0};
+
+    //! The time when the timer owner loses its liveliness, as scheduled on the timer
+    steady_clock::time_point timer_time;
+};
+
+//! Indexes of every LivelinessManager. The mutex only protects the collection itself
+struct IndexRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<const LivelinessManager*, std::unique_ptr<WriterIndex>> indexes;
+};
+
+IndexRegistry& registry()
+{
+    static IndexRegistry instance;
+    return instance;
+}
+
+WriterIndex& index_of(
+        const LivelinessManager* manager)
+{
+    IndexRegistry& indexes = registry();
+    std::lock_guard<std::mutex> guard(indexes.mutex);
+    std::unique_ptr<WriterIndex>& index = indexes.indexes[manager];
+    if (!index)
+    {
+        index.reset(new WriterIndex());
+    }
+    return *index;
+}
+
+void release_index(
+        const LivelinessManager* manager)
+{
+    IndexRegistry& indexes = registry();
+    std::lock_guard<std::mutex> guard(indexes.mutex);
+    indexes.indexes.erase(manager);
+}
+
+size_t position_of(
+        const ResourceLimitedVector<LivelinessData>& writers,
+        const LivelinessData* writer)
+{
+    return writer == nullptr ? npos : static_cast<size_t>(writer - &writers[0]);
+}
+
+void set_timer_interval(
+        TimedEvent& timer,
+        const steady_clock::time_point& time)
+{
+    // Some times the interval could be negative if a writer expired during the call to this function
+    // Once in this situation there is not much we can do but let asio timers expire inmediately
+    auto interval = time - steady_clock::now();
+    timer.update_interval_millisec(static_cast<double>(duration_cast<microseconds>(interval).count()) / 1000.0);
+}
+
+//! @name Min-heap of the alive writers, ordered by the time when they will lose their liveliness
+//! @{
+void heap_swap(
+        WriterIndex& index,
+        size_t slot_a,
+        size_t slot_b)
+{
+    std::swap(index.alive_heap[slot_a], index.alive_heap[slot_b]);
+    index.heap_slots[index.alive_heap[slot_a]] = slot_a;
+    index.heap_slots[index.alive_heap[slot_b]] = slot_b;
+}
+
+void heap_sift_up(
+        WriterIndex& index,
+        const ResourceLimitedVector<LivelinessData>& writers,
+        size_t slot)
+{
+    while (slot > 0)
+    {
+        size_t parent = (slot - 1) / 2;
+        if (!(writers[index.alive_heap[slot]].time < writers[index.alive_heap[parent]].time))
+        {
+            break;
+        }
+        heap_swap(index, slot, parent);
+        slot = parent;
+    }
+}
+
+void heap_sift_down(
+        WriterIndex& index,
+        const ResourceLimitedVector<LivelinessData>& writers,
+        size_t slot)
+{
+    size_t size = index.alive_heap.size();
+    while (true)
+    {
+        size_t smallest = slot;
+        size_t left = 2 * slot + 1;
+        size_t right = left + 1;
+        if (left < size && writers[index.alive_heap[left]].time < writers[index.alive_heap[smallest]].time)
+        {
+            smallest = left;
+        }
+        if (right < size && writers[index.alive_heap[right]].time < writers[index.alive_heap[smallest]].time)
+        {
+            smallest = right;
+        }
+        if (smallest == slot)
+        {
+            break;
+        }
+        heap_swap(index, slot, smallest);
+        slot = smallest;
+    }
+}
+
+void heap_update(
+        WriterIndex& index,
+        const ResourceLimitedVector<LivelinessData>& writers,
+        size_t position)
+{
+    heap_sift_up(index, writers, index.heap_slots[position]);
+    heap_sift_down(index, writers, index.heap_slots[position]);
+}
+
+void heap_push(
+        WriterIndex& index,
+        const ResourceLimitedVector<LivelinessData>& writers,
+        size_t position)
+{
+    index.heap_slots[position] = index.alive_heap.size();
+    index.alive_heap.push_back(position);
+    index.alive_count[writers[position].kind]++;
+    heap_sift_up(index, writers, index.alive_heap.size() - 1);
+}
+
+void heap_erase(
+        WriterIndex& index,
+        const ResourceLimitedVector<LivelinessData>& writers,
+        size_t position)
+{
+    size_t slot = index.heap_slots[position];
+    size_t last = index.alive_heap.size() - 1;
+    index.alive_count[writers[position].kind]--;
+    if (slot != last)
+    {
+        heap_swap(index, slot, last);
+        index.alive_heap.pop_back();
+        index.heap_slots[position] = npos;
+        heap_update(index, writers, index.alive_heap[slot]);
+    }
+    else
+    {
+        index.alive_heap.pop_back();
+        index.heap_slots[position] = npos;
+    }
+}
+//! @}
+
+//! Makes a writer alive until its lease duration elapses from now, invoking the callback if it was not alive
+void assert_writer(
+        WriterIndex& index,
+        ResourceLimitedVector<LivelinessData>& writers,
+        size_t position,
+        const steady_clock::time_point& now,
+        const LivelinessCallback& callback)
+{
+    LivelinessData& writer = writers[position];
+
+    if (callback != nullptr)
+    {
+        if (writer.status == LivelinessData::WriterStatus::NOT_ASSERTED)
+        {
+            callback(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    1,
+                    0);
+        }
+        else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
+        {
+            callback(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    1,
+                    -1);
+        }
+    }
+
+    writer.status = LivelinessData::WriterStatus::ALIVE;
+    writer.time = now + nanoseconds(writer.lease_duration.to_ns());
+
+    if (index.heap_slots[position] == npos)
+    {
+        heap_push(index, writers, position);
+    }
+    else
+    {
+        heap_update(index, writers, position);
+    }
+}
+
+} // namespace
 
 LivelinessManager::LivelinessManager(
         const LivelinessCallback& callback,
@@ -28,13 +276,17 @@ LivelinessManager::LivelinessManager(
             },
         0)
 {
+    index_of(this);
 }
 
 LivelinessManager::~LivelinessManager()
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    timer_owner_ = nullptr;
-    timer_.cancel_timer();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        timer_owner_ = nullptr;
+        timer_.cancel_timer();
+    }
+    release_index(this);
 }
 
 bool LivelinessManager::add_writer(
@@ -50,17 +302,27 @@ bool LivelinessManager::add_writer(
         return false;
     }
 
-    for (LivelinessData& writer : writers_)
+    ResourceLimitedVector<LivelinessData>::iterator wit;
+    if (find_writer(guid, kind, lease_duration, &wit))
     {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
-        {
-            writer.count++;
-            return true;
-        }
+        wit->count++;
+        return true;
+    }
+
+    // The writers could be moved when adding a new one
+    size_t timer_owner = position_of(writers_, timer_owner_);
+    if (writers_.emplace_back(guid, kind, lease_duration) == nullptr)
+    {
+        return false;
     }
-    writers_.emplace_back(guid, kind, lease_duration);
+    if (timer_owner != npos)
+    {
+        timer_owner_ = &writers_[timer_owner];
+    }
+
+    WriterIndex& index = index_of(this);
+    index.positions.emplace(WriterKey{guid, kind, lease_duration}, writers_.size() - 1);
+    index.heap_slots.push_back(npos);
     return true;
 }
 
@@ -71,57 +333,75 @@ bool LivelinessManager::remove_writer(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    for (LivelinessData& writer: writers_)
+    WriterIndex& index = index_of(this);
+    auto it = index.positions.find(WriterKey{guid, kind, lease_duration});
+    if (it == index.positions.end())
+    {
+        return false;
+    }
+
+    size_t position = it->second;
+    if (--writers_[position].count != 0)
+    {
+        return false;
+    }
+
+    LivelinessData writer = writers_[position];
+
+    if (index.heap_slots[position] != npos)
+    {
+        heap_erase(index, writers_, position);
+    }
+    if (timer_owner_ == &writers_[position])
+    {
+        // calculate_next will restart it for the next writer, if any
+        timer_owner_ = nullptr;
+        timer_.cancel_timer();
+    }
+    index.positions.erase(it);
+
+    // The last writer takes the place of the removed one
+    size_t last = writers_.size() - 1;
+    if (position != last)
     {
-        if (writer.guid == guid &&
-                writer.kind == kind &&
-                writer.lease_duration == lease_duration)
+        LivelinessData& moved = writers_[position];
+        moved = writers_[last];
+        index.heap_slots[position] = index.heap_slots[last];
+        if (index.heap_slots[position] != npos)
         {
-            if (--writer.count == 0)
-            {
-                writers_.remove(writer);
-
-                if (callback_ != nullptr)
-                {
-                    if (writer.status == LivelinessData::WriterStatus::ALIVE)
-                    {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
-                                -1,
-                                0);
-                    }
-                    else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
-                    {
-                        callback_(writer.guid,
-                                writer.kind,
-                                writer.lease_duration,
-                                0,
-                                -1);
-                    }
-                }
-
-                if (timer_owner_ != nullptr && timer_owner_->guid == guid)
-                {
-                    timer_owner_ = nullptr;
-                    if (!calculate_next())
-                    {
-                        timer_.cancel_timer();
-                        return true;
-                    }
-
-                    // Some times the interval could be negative if a writer expired during the call to this function
-                    // Once in this situation there is not much we can do but let asio timers expire inmediately
-                    auto interval = timer_owner_->time - steady_clock::now();
-                    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-                    timer_.restart_timer();
-                }
-                return true;
-            }
+            index.alive_heap[index.heap_slots[position]] = position;
+        }
+        index.positions[WriterKey{moved.guid, moved.kind, moved.lease_duration}] = position;
+        if (timer_owner_ == &writers_[last])
+        {
+            timer_owner_ = &moved;
+        }
+    }
+    writers_.pop_back();
+    index.heap_slots.pop_back();
+
+    if (callback_ != nullptr)
+    {
+        if (writer.status == LivelinessData::WriterStatus::ALIVE)
+        {
+            callback_(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    -1,
+                    0);
+        }
+        else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
+        {
+            callback_(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    0,
+                    -1);
         }
     }
 
-    return false;
+    calculate_next();
+    return true;
 }
 
 bool LivelinessManager::assert_liveliness(
@@ -132,46 +412,30 @@ bool LivelinessManager::assert_liveliness(
     std::unique_lock<std::mutex> lock(mutex_);
 
     ResourceLimitedVector<LivelinessData>::iterator wit;
-    if (!find_writer(
-                guid,
-                kind,
-                lease_duration,
-                &wit))
+    if (!find_writer(guid, kind, lease_duration, &wit))
     {
         return false;
     }
 
-    timer_.cancel_timer();
-
-    if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
-            wit->kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    if (kind == LivelinessQosPolicyKind::MANUAL_BY_PARTICIPANT_LIVELINESS_QOS ||
+            kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
     {
-        for (LivelinessData& w: writers_)
+        WriterIndex& index = index_of(this);
+        steady_clock::time_point now = steady_clock::now();
+        for (size_t position = 0; position < writers_.size(); ++position)
         {
-            if (w.kind == wit->kind)
+            if (writers_[position].kind == kind)
             {
-                assert_writer_liveliness(w);
+                assert_writer(index, writers_, position, now, callback_);
             }
         }
     }
-    else if (wit->kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
+    else if (kind == LivelinessQosPolicyKind::MANUAL_BY_TOPIC_LIVELINESS_QOS)
     {
         assert_writer_liveliness(*wit);
     }
 
-    // Updates the timer owner
-    if (!calculate_next())
-    {
-        logError(RTPS_WRITER, "Error when restarting liveliness timer");
-        return false;
-    }
-
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
-
+    calculate_next();
     return true;
 }
 
@@ -191,17 +455,16 @@ bool LivelinessManager::assert_liveliness(
         return true;
     }
 
-    timer_.cancel_timer();
-
-    for (LivelinessData& writer: writers_)
+    WriterIndex& index = index_of(this);
+    steady_clock::time_point now = steady_clock::now();
+    for (size_t position = 0; position < writers_.size(); ++position)
     {
-        if (writer.kind == kind)
+        if (writers_[position].kind == kind)
         {
-            assert_writer_liveliness(writer);
+            assert_writer(index, writers_, position, now, callback_);
         }
     }
 
-    // Updates the timer owner
     if (!calculate_next())
     {
         logInfo(RTPS_WRITER,
@@ -210,88 +473,116 @@ bool LivelinessManager::assert_liveliness(
         return false;
     }
 
-    // Some times the interval could be negative if a writer expired during the call to this function
-    // Once in this situation there is not much we can do but let asio timers expire inmediately
-    auto interval = timer_owner_->time - steady_clock::now();
-    timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
-    timer_.restart_timer();
-
     return true;
 }
 
-bool LivelinessManager::calculate_next()
+bool LivelinessManager::assert_liveliness(
+        LivelinessQosPolicyKind kind,
+        const GuidPrefix_t& guid_prefix)
 {
+    std::unique_lock<std::mutex> lock(mutex_);
 
-    timer_owner_ = nullptr;
-
-    steady_clock::time_point min_time = steady_clock::now() + nanoseconds(c_TimeInfinite.to_ns());
+    if (!manage_automatic_ && kind == LivelinessQosPolicyKind::AUTOMATIC_LIVELINESS_QOS)
+    {
+        logWarning(RTPS_WRITER, "Liveliness manager not managing automatic writers, writer not added");
+        return false;
+    }
 
-    bool any_alive = false;
+    if (writers_.empty())
+    {
+        return true;
+    }
 
-    for (LivelinessDataIterator it=writers_.begin(); it!=writers_.end(); ++it)
+    // Writers are indexed by GUID first, so the writers of a participant are contiguous on the index.
+    // No writer uses the unknown entity id, so this key is before all of them.
+    WriterIndex& index = index_of(this);
+    WriterKey first{GUID_t(guid_prefix, c_EntityId_Unknown), kind, Duration_t()};
+    steady_clock::time_point now = steady_clock::now();
+    for (auto it = index.positions.lower_bound(first);
+            it != index.positions.end() && it->first.guid.guidPrefix == guid_prefix;
+            ++it)
     {
-        if (it->status == LivelinessData::WriterStatus::ALIVE)
+        if (it->first.kind == kind)
         {
-            if (it->time < min_time)
-            {
-                min_time = it->time;
-                timer_owner_ = &*it;
-            }
-            any_alive = true;
+            assert_writer(index, writers_, it->second, now, callback_);
         }
     }
-    return any_alive;
+
+    return calculate_next();
 }
 
-bool LivelinessManager::timer_expired()
+bool LivelinessManager::calculate_next()
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    WriterIndex& index = index_of(this);
 
-    if (timer_owner_ == nullptr)
+    if (index.alive_heap.empty())
     {
-        logError(RTPS_WRITER, "Liveliness timer expired but there is no writer");
+        if (timer_owner_ != nullptr)
+        {
+            timer_owner_ = nullptr;
+            timer_.cancel_timer();
+        }
         return false;
     }
 
-    if (callback_ != nullptr)
-    {
-        callback_(timer_owner_->guid,
-                timer_owner_->kind,
-                timer_owner_->lease_duration,
-                -1,
-                1);
-    }
-    timer_owner_->status = LivelinessData::WriterStatus::NOT_ALIVE;
-
-    if (calculate_next())
+    // Assertions only delay the time when writers lose their liveliness, so the timer is only restarted when
+    // it has to expire earlier. Otherwise it will expire too soon, and timer_expired will schedule it again.
+    LivelinessData& next = writers_[index.alive_heap.front()];
+    if (timer_owner_ != nullptr && index.timer_time <= next.time)
     {
-        // Some times the interval could be negative if a writer expired during the call to this function
-        // Once in this situation there is not much we can do but let asio timers expire inmediately
-        auto interval = timer_owner_->time - steady_clock::now();
-        timer_.update_interval_millisec((double)duration_cast<milliseconds>(interval).count());
         return true;
     }
 
-    return false;
+    timer_.cancel_timer();
+    timer_owner_ = &next;
+    index.timer_time = next.time;
+    set_timer_interval(timer_, index.timer_time);
+    timer_.restart_timer();
+    return true;
 }
 
-bool LivelinessManager::find_writer(
-        const GUID_t& guid,
-        const LivelinessQosPolicyKind& kind,
-        const Duration_t& lease_duration,
-        ResourceLimitedVector<LivelinessData>::iterator* wit_out)
+bool LivelinessManager::timer_expired()
 {
-    for (LivelinessDataIterator it=writers_.begin(); it!=writers_.end(); ++it)
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    timer_owner_ = nullptr;
+
+    WriterIndex& index = index_of(this);
+    if (index.alive_heap.empty())
+    {
+        logError(RTPS_WRITER, "Liveliness timer expired but there is no writer");
+        return false;
+    }
+
+    // The timer could have been scheduled for a writer that asserted its liveliness afterwards,
+    // in which case nobody has lost its liveliness yet.
+    steady_clock::time_point now = steady_clock::now();
+    while (!index.alive_heap.empty() && writers_[index.alive_heap.front()].time <= now)
     {
-        if (it->guid == guid &&
-                it->kind == kind &&
-                it->lease_duration == lease_duration)
+        size_t position = index.alive_heap.front();
+        heap_erase(index, writers_, position);
+
+        LivelinessData& writer = writers_[position];
+        if (callback_ != nullptr)
         {
-            *wit_out = it;
-            return true;
+            callback_(writer.guid,
+                    writer.kind,
+                    writer.lease_duration,
+                    -1,
+                    1);
         }
+        writer.status = LivelinessData::WriterStatus::NOT_ALIVE;
+    }
+
+    if (index.alive_heap.empty())
+    {
+        return false;
     }
-    return false;
+
+    timer_owner_ = &writers_[index.alive_heap.front()];
+    index.timer_time = timer_owner_->time;
+    set_timer_interval(timer_, index.timer_time);
+    return true;
 }
 
 bool LivelinessManager::is_any_alive(
@@ -299,41 +590,30 @@ bool LivelinessManager::is_any_alive(
 {
     std::unique_lock<std::mutex> lock(mutex_);
 
-    for (const auto& writer : writers_)
-    {
-        if (writer.kind == kind && writer.status == LivelinessData::WriterStatus::ALIVE)
-        {
-            return true;
-        }
-    }
-    return false;
+    return kind < 3 && index_of(this).alive_count[kind] > 0;
 }
 
 void LivelinessManager::assert_writer_liveliness(
         LivelinessData& writer)
 {
-    if (callback_ != nullptr)
+    assert_writer(index_of(this), writers_, position_of(writers_, &writer), steady_clock::now(), callback_);
+}
+
+bool LivelinessManager::find_writer(
+        const GUID_t& guid,
+        const LivelinessQosPolicyKind& kind,
+        const Duration_t& lease_duration,
+        ResourceLimitedVector<LivelinessData>::iterator* wit_out)
+{
+    const WriterIndex& index = index_of(this);
+    auto it = index.positions.find(WriterKey{guid, kind, lease_duration});
+    if (it == index.positions.end())
     {
-        if (writer.status == LivelinessData::WriterStatus::NOT_ASSERTED)
-        {
-            callback_(writer.guid,
-                    writer.kind,
-                    writer.lease_duration,
-                    1,
-                    0);
-        }
-        else if (writer.status == LivelinessData::WriterStatus::NOT_ALIVE)
-        {
-            callback_(writer.guid,
-                    writer.kind,
-                    writer.lease_duration,
-                    1,
-                    -1);
-        }
+        return false;
     }
 
-    writer.status = LivelinessData::WriterStatus::ALIVE;
-    writer.time = steady_clock::now() + nanoseconds(writer.lease_duration.to_ns());
+    *wit_out = writers_.begin() + it->second;
+    return true;
 }
 
 const ResourceLimitedVector<LivelinessData>& LivelinessManager::get_liveliness_data() const
@@ -329,6 +329,8 @@ void RTPSWriter::compute_selected_guids()
 
 void RTPSWriter::update_cached_info_nts()
 {
+    // Locators of the matched readers may have changed
+    locator_selector_.clear_selection_cache();
     locator_selector_.reset(true);
     mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
 }
@@ -354,13 +356,15 @@ const std::vector<GUID_t>& RTPSWriter::remote_guids() const
 }
 
 bool RTPSWriter::send(
-        CDRMessage_t* message,
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     RTPSParticipantImpl* participant = getRTPSParticipant();
 
     return locator_selector_.selected_size() == 0 ||
-           participant->sendSync(message, locator_selector_.begin(), locator_selector_.end(), max_blocking_time_point);
+           participant->sendSync(buffers, total_bytes, locator_selector_.begin(), locator_selector_.end(),
+                   max_blocking_time_point);
 }
 
 const LivelinessQosPolicyKind& RTPSWriter::get_liveliness_kind() const
@@ -161,19 +161,20 @@ void ReaderLocator::stop()
 }
 
 bool ReaderLocator::send(
-        CDRMessage_t* message,
+        const std::vector<eprosima::fastdds::rtps::NetworkBuffer>& buffers,
+        uint32_t total_bytes,
         std::chrono::steady_clock::time_point& max_blocking_time_point) const
 {
     if (locator_info_.remote_guid != c_Guid_Unknown && !is_local_reader_)
     {
         if (locator_info_.unicast.size() > 0)
         {
-            return participant_owner_->sendSync(message, Locators(locator_info_.unicast.begin()),
+            return participant_owner_->sendSync(buffers, total_bytes, Locators(locator_info_.unicast.begin()),
                            Locators(locator_info_.unicast.end()), max_blocking_time_point);
         }
         else
         {
-            return participant_owner_->sendSync(message, Locators(locator_info_.multicast.begin()),
+            return participant_owner_->sendSync(buffers, total_bytes, Locators(locator_info_.multicast.begin()),
                            Locators(locator_info_.multicast.end()), max_blocking_time_point);
         }
     }
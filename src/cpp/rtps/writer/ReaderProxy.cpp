@@ -58,6 +58,7 @@ ReaderProxy::ReaderProxy(
     , initial_heartbeat_event_(nullptr)
     , timers_enabled_(false)
     , last_acknack_count_(0)
+    , acknack_count_at_heartbeat_(0)
     , last_nackfrag_count_(0)
 {
     nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
@@ -166,6 +167,7 @@ void ReaderProxy::stop()
 
     changes_for_reader_.clear();
     last_acknack_count_ = 0;
+    acknack_count_at_heartbeat_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
 }
@@ -52,9 +52,11 @@
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
+#include <algorithm>
 #include <mutex>
-#include <vector>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -205,6 +207,11 @@ static void null_sent_fun(
 {
 }
 
+//! Shortest heartbeat period used with adaptive reliability, in milliseconds.
+static constexpr double min_adaptive_heartbeat_period_ms = 1.0;
+//! Maximum number of times the adaptive heartbeat period is doubled while readers do not make progress.
+static constexpr uint32_t max_heartbeat_backoff = 16;
+
 using namespace std::chrono;
 
 StatefulWriter::StatefulWriter(
@@ -587,6 +594,10 @@ void StatefulWriter::sync_delivery(
 
             if (there_are_remote_readers_)
             {
+                if (m_times.adaptive_reliability)
+                {
+                    adapt_reliability_times_nts();
+                }
                 periodic_hb_event_->restart_timer(max_blocking_time);
             }
 
@@ -798,6 +809,10 @@ void StatefulWriter::send_any_unsent_changes()
 
     if (activateHeartbeatPeriod)
     {
+        if (m_times.adaptive_reliability)
+        {
+            adapt_reliability_times_nts();
+        }
         periodic_hb_event_->restart_timer();
     }
 
@@ -1551,6 +1566,8 @@ bool StatefulWriter::matched_reader_add(
     // Add info of new datareader.
     rp->start(rdata, is_datasharing_compatible_with(rdata));
     locator_selector_.add_entry(rp->locator_selector_entry());
+    // The low mark of the new reader may be below the current minimum
+    readers_at_min_low_mark_ = 0;
 
     if (rp->is_datasharing_reader())
     {
@@ -1913,6 +1930,7 @@ void StatefulWriter::rebuild_status_after_load()
     SequenceNumber_t next_seq = mp_history->next_sequence_number();
     next_all_acked_notify_sequence_ = next_seq;
     min_readers_low_mark_ = next_seq - 1;
+    readers_at_min_low_mark_ = 0;
     all_acked_ = true;
 }
 
@@ -1922,17 +1940,30 @@ void StatefulWriter::check_acked_status()
 
     bool all_acked = true;
     bool has_min_low_mark = false;
+    uint32_t readers_at_min_low_mark = 0;
     // #8945 If no readers matched, notify all old changes.
     SequenceNumber_t min_low_mark = mp_history->next_sequence_number() - 1;
 
+    // The work deferred by the ongoing batches of acknacks is done here
+    for (AcknackBatch& batch : acknack_batches_)
+    {
+        batch.acked_status_pending = false;
+        batch.acked_changes_pending = false;
+    }
+
     for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-            [&all_acked, &has_min_low_mark, &min_low_mark](ReaderProxy* reader)
+            [&all_acked, &has_min_low_mark, &readers_at_min_low_mark, &min_low_mark](ReaderProxy* reader)
             {
                 SequenceNumber_t reader_low_mark = reader->changes_low_mark();
                 if (reader_low_mark < min_low_mark || !has_min_low_mark)
                 {
                     has_min_low_mark = true;
                     min_low_mark = reader_low_mark;
+                    readers_at_min_low_mark = 1;
+                }
+                else if (reader_low_mark == min_low_mark)
+                {
+                    ++readers_at_min_low_mark;
                 }
 
                 if (reader->has_changes())
@@ -2022,14 +2053,114 @@ void StatefulWriter::check_acked_status()
         min_readers_low_mark_ = next_seq - 1;
         all_acked_ = true;
         all_acked_cond_.notify_all();
+
+        heartbeat_backoff_ = 0;
     }
 
+    // Later acknacks only need to walk the readers again when all the readers holding the minimum advance
+    readers_at_min_low_mark_ = (min_readers_low_mark_ == min_low_mark) ? readers_at_min_low_mark : 0;
+
     if (something_changed)
     {
         may_remove_change_cond_.notify_one();
     }
 }
 
+void StatefulWriter::reader_acked_changes_nts(
+        const ReaderProxy& reader,
+        const SequenceNumber_t& previous_low_mark)
+{
+    SequenceNumber_t low_mark = reader.changes_low_mark();
+
+    // The minimum can only change when the reader held it and was the last one doing so, and all the changes can
+    // only be acknowledged when the reader has none pending
+    bool must_check = !reader.has_changes() || 0 == readers_at_min_low_mark_ ||
+            previous_low_mark < min_readers_low_mark_ || low_mark < min_readers_low_mark_;
+    if (!must_check && low_mark != previous_low_mark && previous_low_mark == min_readers_low_mark_)
+    {
+        must_check = 0 == --readers_at_min_low_mark_;
+    }
+
+    // Only the batch of the calling thread defers the work, so other threads cannot postpone it
+    auto batch = std::find_if(acknack_batches_.begin(), acknack_batches_.end(),
+                    [](const AcknackBatch& b)
+                    {
+                        return b.thread == std::this_thread::get_id();
+                    });
+
+    if (must_check)
+    {
+        if (batch != acknack_batches_.end())
+        {
+            batch->acked_status_pending = true;
+        }
+        else
+        {
+            // Check if all CacheChange are acknowledge, because a user could be waiting
+            // for this, or some CacheChanges could be removed if we are VOLATILE
+            check_acked_status();
+        }
+    }
+    else if (low_mark != previous_low_mark)
+    {
+        // Changes acknowledged by some readers may complete the ones waited for by wait_for_acknowledgement
+        if (batch != acknack_batches_.end())
+        {
+            batch->acked_changes_pending = true;
+        }
+        else
+        {
+            may_remove_change_cond_.notify_one();
+        }
+    }
+}
+
+void StatefulWriter::begin_acknack_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    std::thread::id thread = std::this_thread::get_id();
+    auto batch = std::find_if(acknack_batches_.begin(), acknack_batches_.end(),
+                    [&thread](const AcknackBatch& b)
+                    {
+                        return b.thread == thread;
+                    });
+
+    // A batch left open by this thread, e.g. because the writer was unregistered from its receiver in the middle of
+    // it, is continued
+    if (batch == acknack_batches_.end())
+    {
+        AcknackBatch new_batch;
+        new_batch.thread = thread;
+        acknack_batches_.push_back(new_batch);
+    }
+}
+
+void StatefulWriter::end_acknack_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    auto batch = std::find_if(acknack_batches_.begin(), acknack_batches_.end(),
+                    [](const AcknackBatch& b)
+                    {
+                        return b.thread == std::this_thread::get_id();
+                    });
+    assert(batch != acknack_batches_.end());
+    if (batch == acknack_batches_.end())
+    {
+        return;
+    }
+
+    AcknackBatch ended = *batch;
+    acknack_batches_.erase(batch);
+    if (ended.acked_status_pending)
+    {
+        check_acked_status();
+    }
+    else if (ended.acked_changes_pending)
+    {
+        may_remove_change_cond_.notify_one();
+    }
+}
+
 bool StatefulWriter::try_remove_change(
         const std::chrono::steady_clock::time_point& max_blocking_time_point,
         std::unique_lock<RecursiveTimedMutex>& lock)
@@ -2123,7 +2254,20 @@ void StatefulWriter::updateTimes(
             it->update_nack_supression_interval(times.nackSupressionDuration);
         }
     }
+    if (m_times.adaptive_reliability && !times.adaptive_reliability)
+    {
+        // Go back to the configured times
+        periodic_hb_event_->update_interval(times.heartbeatPeriod);
+        if (nack_response_event_ != nullptr)
+        {
+            nack_response_event_->update_interval(times.nackResponseDelay);
+        }
+    }
     m_times = times;
+    if (m_times.adaptive_reliability)
+    {
+        adapt_reliability_times_nts();
+    }
 }
 
 void StatefulWriter::add_flow_controller(
@@ -2233,6 +2377,22 @@ bool StatefulWriter::send_periodic_heartbeat(
         }
     }
 
+    if (m_times.adaptive_reliability && !liveliness && unacked_changes)
+    {
+        // Wait longer while the readers do not acknowledge more changes, as they may be gone, overloaded or
+        // losing the repairs. Their NACKs are answered after the NACK response delay regardless of this period.
+        if (min_readers_low_mark_ == low_mark_at_last_heartbeat_)
+        {
+            heartbeat_backoff_ = std::min(heartbeat_backoff_ + 1, max_heartbeat_backoff);
+        }
+        else
+        {
+            heartbeat_backoff_ = 0;
+        }
+        low_mark_at_last_heartbeat_ = min_readers_low_mark_;
+        adapt_reliability_times_nts();
+    }
+
     return unacked_changes;
 }
 
@@ -2301,7 +2461,22 @@ void StatefulWriter::send_heartbeat_nts_(
     incrementHBCount();
     message_group.add_heartbeat(firstSeq, lastSeq, m_heartbeatCount, final, liveliness);
     // Update calculate of heartbeat piggyback.
-    currentUsageSendBufferSize_ = static_cast<int32_t>(sendBufferSize_);
+    currentUsageSendBufferSize_ = heartbeat_piggyback_budget();
+
+    if (m_times.adaptive_reliability && !final && !liveliness)
+    {
+        // Measure from the oldest unanswered heartbeat, unless it was sent so long ago it was probably lost
+        steady_clock::time_point now = steady_clock::now();
+        if (!heartbeat_answer_pending_ || now - last_heartbeat_time_ > nanoseconds(m_times.heartbeatPeriod.to_ns()))
+        {
+            last_heartbeat_time_ = now;
+            heartbeat_answer_pending_ = true;
+            for (ReaderProxy* reader : matched_remote_readers_)
+            {
+                reader->heartbeat_sent();
+            }
+        }
+    }
 
     logInfo(RTPS_WRITER, getGuid().entityId << " Sending Heartbeat (" << firstSeq << " - " << lastSeq << ")" );
 }
@@ -2341,6 +2516,71 @@ void StatefulWriter::send_heartbeat_piggyback_nts_(
     }
 }
 
+void StatefulWriter::adapt_reliability_times_nts()
+{
+    // Until the round trip time is measured, the configured times are used
+    if (smoothed_rtt_ms_ <= 0)
+    {
+        return;
+    }
+
+    // Heartbeat again once the readers have had time to answer, sooner while the unacknowledged data grows, and
+    // later while they do not make progress.
+    double period_ms = 2 * smoothed_rtt_ms_;
+    period_ms *= static_cast<double>(1u << heartbeat_backoff_);
+    period_ms *= 1.0 - unacknowledged_ratio() / 2;
+    period_ms = std::min(period_ms, TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
+    periodic_hb_event_->update_interval_millisec(std::max(period_ms, min_adaptive_heartbeat_period_ms));
+
+    // The acknacks answering a heartbeat arrive within a fraction of the round trip time
+    if (nack_response_event_ != nullptr)
+    {
+        double delay_ms = std::min(smoothed_rtt_ms_ / 4,
+                        TimeConv::Time_t2MilliSecondsDouble(m_times.nackResponseDelay));
+        nack_response_event_->update_interval_millisec(delay_ms);
+    }
+}
+
+void StatefulWriter::heartbeat_answered_nts(
+        const ReaderProxy& reader,
+        uint32_t ack_count)
+{
+    if (!heartbeat_answer_pending_ || !reader.answers_heartbeat(ack_count))
+    {
+        return;
+    }
+
+    heartbeat_answer_pending_ = false;
+    double rtt_ms = duration<double, std::milli>(steady_clock::now() - last_heartbeat_time_).count();
+    smoothed_rtt_ms_ = (smoothed_rtt_ms_ <= 0) ? rtt_ms : (7 * smoothed_rtt_ms_ + rtt_ms) / 8;
+    adapt_reliability_times_nts();
+}
+
+double StatefulWriter::unacknowledged_ratio() const
+{
+    const HistoryAttributes& att = mp_history->m_att;
+    int32_t capacity = (att.maximumReservedCaches > 0) ? att.maximumReservedCaches : att.initialReservedCaches;
+    SequenceNumber_t last_seq = mp_history->next_sequence_number() - 1;
+    if (capacity <= 0 || last_seq <= min_readers_low_mark_)
+    {
+        return 0;
+    }
+
+    double unacked = static_cast<double>(last_seq.to64long() - min_readers_low_mark_.to64long());
+    return std::min(1.0, unacked / capacity);
+}
+
+int32_t StatefulWriter::heartbeat_piggyback_budget() const
+{
+    if (!m_times.adaptive_reliability)
+    {
+        return static_cast<int32_t>(sendBufferSize_);
+    }
+
+    // Piggyback heartbeats more often, and even more as the unacknowledged data grows, so losses are reported sooner
+    return static_cast<int32_t>(sendBufferSize_ * (1.0 - 0.75 * unacknowledged_ratio()) / 2);
+}
+
 void StatefulWriter::perform_nack_response()
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
@@ -2406,9 +2646,15 @@ bool StatefulWriter::process_acknack(
                             if (remote_reader->check_and_set_acknack_count(ack_count))
                             {
                                 // Sequence numbers before Base are set as Acknowledged.
+                                SequenceNumber_t previous_low_mark = remote_reader->changes_low_mark();
                                 remote_reader->acked_changes_set(sn_set.base());
                                 if (sn_set.base() > SequenceNumber_t(0, 0))
                                 {
+                                    if (m_times.adaptive_reliability)
+                                    {
+                                        heartbeat_answered_nts(*remote_reader, ack_count);
+                                    }
+
                                     if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
                                     {
                                         nack_response_event_->restart_timer();
@@ -2443,9 +2689,7 @@ bool StatefulWriter::process_acknack(
                                     }
                                 }
 
-                                // Check if all CacheChange are acknowledge, because a user could be waiting
-                                // for this, or some CacheChanges could be removed if we are VOLATILE
-                                check_acked_status();
+                                reader_acked_changes_nts(*remote_reader, previous_low_mark);
                             }
                             return true;
                         }
@@ -2510,6 +2754,9 @@ bool StatefulWriter::ack_timer_expired()
     // In this case, we keep marking changes as acknowledged until the timer is able to keep up, hence the while
     // loop
 
+    // Low marks are moved without acknacks, so the readers holding the minimum must be counted again
+    readers_at_min_low_mark_ = 0;
+
     while (interval.count() < 0)
     {
         for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cstdlib>
 #include <cstring>
 #include <regex>
 #include <tinyxml2.h>
@@ -225,6 +226,140 @@ XMLP_ret XMLParser::getXMLSendBuffersAllocationAttributes(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLThreadPoolsSettings(
+        tinyxml2::XMLElement* elem,
+        fastdds::rtps::SharedThreadPoolsSettings& settings,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadPoolsType">
+            <xs:all minOccurs="0">
+                <xs:element name="enabled" type="boolType" minOccurs="0"/>
+                <xs:element name="timed_events" type="threadPoolType" minOccurs="0"/>
+                <xs:element name="async_writers" type="threadPoolType" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, ENABLED) == 0)
+        {
+            // enabled - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &settings.enabled, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, TIMED_EVENTS) == 0)
+        {
+            // timed_events - threadPoolType
+            if (XMLP_ret::XML_OK != getXMLThreadPoolSettings(p_aux0, settings.timed_events, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, ASYNC_WRITERS) == 0)
+        {
+            // async_writers - threadPoolType
+            if (XMLP_ret::XML_OK != getXMLThreadPoolSettings(p_aux0, settings.async_writers, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'threadPoolsType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLParser::getXMLThreadPoolSettings(
+        tinyxml2::XMLElement* elem,
+        fastdds::rtps::ThreadPoolSettings& settings,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadPoolType">
+            <xs:all minOccurs="0">
+                <xs:element name="num_threads" type="uint32Type" minOccurs="0"/>
+                <xs:element name="scheduling_policy" type="int32Type" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
+                <xs:element name="affinity" type="uint64Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, NUM_THREADS) == 0)
+        {
+            // num_threads - uint32Type
+            uint32_t tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &tmp, ident) || 0 == tmp)
+            {
+                logError(XMLPARSER, "Invalid value for '" << NUM_THREADS << "'");
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.num_threads = tmp;
+        }
+        else if (strcmp(name, SCHEDULING_POLICY) == 0)
+        {
+            // scheduling_policy - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.thread.scheduling_policy = tmp;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.thread.priority = tmp;
+        }
+        else if (strcmp(name, AFFINITY) == 0)
+        {
+            // affinity - uint64Type
+            const char* text = p_aux0->GetText();
+            char* end = nullptr;
+            if (nullptr == text || '\0' == *text || '-' == *text)
+            {
+                logError(XMLPARSER, "<" << p_aux0->Value() << "> getXMLUint XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            unsigned long long tmp = strtoull(text, &end, 10);
+            if ('\0' != *end)
+            {
+                logError(XMLPARSER, "<" << p_aux0->Value() << "> getXMLUint XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            settings.thread.affinity = static_cast<uint64_t>(tmp);
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'threadPoolType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLDiscoverySettings(
         tinyxml2::XMLElement* elem,
         rtps::DiscoverySettings& settings,
@@ -507,6 +642,14 @@ XMLP_ret XMLParser::getXMLBuiltinAttributes(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, LAZY_BUILTIN_ENDPOINTS) == 0)
+        {
+            // lazy_builtin_endpoints - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &builtin.lazy_builtin_endpoints, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'builtinAttributesType'. Name: " << name);
@@ -2586,6 +2729,7 @@ XMLP_ret XMLParser::getXMLWriterTimes(
                 <xs:element name="heartbeatPeriod" type="durationType" minOccurs="0"/>
                 <xs:element name="nackResponseDelay" type="durationType" minOccurs="0"/>
                 <xs:element name="nackSupressionDuration" type="durationType" minOccurs="0"/>
+                <xs:element name="adaptiveReliability" type="boolType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -2626,6 +2770,14 @@ XMLP_ret XMLParser::getXMLWriterTimes(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, ADAPTIVE_RELIABILITY) == 0)
+        {
+            // adaptiveReliability - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &times.adaptive_reliability, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'writerTimesType'. Name: " << name);
@@ -239,6 +239,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="async_io_threads" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -497,7 +498,8 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 strcmp(name, MAX_LOGICAL_PORT) == 0 || strcmp(name, LOGICAL_PORT_RANGE) == 0 ||
                 strcmp(name, LOGICAL_PORT_INCREMENT) == 0 || strcmp(name, LISTENING_PORTS) == 0 ||
                 strcmp(name, CALCULATE_CRC) == 0 || strcmp(name, CHECK_CRC) == 0 ||
-                strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, TLS) == 0 ||
+                strcmp(name, ENABLE_TCP_NODELAY) == 0 || strcmp(name, ASYNC_IO_THREADS) == 0 ||
+                strcmp(name, TLS) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0  ||
                 strcmp(name, SEGMENT_SIZE) == 0 || strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 || strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0 ||
@@ -535,6 +537,7 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="async_io_threads" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -608,6 +611,16 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, ASYNC_IO_THREADS) == 0)
+            {
+                // async_io_threads - uint16Type
+                int iThreads(0);
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &iThreads, 0) || iThreads < 0 || iThreads > 65535)
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                pTCPDesc->async_io_threads = static_cast<uint16_t>(iThreads);
+            }
             else if (strcmp(name, LISTENING_PORTS) == 0)
             {
                 // listening_ports uint16ListType
@@ -1135,7 +1148,8 @@ XMLP_ret XMLParser::parseXMLLibrarySettings(
     /*
         <xs:complexType name="LibrarySettingsType">
             <xs:all minOccurs="0">
-                <xs:element name="intraprocess_delivery" type="IntraprocessDeliveryType"/>
+                <xs:element name="intraprocess_delivery" type="IntraprocessDeliveryType" minOccurs="0"/>
+                <xs:element name="thread_pools" type="threadPoolsType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -1145,8 +1159,10 @@ XMLP_ret XMLParser::parseXMLLibrarySettings(
 
     uint8_t ident = 1;
     tinyxml2::XMLElement* p_aux0 = nullptr;
+    tinyxml2::XMLElement* p_aux1 = nullptr;
     p_aux0 = p_root->FirstChildElement(INTRAPROCESS_DELIVERY);
-    if (nullptr == p_aux0)
+    p_aux1 = p_root->FirstChildElement(THREAD_POOLS);
+    if (nullptr == p_aux0 && nullptr == p_aux1)
     {
         logError(XMLPARSER, "Not found '" << INTRAPROCESS_DELIVERY << "' attribute");
         return XMLP_ret::XML_ERROR;
@@ -1154,7 +1170,14 @@ XMLP_ret XMLParser::parseXMLLibrarySettings(
     else
     {
         LibrarySettingsAttributes library_settings;
-        if (XMLP_ret::XML_OK != getXMLEnum(p_aux0, &library_settings.intraprocess_delivery, ident))
+        if (nullptr != p_aux0 &&
+                XMLP_ret::XML_OK != getXMLEnum(p_aux0, &library_settings.intraprocess_delivery, ident))
+        {
+            return XMLP_ret::XML_ERROR;
+        }
+
+        if (nullptr != p_aux1 &&
+                XMLP_ret::XML_OK != getXMLThreadPoolsSettings(p_aux1, library_settings.thread_pools, ident))
         {
             return XMLP_ret::XML_ERROR;
         }
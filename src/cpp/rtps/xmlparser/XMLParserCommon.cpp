@@ -53,6 +53,7 @@ const char* MAX_LOGICAL_PORT = "max_logical_port";
 const char* LOGICAL_PORT_RANGE = "logical_port_range";
 const char* LOGICAL_PORT_INCREMENT = "logical_port_increment";
 const char* ENABLE_TCP_NODELAY = "enable_tcp_nodelay";
+const char* ASYNC_IO_THREADS = "async_io_threads";
 const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
@@ -80,6 +81,13 @@ const char* DATA_READER = "data_reader";
 
 /// RTPS Domain attributes
 const char* INTRAPROCESS_DELIVERY = "intraprocess_delivery";
+const char* THREAD_POOLS = "thread_pools";
+const char* TIMED_EVENTS = "timed_events";
+const char* ASYNC_WRITERS = "async_writers";
+const char* NUM_THREADS = "num_threads";
+const char* SCHEDULING_POLICY = "scheduling_policy";
+const char* PRIORITY = "priority";
+const char* AFFINITY = "affinity";
 
 /// RTPS Participant attributes
 const char* ALLOCATION = "allocation";
@@ -160,6 +168,7 @@ const char* INIT_HEARTB_DELAY = "initialHeartbeatDelay";
 const char* HEARTB_PERIOD = "heartbeatPeriod";
 const char* NACK_RESP_DELAY = "nackResponseDelay";
 const char* NACK_SUPRESSION = "nackSupressionDuration";
+const char* ADAPTIVE_RELIABILITY = "adaptiveReliability";
 const char* BY_NAME = "durationbyname";
 const char* BY_VAL = "durationbyval";
 const char* SECONDS = "sec";
@@ -260,6 +269,7 @@ const char* LEASEDURATION = "leaseDuration";
 const char* LEASE_ANNOUNCE = "leaseAnnouncement";
 const char* INITIAL_ANNOUNCEMENTS = "initialAnnouncements";
 const char* AVOID_BUILTIN_MULTICAST = "avoid_builtin_multicast";
+const char* LAZY_BUILTIN_ENDPOINTS = "lazy_builtin_endpoints";
 const char* SIMPLE_EDP = "simpleEDP";
 const char* META_UNI_LOC_LIST = "metatrafficUnicastLocatorList";
 const char* META_MULTI_LOC_LIST = "metatrafficMulticastLocatorList";
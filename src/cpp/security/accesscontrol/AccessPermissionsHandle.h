@@ -21,6 +21,7 @@
 #include <fastdds/rtps/security/common/Handle.h>
 #include <fastdds/rtps/common/Token.h>
 #include <security/accesscontrol/PermissionsTypes.h>
+#include <security/accesscontrol/CompiledAccessRules.h>
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
@@ -62,6 +63,10 @@ public:
     ParticipantSecurityAttributes governance_rule_;
     std::vector<std::pair<std::string, EndpointSecurityAttributes>> governance_topic_rules_;
     Grant grant;
+    //! Built from grant and governance_topic_rules_ once both are loaded
+    std::vector<CompiledRule> compiled_rules_;
+    std::vector<NameMatcher> governance_topic_matchers_;
+    mutable AccessDecisionCache decisions_;
 };
 
 typedef HandleImpl<AccessPermissions> AccessPermissionsHandle;
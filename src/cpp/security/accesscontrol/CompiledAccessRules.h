@@ -0,0 +1,165 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file CompiledAccessRules.h
+ */
+#ifndef __SECURITY_ACCESSCONTROL_COMPILEDACCESSRULES_H__
+#define __SECURITY_ACCESSCONTROL_COMPILEDACCESSRULES_H__
+
+#include <security/accesscontrol/PermissionsTypes.h>
+#include <fastrtps/utils/StringMatching.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/*!
+ * Topic or partition expression of a permissions or governance document.
+ * Expressions without wildcards are compared directly, avoiding a call to the pattern matching API.
+ */
+class NameMatcher
+{
+public:
+
+    explicit NameMatcher(
+            const std::string& expression)
+        : expression_(expression)
+        , is_pattern_(has_wildcards(expression))
+    {
+    }
+
+    static bool has_wildcards(
+            const std::string& name)
+    {
+#if defined(_WIN32)
+        // PathMatchSpec is case insensitive, so every expression is a pattern.
+        (void)name;
+        return true;
+#else
+        return name.find_first_of("*?[") != std::string::npos;
+#endif // if defined(_WIN32)
+    }
+
+    //! Same result as StringMatching::matchPattern(expression, name)
+    bool match(
+            const std::string& name) const
+    {
+        if (!is_pattern_)
+        {
+            return expression_ == name;
+        }
+
+        return StringMatching::matchPattern(expression_.c_str(), name.c_str());
+    }
+
+    //! Same result as StringMatching::matchString(expression, name)
+    bool match_any(
+            const std::string& name) const
+    {
+        if (!is_pattern_ && !has_wildcards(name))
+        {
+            return expression_ == name;
+        }
+
+        return StringMatching::matchString(expression_.c_str(), name.c_str());
+    }
+
+private:
+
+    std::string expression_;
+    bool is_pattern_;
+};
+
+struct CompiledCriteria
+{
+    std::vector<NameMatcher> topics;
+    std::vector<NameMatcher> partitions;
+};
+
+//! Rule of a grant with its topic and partition expressions already classified
+struct CompiledRule
+{
+    bool allow = false;
+    Domains domains;
+    std::vector<CompiledCriteria> publishes;
+    std::vector<CompiledCriteria> subscribes;
+    std::vector<CompiledCriteria> relays;
+};
+
+//! Result of an access control check on an endpoint
+struct AccessDecision
+{
+    bool allowed = false;
+    bool relay_only = false;
+    //! Message of the exception, when not allowed
+    std::string error;
+};
+
+/*!
+ * Results of the access control checks on the endpoints of a participant.
+ * During discovery the same topic and partitions are checked for every matched endpoint, and the result
+ * only depends on the permissions documents, which never change for a handle.
+ */
+class AccessDecisionCache
+{
+public:
+
+    bool find(
+            const std::string& key,
+            AccessDecision& decision) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = decisions_.find(key);
+        if (it == decisions_.end())
+        {
+            return false;
+        }
+        decision = it->second;
+        return true;
+    }
+
+    void add(
+            const std::string& key,
+            const AccessDecision& decision)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Keys come from remote discovery data, so the cache is bounded.
+        if (decisions_.size() >= max_decisions)
+        {
+            decisions_.clear();
+        }
+        decisions_.emplace(key, decision);
+    }
+
+    static constexpr size_t max_decisions = 4096;
+
+private:
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, AccessDecision> decisions_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // __SECURITY_ACCESSCONTROL_COMPILEDACCESSRULES_H__
@@ -86,16 +86,16 @@ static bool is_domain_in_set(
 }
 
 static const EndpointSecurityAttributes* is_topic_in_sec_attributes(
-        const char* topic_name,
-        const std::vector<std::pair<std::string, EndpointSecurityAttributes>>& attributes)
+        const std::string& topic_name,
+        const AccessPermissions& permissions)
 {
     const EndpointSecurityAttributes* returned_value = nullptr;
 
-    for (auto& topic : attributes)
+    for (size_t i = 0; i < permissions.governance_topic_matchers_.size(); ++i)
     {
-        if (StringMatching::matchString(topic.first.c_str(), topic_name))
+        if (permissions.governance_topic_matchers_[i].match_any(topic_name))
         {
-            returned_value = &topic.second;
+            returned_value = &permissions.governance_topic_rules_[i].second;
             break;
         }
     }
@@ -104,17 +104,17 @@ static const EndpointSecurityAttributes* is_topic_in_sec_attributes(
 }
 
 static bool is_topic_in_criterias(
-        const char* topic_name,
-        const std::vector<Criteria>& criterias)
+        const std::string& topic_name,
+        const std::vector<CompiledCriteria>& criterias)
 {
     bool returned_value = false;
 
     for (auto criteria_it = criterias.begin(); !returned_value &&
             criteria_it != criterias.end(); ++criteria_it)
     {
-        for (auto topic : (*criteria_it).topics)
+        for (const NameMatcher& topic : (*criteria_it).topics)
         {
-            if (StringMatching::matchPattern(topic.c_str(), topic_name))
+            if (topic.match(topic_name))
             {
                 returned_value = true;
                 break;
@@ -127,16 +127,16 @@ static bool is_topic_in_criterias(
 
 static bool is_partition_in_criterias(
         const std::string& partition,
-        const std::vector<Criteria>& criterias)
+        const std::vector<CompiledCriteria>& criterias)
 {
     bool returned_value = false;
 
     for (auto criteria_it = criterias.begin(); !returned_value &&
             criteria_it != criterias.end(); ++criteria_it)
     {
-        for (auto part : (*criteria_it).partitions)
+        for (const NameMatcher& part : (*criteria_it).partitions)
         {
-            if (StringMatching::matchPattern(part.c_str(), partition.c_str()))
+            if (part.match(partition))
             {
                 returned_value = true;
                 break;
@@ -148,10 +148,10 @@ static bool is_partition_in_criterias(
 }
 
 static bool check_rule(
-        const char* topic_name,
-        const Rule& rule,
+        const std::string& topic_name,
+        const CompiledRule& rule,
         const std::vector<std::string>& partitions,
-        const std::vector<Criteria>& criterias,
+        const std::vector<CompiledCriteria>& criterias,
         SecurityException& exception)
 {
     bool returned_value = false;
@@ -190,6 +190,181 @@ static bool check_rule(
     return returned_value;
 }
 
+static void compile_criterias(
+        const std::vector<Criteria>& criterias,
+        std::vector<CompiledCriteria>& compiled)
+{
+    compiled.reserve(criterias.size());
+
+    for (const Criteria& criteria : criterias)
+    {
+        CompiledCriteria compiled_criteria;
+        for (const std::string& topic : criteria.topics)
+        {
+            compiled_criteria.topics.emplace_back(topic);
+        }
+        for (const std::string& partition : criteria.partitions)
+        {
+            compiled_criteria.partitions.emplace_back(partition);
+        }
+        compiled.push_back(std::move(compiled_criteria));
+    }
+}
+
+// Called once the grant and the governance topic rules of the handle are loaded
+static void compile_access_rules(
+        AccessPermissionsHandle& handle)
+{
+    AccessPermissions& permissions = **handle;
+
+    permissions.compiled_rules_.clear();
+    permissions.compiled_rules_.reserve(permissions.grant.rules.size());
+
+    for (const Rule& rule : permissions.grant.rules)
+    {
+        CompiledRule compiled_rule;
+        compiled_rule.allow = rule.allow;
+        compiled_rule.domains = rule.domains;
+        compile_criterias(rule.publishes, compiled_rule.publishes);
+        compile_criterias(rule.subscribes, compiled_rule.subscribes);
+        compile_criterias(rule.relays, compiled_rule.relays);
+        permissions.compiled_rules_.push_back(std::move(compiled_rule));
+    }
+
+    permissions.governance_topic_matchers_.clear();
+    permissions.governance_topic_matchers_.reserve(permissions.governance_topic_rules_.size());
+
+    for (auto& topic_rule : permissions.governance_topic_rules_)
+    {
+        permissions.governance_topic_matchers_.emplace_back(topic_rule.first);
+    }
+}
+
+enum class EndpointAccess : char
+{
+    CREATE_WRITER = 'w',
+    CREATE_READER = 'r',
+    REMOTE_WRITER = 'W',
+    REMOTE_READER = 'R'
+};
+
+static std::string access_decision_key(
+        const EndpointAccess access,
+        const uint32_t domain_id,
+        const std::string& topic_name,
+        const std::vector<std::string>& partitions)
+{
+    // Names cannot contain null characters, so they are used as separators.
+    std::string key;
+    key.reserve(1 + sizeof(domain_id) + topic_name.size() + 1 + partitions.size() * 16);
+    key.push_back(static_cast<char>(access));
+    key.append(reinterpret_cast<const char*>(&domain_id), sizeof(domain_id));
+    key.append(topic_name);
+    key.push_back('\0');
+    for (const std::string& partition : partitions)
+    {
+        key.append(partition);
+        key.push_back('\0');
+    }
+    return key;
+}
+
+static bool evaluate_endpoint_access(
+        const AccessPermissions& permissions,
+        const EndpointAccess access,
+        const uint32_t domain_id,
+        const std::string& topic_name,
+        const std::vector<std::string>& partitions,
+        bool& relay_only,
+        SecurityException& exception)
+{
+    bool returned_value = false;
+    bool is_writer = access == EndpointAccess::CREATE_WRITER || access == EndpointAccess::REMOTE_WRITER;
+    bool is_remote = access == EndpointAccess::REMOTE_WRITER || access == EndpointAccess::REMOTE_READER;
+    const EndpointSecurityAttributes* attributes = nullptr;
+
+    if ((attributes = is_topic_in_sec_attributes(topic_name, permissions)) != nullptr)
+    {
+        if (is_writer ? !attributes->is_write_protected : !attributes->is_read_protected)
+        {
+            return true;
+        }
+    }
+    else
+    {
+        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
+        return false;
+    }
+
+    // Search topic
+    for (const CompiledRule& rule : permissions.compiled_rules_)
+    {
+        if (is_remote && !is_domain_in_set(domain_id, rule.domains))
+        {
+            continue;
+        }
+
+        const std::vector<CompiledCriteria>& criterias = is_writer ? rule.publishes : rule.subscribes;
+        if (is_topic_in_criterias(topic_name, criterias))
+        {
+            returned_value = check_rule(topic_name, rule, partitions, criterias, exception);
+            break;
+        }
+
+        if (access == EndpointAccess::REMOTE_READER && is_topic_in_criterias(topic_name, rule.relays))
+        {
+            returned_value = check_rule(topic_name, rule, partitions, rule.relays, exception);
+            if (returned_value)
+            {
+                relay_only = true;
+            }
+
+            break;
+        }
+    }
+
+    if (!returned_value && strlen(exception.what()) == 0)
+    {
+        exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
+    }
+
+    return returned_value;
+}
+
+static bool check_endpoint_access(
+        const AccessPermissions& permissions,
+        const EndpointAccess access,
+        const uint32_t domain_id,
+        const std::string& topic_name,
+        const std::vector<std::string>& partitions,
+        bool& relay_only,
+        SecurityException& exception)
+{
+    std::string key = access_decision_key(access, domain_id, topic_name, partitions);
+    AccessDecision decision;
+
+    if (!permissions.decisions_.find(key, decision))
+    {
+        SecurityException evaluation_exception;
+        decision.allowed = evaluate_endpoint_access(permissions, access, domain_id, topic_name, partitions,
+                        decision.relay_only, evaluation_exception);
+        if (!decision.allowed)
+        {
+            decision.error = evaluation_exception.what();
+        }
+        permissions.decisions_.add(key, decision);
+    }
+
+    relay_only = decision.relay_only;
+
+    if (!decision.allowed)
+    {
+        exception = SecurityException(decision.error);
+    }
+
+    return decision.allowed;
+}
+
 static bool is_validation_in_time(
         const Validity& validity)
 {
@@ -912,6 +1087,7 @@ PermissionsHandle* Permissions::validate_local_permissions(
                     {
                         if (generate_credentials_token(*ah, *permissions, exception))
                         {
+                            compile_access_rules(*ah);
                             return ah;
                         }
                     }
@@ -1085,6 +1261,7 @@ PermissionsHandle* Permissions::validate_remote_permissions(
     (*handle)->grant = std::move(remote_grant);
     (*handle)->governance_rule_ = lph->governance_rule_;
     (*handle)->governance_topic_rules_ = lph->governance_topic_rules_;
+    compile_access_rules(*handle);
 
     return handle;
 }
@@ -1174,7 +1351,6 @@ bool Permissions::check_create_datawriter(
         const std::vector<std::string>& partitions,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
     if (lah.nil())
@@ -1184,38 +1360,12 @@ bool Permissions::check_create_datawriter(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
-    {
-        if (!attributes->is_write_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    // Search topic
-    for (auto rule : lah->grant.rules)
-    {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.publishes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.publishes, exception);
-            break;
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint_access(**lah, EndpointAccess::CREATE_WRITER, 0, topic_name, partitions,
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1229,7 +1379,6 @@ bool Permissions::check_create_datareader(
         const std::vector<std::string>& partitions,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
     if (lah.nil())
@@ -1239,37 +1388,12 @@ bool Permissions::check_create_datareader(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
-    {
-        if (!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : lah->grant.rules)
-    {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.subscribes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.subscribes, exception);
-            break;
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint_access(**lah, EndpointAccess::CREATE_READER, 0, topic_name, partitions,
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1282,9 +1406,7 @@ bool Permissions::check_remote_datawriter(
         const WriterProxyData& publication_data,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
-    const char* topic_name = publication_data.topicName().c_str();
 
     if (rah.nil())
     {
@@ -1293,43 +1415,13 @@ bool Permissions::check_remote_datawriter(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
-            != nullptr)
-    {
-        if (!attributes->is_write_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_(
-            "Not found topic access rule for topic " + publication_data.topicName().to_string());
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : rah->grant.rules)
-    {
-        if (is_domain_in_set(domain_id, rule.domains))
-        {
-            if (is_topic_in_criterias(topic_name, rule.publishes))
-            {
-                returned_value = check_rule(topic_name, rule, publication_data.m_qos.m_partition.getNames(),
-                                rule.publishes, exception);
-                break;
-            }
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint_access(**rah, EndpointAccess::REMOTE_WRITER, domain_id,
+                    publication_data.topicName().to_string(), publication_data.m_qos.m_partition.getNames(),
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1343,9 +1435,7 @@ bool Permissions::check_remote_datareader(
         bool& relay_only,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
-    const char* topic_name = subscription_data.topicName().c_str();
 
     relay_only = false;
 
@@ -1356,54 +1446,12 @@ bool Permissions::check_remote_datareader(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
-            != nullptr)
-    {
-        if (!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_(
-            "Not found topic access rule for topic " + subscription_data.topicName().to_string());
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : rah->grant.rules)
-    {
-        if (is_domain_in_set(domain_id, rule.domains))
-        {
-            const std::vector<std::string>& partitions = subscription_data.m_qos.m_partition.getNames();
-            if (is_topic_in_criterias(topic_name, rule.subscribes))
-            {
-                returned_value = check_rule(topic_name, rule, partitions, rule.subscribes, exception);
-                break;
-            }
-
-            if (is_topic_in_criterias(topic_name, rule.relays))
-            {
-                returned_value = check_rule(topic_name, rule, partitions, rule.relays, exception);
-                if (returned_value)
-                {
-                    relay_only = true;
-                }
-
-                break;
-            }
-        }
-    }
+    bool returned_value = check_endpoint_access(**rah, EndpointAccess::REMOTE_READER, domain_id,
+                    subscription_data.topicName().to_string(), subscription_data.m_qos.m_partition.getNames(),
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1438,8 +1486,7 @@ bool Permissions::get_datawriter_sec_attributes(
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if ((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_))
-            != nullptr)
+    if ((attr = is_topic_in_sec_attributes(topic_name, **lah)) != nullptr)
     {
         attributes = *attr;
         return true;
@@ -1463,8 +1510,7 @@ bool Permissions::get_datareader_sec_attributes(
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if ((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_))
-            != nullptr)
+    if ((attr = is_topic_in_sec_attributes(topic_name, **lah)) != nullptr)
     {
         attributes = *attr;
         return true;
@@ -24,7 +24,12 @@
 #include <openssl/aes.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
+#include <openssl/crypto.h>
+
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <vector>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000L
 #define IS_OPENSSL_1_1 1
@@ -42,6 +47,153 @@ using namespace eprosima::fastrtps::rtps::security;
 
 CONSTEXPR int initialization_vector_suffix_length = 8;
 
+/**
+ * Cipher contexts already initialized with a session key.
+ * Each thread keeps its own contexts, so encoding or decoding with a known session key only has to set the new
+ * initialization vector, instead of allocating a context and expanding the key for every submessage and receiver.
+ * When full, the least recently used context is replaced. The copies of the session keys are wiped when their
+ * context is released, and when the thread exits.
+ */
+class CipherContextCache
+{
+public:
+
+    CipherContextCache()
+    {
+        // Entries are never moved, so no copy of a session key is left behind
+        entries_.reserve(max_contexts);
+    }
+
+    ~CipherContextCache()
+    {
+        clear();
+    }
+
+    /**
+     * Get a context ready to encrypt or decrypt with the given key and initialization vector.
+     * The context belongs to the cache and must not be freed.
+     * @return nullptr if the context could not be initialized.
+     */
+    EVP_CIPHER_CTX* get(
+            const EVP_CIPHER* cipher,
+            bool encrypt,
+            const uint8_t* key,
+            const uint8_t* initialization_vector)
+    {
+        size_t key_len = static_cast<size_t>(EVP_CIPHER_key_length(cipher));
+
+        auto it = std::find_if(entries_.begin(), entries_.end(), [&](const Entry& entry)
+                        {
+                            return entry.ctx != nullptr && entry.cipher == cipher && entry.encrypt == encrypt &&
+                            0 == memcmp(entry.key.data(), key, key_len);
+                        });
+
+        Entry* entry = (it != entries_.end()) ? &(*it) : nullptr;
+        if (entry == nullptr)
+        {
+            entry = &free_entry();
+            entry->cipher = cipher;
+            entry->encrypt = encrypt;
+            memcpy(entry->key.data(), key, key_len);
+            entry->ctx = EVP_CIPHER_CTX_new();
+            if (entry->ctx == nullptr || !init(entry->ctx, cipher, encrypt, key, nullptr))
+            {
+                release(*entry);
+                return nullptr;
+            }
+        }
+
+        if (!init(entry->ctx, nullptr, encrypt, nullptr, initialization_vector))
+        {
+            release(*entry);
+            return nullptr;
+        }
+
+        entry->last_use = ++use_count_;
+        return entry->ctx;
+    }
+
+private:
+
+    struct Entry
+    {
+        const EVP_CIPHER* cipher = nullptr;
+        bool encrypt = true;
+        std::array<uint8_t, 32> key{};
+        EVP_CIPHER_CTX* ctx = nullptr;
+        uint64_t last_use = 0;
+    };
+
+    //! Entry without context, releasing the least recently used one when the cache is full
+    Entry& free_entry()
+    {
+        Entry* oldest = nullptr;
+        for (Entry& entry : entries_)
+        {
+            if (entry.ctx == nullptr)
+            {
+                return entry;
+            }
+            if (oldest == nullptr || entry.last_use < oldest->last_use)
+            {
+                oldest = &entry;
+            }
+        }
+
+        if (entries_.size() < max_contexts)
+        {
+            entries_.emplace_back();
+            return entries_.back();
+        }
+
+        release(*oldest);
+        return *oldest;
+    }
+
+    static bool init(
+            EVP_CIPHER_CTX* ctx,
+            const EVP_CIPHER* cipher,
+            bool encrypt,
+            const uint8_t* key,
+            const uint8_t* initialization_vector)
+    {
+        return encrypt ?
+               1 == EVP_EncryptInit_ex(ctx, cipher, nullptr, key, initialization_vector) :
+               1 == EVP_DecryptInit_ex(ctx, cipher, nullptr, key, initialization_vector);
+    }
+
+    static void release(
+            Entry& entry)
+    {
+        if (entry.ctx != nullptr)
+        {
+            EVP_CIPHER_CTX_free(entry.ctx);
+            entry.ctx = nullptr;
+        }
+        OPENSSL_cleanse(entry.key.data(), entry.key.size());
+    }
+
+    void clear()
+    {
+        for (Entry& entry : entries_)
+        {
+            release(entry);
+        }
+        entries_.clear();
+    }
+
+    static constexpr size_t max_contexts = 64;
+
+    std::vector<Entry> entries_;
+    uint64_t use_count_ = 0;
+};
+
+static CipherContextCache& cipher_contexts()
+{
+    static thread_local CipherContextCache cache;
+    return cache;
+}
+
 static KeyMaterial_AES_GCM_GMAC* find_key(
         KeyMaterial_AES_GCM_GMAC_Seq& keys,
         const CryptoTransformIdentifier& id)
@@ -1543,32 +1695,13 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
     // AES_BLOCK_SIZE = 16
-    int cipher_block_size = 0, actual_size = 0, final_size = 0;
-    EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-
-    if (!use_256_bits)
-    {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
-    }
-    else
+    const EVP_CIPHER* e_cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+    int cipher_block_size = EVP_CIPHER_block_size(e_cipher), actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* e_ctx = cipher_contexts().get(e_cipher, true, session_key.data(), initialization_vector.data());
+    if (e_ctx == nullptr)
     {
-        if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(), (const unsigned char*)(session_key.data()),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
+        logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+        return false;
     }
 
     if (!do_encryption)
@@ -1578,7 +1711,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 plain_buffer_len)
         {
             logError(SECURITY_CRYPTO, "Not enough memory to copy payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
         memcpy(serializer.getCurrentPosition(), plain_buffer, plain_buffer_len);
@@ -1587,14 +1719,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
         if (!EVP_EncryptUpdate(e_ctx, nullptr, &actual_size, plain_buffer, static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, nullptr, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, nullptr, &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
     }
@@ -1638,7 +1768,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 (plain_buffer_len + (2 * cipher_block_size) - 1))
         {
             logError(SECURITY_CRYPTO, "Not enough memory to cipher payload");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
@@ -1646,14 +1775,12 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
                 static_cast<int>(plain_buffer_len)))
         {
             logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             return false;
         }
 
-        if (!EVP_EncryptFinal(e_ctx, &output_buffer_raw[actual_size], &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, &output_buffer_raw[actual_size], &final_size))
         {
-            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptFinal_ex function returns an error");
             return false;
         }
 
@@ -1679,7 +1806,6 @@ bool AESGCMGMAC_Transform::serialize_SecureDataBody(
 
     // Get commmon_mac
     EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
-    EVP_CIPHER_CTX_free(e_ctx);
 
     if (submessage)
     {
@@ -1761,49 +1887,28 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        if (transformation_kind == c_transfrom_kind_aes128_gcm ||
-                transformation_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (transformation_kind == c_transfrom_kind_aes256_gcm ||
-                transformation_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = cipher_contexts().get(use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(), true,
+                        remote_entity->Sessions[sessionIndex].SessionKey.data(), initialization_vector.data());
+        if (e_ctx == nullptr)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_entity->Sessions[sessionIndex].SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
             logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_entity->Remote2EntityKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1872,50 +1977,28 @@ bool AESGCMGMAC_Transform::serialize_SecureDataTag(
 
         //Obtain MAC using ReceiverSpecificKey and the same Initialization Vector as before
         int actual_size = 0, final_size = 0;
-        EVP_CIPHER_CTX* e_ctx = EVP_CIPHER_CTX_new();
-        auto& trans_kind = remote_participant->Participant2ParticipantKeyMaterial.at(0).transformation_kind;
-        if (trans_kind == c_transfrom_kind_aes128_gcm ||
-                trans_kind == c_transfrom_kind_aes128_gmac)
-        {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_128_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
-        }
-        else if (trans_kind == c_transfrom_kind_aes256_gcm ||
-                trans_kind == c_transfrom_kind_aes256_gmac)
+        EVP_CIPHER_CTX* e_ctx = cipher_contexts().get(use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm(), true,
+                        remote_participant->Session.SessionKey.data(), initialization_vector.data());
+        if (e_ctx == nullptr)
         {
-            if (!EVP_EncryptInit(e_ctx, EVP_aes_256_gcm(),
-                    (const unsigned char*)(remote_participant->Session.SessionKey.data()),
-                    initialization_vector.data()))
-            {
-                logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
-                EVP_CIPHER_CTX_free(e_ctx);
-                continue;
-            }
+            logError(SECURITY_CRYPTO, "Unable to encode the payload. EVP_EncryptInit function returns an error");
+            continue;
         }
         if (!EVP_EncryptUpdate(e_ctx, NULL, &actual_size, tag.common_mac.data(), 16))
         {
             logError(SECURITY_CRYPTO,
                     "Unable to create authentication for the datawriter submessage. EVP_EncryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
             continue;
         }
-        if (!EVP_EncryptFinal(e_ctx, NULL, &final_size))
+        if (!EVP_EncryptFinal_ex(e_ctx, NULL, &final_size))
         {
             logError(SECURITY_CRYPTO,
-                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal function returns an error");
-            EVP_CIPHER_CTX_free(e_ctx);
+                    "Unable to create authentication for the datawriter submessage. EVP_EncryptFinal_ex function returns an error");
             continue;
         }
         serializer << remote_participant->Participant2ParticipantKeyMaterial.at(0).receiver_specific_key_id;
         EVP_CIPHER_CTX_ctrl(e_ctx, EVP_CTRL_GCM_GET_TAG, AES_BLOCK_SIZE, serializer.getCurrentPosition());
         serializer.jump(16);
-        EVP_CIPHER_CTX_free(e_ctx);
 
         ++length;
     }
@@ -1957,32 +2040,13 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     bool use_256_bits = (transformation_kind == c_transfrom_kind_aes256_gcm ||
             transformation_kind == c_transfrom_kind_aes256_gmac);
 
-    EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
-    int cipher_block_size = 0, actual_size = 0, final_size = 0;
-
-    if (!use_256_bits)
+    const EVP_CIPHER* d_cipher = use_256_bits ? EVP_aes_256_gcm() : EVP_aes_128_gcm();
+    int cipher_block_size = EVP_CIPHER_block_size(d_cipher), actual_size = 0, final_size = 0;
+    EVP_CIPHER_CTX* d_ctx = cipher_contexts().get(d_cipher, false, session_key.data(), initialization_vector.data());
+    if (d_ctx == nullptr)
     {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_128_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_128_gcm());
-    }
-    else
-    {
-        if (!EVP_DecryptInit(d_ctx, EVP_aes_256_gcm(), (const unsigned char*)session_key.data(),
-                initialization_vector.data()))
-        {
-            logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
-            return false;
-        }
-
-        cipher_block_size = EVP_CIPHER_block_size(EVP_aes_256_gcm());
+        logError(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptInit function returns an error");
+        return false;
     }
 
     uint32_t protected_len = body_length;
@@ -1995,7 +2059,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
         if (plain_buffer_len < (protected_len + cipher_block_size))
         {
             logWarning(SECURITY_CRYPTO, "Not enough memory to decode payload");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
     }
@@ -2005,19 +2068,16 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataBody(
     if (!EVP_DecryptUpdate(d_ctx, output_buffer, &actual_size, input_buffer, protected_len))
     {
         logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptUpdate function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
         return false;
     }
 
     EVP_CIPHER_CTX_ctrl(d_ctx, EVP_CTRL_GCM_SET_TAG, AES_BLOCK_SIZE, tag.common_mac.data());
 
-    if (!EVP_DecryptFinal(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
+    if (!EVP_DecryptFinal_ex(d_ctx, output_buffer ? &output_buffer[actual_size] : NULL, &final_size))
     {
-        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal function returns an error");
-        EVP_CIPHER_CTX_free(d_ctx);
+        logWarning(SECURITY_CRYPTO, "Unable to decode the payload. EVP_DecryptFinal_ex function returns an error");
         return false;
     }
-    EVP_CIPHER_CTX_free(d_ctx);
 
     uint32_t cnt_len = do_encryption ? static_cast<uint32_t>(actual_size + final_size) : body_length;
     if (plain_buffer_len < cnt_len)
@@ -2119,7 +2179,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         }
 
         //Auth message - The point is that we cannot verify the authorship of the message with our receiver_specific_key the message could be crafted
-        EVP_CIPHER_CTX* d_ctx = EVP_CIPHER_CTX_new();
         const EVP_CIPHER* d_cipher = nullptr;
 
         int actual_size = 0, final_size = 0;
@@ -2143,15 +2202,14 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         else
         {
             logError(SECURITY_CRYPTO, "Invalid transformation kind)");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        if (!EVP_DecryptInit(d_ctx, d_cipher, (const unsigned char*)specific_session_key.data(),
-                initialization_vector.data()))
+        EVP_CIPHER_CTX* d_ctx = cipher_contexts().get(d_cipher, false, specific_session_key.data(),
+                        initialization_vector.data());
+        if (d_ctx == nullptr)
         {
             logError(SECURITY_CRYPTO, "Unable to authenticate the message. EVP_DecryptInit function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2159,7 +2217,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptUpdate function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2167,7 +2224,6 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_CIPHER_CTX_ctrl function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
@@ -2175,11 +2231,9 @@ bool AESGCMGMAC_Transform::deserialize_SecureDataTag(
         {
             logError(SECURITY_CRYPTO,
                     "Unable to authenticate the message. EVP_DecryptFinal_ex function returns an error");
-            EVP_CIPHER_CTX_free(d_ctx);
             return false;
         }
 
-        EVP_CIPHER_CTX_free(d_ctx);
     }
 
     return true;
@@ -46,6 +46,10 @@
 #include <net/if_dl.h>
 #include <netinet/in.h>
 #endif // if defined(__APPLE__)
+#if defined(__linux__)
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#endif // if defined(__linux__)
 #endif // if defined(_WIN32)
 
 #if defined(__FreeBSD__)
@@ -55,9 +59,206 @@
 #include <cstddef>
 #include <cstring>
 #include <algorithm>
+#include <chrono>
+#include <mutex>
 
 using namespace eprosima::fastrtps::rtps;
 
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Age after which the cached interfaces are enumerated again when the system cannot notify changes.
+static constexpr std::chrono::seconds interfaces_poll_period(1);
+
+static bool same_ips(
+        const std::vector<IPFinder::info_IP>& a,
+        const std::vector<IPFinder::info_IP>& b)
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+                   [](const IPFinder::info_IP& ip_a, const IPFinder::info_IP& ip_b)
+                   {
+                       return ip_a.type == ip_b.type && ip_a.name == ip_b.name && ip_a.dev == ip_b.dev &&
+                       ip_a.locator == ip_b.locator;
+                   });
+}
+
+/**
+ * Table of the addresses of the network interfaces of the host, shared by the whole process.
+ *
+ * The interfaces are only enumerated again when they may have changed. On Linux, a netlink socket subscribed to
+ * link and address changes is checked without blocking on every query. Elsewhere, or when the socket cannot be
+ * used, the table is enumerated again when it is older than interfaces_poll_period.
+ */
+class InterfacesCache
+{
+public:
+
+    InterfacesCache()
+    {
+#if defined(__linux__)
+        netlink_fd_ = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+        if (-1 != netlink_fd_)
+        {
+            sockaddr_nl address;
+            memset(&address, 0, sizeof(address));
+            address.nl_family = AF_NETLINK;
+            address.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+            if (0 != bind(netlink_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)))
+            {
+                close(netlink_fd_);
+                netlink_fd_ = -1;
+            }
+        }
+#endif // if defined(__linux__)
+    }
+
+    ~InterfacesCache()
+    {
+#if defined(__linux__)
+        if (-1 != netlink_fd_)
+        {
+            close(netlink_fd_);
+        }
+#endif // if defined(__linux__)
+    }
+
+    /**
+     * Get the cached addresses, enumerating them first if they may be outdated.
+     * @param[out] ips Vector where the addresses are appended.
+     * @param return_loopback Whether to include loopback addresses.
+     * @return false when the interfaces could not be enumerated.
+     */
+    bool get(
+            std::vector<IPFinder::info_IP>* ips,
+            bool return_loopback)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (!update())
+        {
+            return false;
+        }
+
+        for (const IPFinder::info_IP& ip : ips_)
+        {
+            if (return_loopback || (ip.type != IPFinder::IP4_LOCAL && ip.type != IPFinder::IP6_LOCAL))
+            {
+                ips->push_back(ip);
+            }
+        }
+        return true;
+    }
+
+    uint32_t version()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        update();
+        return version_;
+    }
+
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        valid_ = false;
+    }
+
+private:
+
+    //! Enumerate the interfaces again if they may have changed. Requires mutex_.
+    bool update()
+    {
+        bool changed = changes_notified();
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (valid_ && !changed &&
+                (notifications_available() || now - enumerated_at_ < interfaces_poll_period))
+        {
+            return true;
+        }
+
+        std::vector<IPFinder::info_IP> ips;
+        if (!IPFinder::enumerateIPs(&ips))
+        {
+            valid_ = false;
+            return false;
+        }
+
+        if (!same_ips(ips, ips_))
+        {
+            ips_.swap(ips);
+            ++version_;
+        }
+        valid_ = true;
+        enumerated_at_ = now;
+        return true;
+    }
+
+    bool notifications_available() const
+    {
+#if defined(__linux__)
+        return -1 != netlink_fd_;
+#else
+        return false;
+#endif // if defined(__linux__)
+    }
+
+    //! Consume the pending change notifications, returning whether there was any. Requires mutex_.
+    bool changes_notified()
+    {
+        bool changed = false;
+#if defined(__linux__)
+        char buffer[4096];
+        while (-1 != netlink_fd_)
+        {
+            ssize_t received = recv(netlink_fd_, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (received > 0)
+            {
+                changed = true;
+            }
+            else if (-1 == received && ENOBUFS == errno)
+            {
+                // Some notifications were lost.
+                changed = true;
+            }
+            else if (-1 == received && EINTR == errno)
+            {
+                continue;
+            }
+            else if (-1 == received && (EAGAIN == errno || EWOULDBLOCK == errno))
+            {
+                break;
+            }
+            else
+            {
+                // Changes cannot be notified anymore, so fall back to polling.
+                close(netlink_fd_);
+                netlink_fd_ = -1;
+                changed = true;
+            }
+        }
+#endif // if defined(__linux__)
+        return changed;
+    }
+
+    std::mutex mutex_;
+    std::vector<IPFinder::info_IP> ips_;
+    bool valid_ = false;
+    uint32_t version_ = 0;
+    std::chrono::steady_clock::time_point enumerated_at_;
+#if defined(__linux__)
+    int netlink_fd_ = -1;
+#endif // if defined(__linux__)
+};
+
+static InterfacesCache& interfaces_cache()
+{
+    static InterfacesCache cache;
+    return cache;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
 IPFinder::IPFinder()
 {
 }
@@ -66,13 +267,29 @@ IPFinder::~IPFinder()
 {
 }
 
+bool IPFinder::getIPs(
+        std::vector<info_IP>* vec_name,
+        bool return_loopback)
+{
+    return interfaces_cache().get(vec_name, return_loopback);
+}
+
+uint32_t IPFinder::getInterfacesVersion()
+{
+    return interfaces_cache().version();
+}
+
+void IPFinder::invalidateIPs()
+{
+    interfaces_cache().invalidate();
+}
+
 #if defined(_WIN32)
 
 #define DEFAULT_ADAPTER_ADDRESSES_SIZE 15360
 
-bool IPFinder::getIPs(
-        std::vector<info_IP>* vec_name,
-        bool return_loopback)
+bool IPFinder::enumerateIPs(
+        std::vector<info_IP>* vec_name)
 {
     DWORD rv, size = DEFAULT_ADAPTER_ADDRESSES_SIZE;
     PIP_ADAPTER_ADDRESSES adapter_addresses, aa;
@@ -132,10 +349,7 @@ bool IPFinder::getIPs(
                         parseIP6(info);
                     }
 
-                    if (return_loopback || (info.type != IP6_LOCAL && info.type != IP4_LOCAL))
-                    {
-                        vec_name->push_back(info);
-                    }
+                    vec_name->push_back(info);
                     //printf("Buffer: %s\n", buf);
                 }
             }
@@ -148,9 +362,8 @@ bool IPFinder::getIPs(
 
 #else
 
-bool IPFinder::getIPs(
-        std::vector<info_IP>* vec_name,
-        bool return_loopback)
+bool IPFinder::enumerateIPs(
+        std::vector<info_IP>* vec_name)
 {
     struct ifaddrs* ifaddr, * ifa;
     int family, s;
@@ -186,11 +399,7 @@ bool IPFinder::getIPs(
             info.name = std::string(host);
             info.dev = std::string(ifa->ifa_name);
             parseIP4(info);
-
-            if (return_loopback || info.type != IP4_LOCAL)
-            {
-                vec_name->push_back(info);
-            }
+            vec_name->push_back(info);
         }
         else if (family == AF_INET6)
         {
@@ -207,10 +416,7 @@ bool IPFinder::getIPs(
             info.dev = std::string(ifa->ifa_name);
             if (parseIP6(info))
             {
-                if (return_loopback || info.type != IP6_LOCAL)
-                {
-                    vec_name->push_back(info);
-                }
+                vec_name->push_back(info);
             }
             //printf("<Interface>: %s \t <Address> %s\n", ifa->ifa_name, host);
         }
@@ -0,0 +1,251 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LockFreeFreeList.hpp
+ *
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_LOCKFREEFREELIST_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_LOCKFREEFREELIST_HPP_
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * A list of free elements of a pool, where elements can be taken and returned concurrently without locks.
+ *
+ * Elements are registered on a slot, whose index never changes while the element is registered. The list is a
+ * stack of slot indexes, and its head keeps a counter of the operations performed to avoid the ABA problem.
+ * Slots are stored on segments of increasing size which are never moved, so a slot can always be read by a
+ * thread that is concurrently taking an element, even while new elements are being registered.
+ *
+ * Methods @c add and @c remove are not thread-safe, and should be protected by the owner of the pool.
+ * Methods @c push, @c pop and @c size can be called concurrently with any other method.
+ *
+ * @tparam _Ty  Element type.
+ */
+template<typename _Ty>
+class LockFreeFreeList
+{
+public:
+
+    using slot_type = uint32_t;
+
+    static constexpr slot_type npos = std::numeric_limits<slot_type>::max();
+
+    LockFreeFreeList()
+        : head_(make_head(npos, 0))
+        , size_(0)
+    {
+        for (std::atomic<Slot*>& segment : segments_)
+        {
+            segment.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~LockFreeFreeList()
+    {
+        for (std::atomic<Slot*>& segment : segments_)
+        {
+            delete[] segment.load(std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeFreeList(
+            const LockFreeFreeList&) = delete;
+    LockFreeFreeList& operator =(
+            const LockFreeFreeList&) = delete;
+
+    /**
+     * Register an element. The element is not added to the list of free elements.
+     * @param item  Element to register.
+     * @return The slot of the element, or npos if there are no more slots.
+     */
+    slot_type add(
+            _Ty* item)
+    {
+        slot_type index = npos;
+        if (!removed_slots_.empty())
+        {
+            index = removed_slots_.back();
+            removed_slots_.pop_back();
+        }
+        else
+        {
+            size_t segment = 0;
+            size_t offset = 0;
+            locate(num_slots_, segment, offset);
+            if (segment >= num_segments)
+            {
+                return npos;
+            }
+
+            if (0 == offset)
+            {
+                segments_[segment].store(new Slot[first_segment_size << segment], std::memory_order_release);
+            }
+            index = num_slots_++;
+        }
+
+        slot(index).item.store(item, std::memory_order_release);
+        return index;
+    }
+
+    /**
+     * Unregister an element.
+     * @param index  Slot of the element, which should not be on the list of free elements.
+     */
+    void remove(
+            slot_type index)
+    {
+        slot(index).item.store(nullptr, std::memory_order_relaxed);
+        removed_slots_.push_back(index);
+    }
+
+    /**
+     * Add an element to the list of free elements.
+     * @param index  Slot of the element.
+     */
+    void push(
+            slot_type index)
+    {
+        // Counted before it can be taken, so the size never goes below zero
+        size_.fetch_add(1, std::memory_order_relaxed);
+
+        Slot& item_slot = slot(index);
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do
+        {
+            item_slot.next.store(head_index(head), std::memory_order_relaxed);
+            new_head = make_head(index, head_tag(head) + 1);
+        } while (!head_.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * Take an element from the list of free elements.
+     * @return The element, or nullptr if the list is empty.
+     */
+    _Ty* pop()
+    {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        while (npos != head_index(head))
+        {
+            Slot& item_slot = slot(head_index(head));
+            uint64_t new_head = make_head(item_slot.next.load(std::memory_order_relaxed), head_tag(head) + 1);
+            if (head_.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return item_slot.item.load(std::memory_order_relaxed);
+            }
+        }
+
+        return nullptr;
+    }
+
+    //! Number of elements on the list of free elements. Only accurate when there are no concurrent operations.
+    size_t size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    bool empty() const
+    {
+        return 0 == size();
+    }
+
+private:
+
+    struct Slot
+    {
+        std::atomic<_Ty*> item{nullptr};
+        std::atomic<slot_type> next{npos};
+    };
+
+    static constexpr size_t first_segment_size = 64;
+    static constexpr size_t num_segments = 26;
+
+    static uint64_t make_head(
+            slot_type index,
+            uint32_t tag)
+    {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    static slot_type head_index(
+            uint64_t head)
+    {
+        return static_cast<slot_type>(head);
+    }
+
+    static uint32_t head_tag(
+            uint64_t head)
+    {
+        return static_cast<uint32_t>(head >> 32);
+    }
+
+    //! Segment k holds first_segment_size << k slots.
+    static void locate(
+            size_t index,
+            size_t& segment,
+            size_t& offset)
+    {
+        uint64_t position = static_cast<uint64_t>(index) + first_segment_size;
+        segment = 0;
+        while (position >= (static_cast<uint64_t>(first_segment_size) << (segment + 1)))
+        {
+            ++segment;
+        }
+        offset = static_cast<size_t>(position - (static_cast<uint64_t>(first_segment_size) << segment));
+    }
+
+    Slot& slot(
+            slot_type index) const
+    {
+        size_t segment = 0;
+        size_t offset = 0;
+        locate(index, segment, offset);
+        Slot* slots = segments_[segment].load(std::memory_order_acquire);
+        assert(nullptr != slots);
+        return slots[offset];
+    }
+
+    std::atomic<uint64_t> head_;
+    std::atomic<size_t> size_;
+    std::atomic<Slot*> segments_[num_segments];
+    slot_type num_slots_ = 0;
+    std::vector<slot_type> removed_slots_;
+};
+
+template<typename _Ty>
+constexpr typename LockFreeFreeList<_Ty>::slot_type LockFreeFreeList<_Ty>::npos;
+
+template<typename _Ty>
+constexpr size_t LockFreeFreeList<_Ty>::first_segment_size;
+
+template<typename _Ty>
+constexpr size_t LockFreeFreeList<_Ty>::num_segments;
+
+}  // namespace fastrtps
+}  // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_LOCKFREEFREELIST_HPP_ */
@@ -0,0 +1,130 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS_THREADING_HPP_
+#define UTILS_THREADING_HPP_
+
+#if defined(_WIN32)
+// Sources including this header are also built outside the library, which defines NOMINMAX for the rest
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif // ifndef NOMINMAX
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif // if defined(_WIN32)
+
+#include <cstring>
+#include <string>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+namespace eprosima {
+
+/**
+ * Give a name to the calling thread, so it can be identified by debuggers and system tools.
+ * Names longer than 15 characters are truncated on Linux. Not supported on Windows.
+ *
+ * @param name Name of the thread.
+ */
+inline void set_thread_name(
+        const std::string& name)
+{
+#if defined(__APPLE__)
+    pthread_setname_np(name.c_str());
+#elif defined(__linux__)
+    char thread_name[16];
+    strncpy(thread_name, name.c_str(), sizeof(thread_name) - 1);
+    thread_name[sizeof(thread_name) - 1] = '\0';
+    pthread_setname_np(pthread_self(), thread_name);
+#else
+    (void)name;
+#endif // platform selection
+}
+
+/**
+ * Apply scheduling and affinity settings to the calling thread.
+ * Settings that cannot be applied are reported with a warning, and the thread keeps running with its previous
+ * values.
+ *
+ * @param settings Settings to apply.
+ */
+inline void apply_thread_settings(
+        const fastdds::rtps::ThreadSettings& settings)
+{
+    const int32_t default_value = fastdds::rtps::ThreadSettings::default_value;
+
+#if defined(_WIN32)
+    if (default_value != settings.priority && 0 == SetThreadPriority(GetCurrentThread(), settings.priority))
+    {
+        logWarning(SYSTEM, "Could not set the priority of the thread: error " << GetLastError());
+    }
+
+    if (0 != settings.affinity &&
+            0 == SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(settings.affinity)))
+    {
+        logWarning(SYSTEM, "Could not set the affinity of the thread: error " << GetLastError());
+    }
+#else
+    if (default_value != settings.scheduling_policy || default_value != settings.priority)
+    {
+        int policy = 0;
+        sched_param param;
+        int result = pthread_getschedparam(pthread_self(), &policy, &param);
+        if (0 == result)
+        {
+            if (default_value != settings.scheduling_policy)
+            {
+                policy = settings.scheduling_policy;
+            }
+            if (default_value != settings.priority)
+            {
+                param.sched_priority = settings.priority;
+            }
+            result = pthread_setschedparam(pthread_self(), policy, &param);
+        }
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Could not set the scheduling parameters of the thread: " << strerror(result));
+        }
+    }
+
+#if defined(__linux__)
+    if (0 != settings.affinity)
+    {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (0 != (settings.affinity & (uint64_t(1) << cpu)))
+            {
+                CPU_SET(cpu, &cpu_set);
+            }
+        }
+
+        int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Could not set the affinity of the thread: " << strerror(result));
+        }
+    }
+#endif // if defined(__linux__)
+#endif // if defined(_WIN32)
+}
+
+} // eprosima
+
+#endif // UTILS_THREADING_HPP_
@@ -1026,6 +1026,13 @@ public:
         return *this;
     }
 
+    PubSubReader& lazy_builtin_endpoints(
+            bool lazy)
+    {
+        participant_qos_.wire_protocol().builtin.lazy_builtin_endpoints = lazy;
+        return *this;
+    }
+
     PubSubReader& load_participant_attr(
             const std::string& /*xml*/)
     {
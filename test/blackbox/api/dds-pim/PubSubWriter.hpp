@@ -890,6 +890,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& adaptive_reliability(
+            bool adaptive)
+    {
+        datawriter_qos_.reliable_writer_qos().times.adaptive_reliability = adaptive;
+        return *this;
+    }
+
     PubSubWriter& unicastLocatorList(
             eprosima::fastrtps::rtps::LocatorList_t unicastLocators)
     {
@@ -1080,6 +1087,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& lazy_builtin_endpoints(
+            bool lazy)
+    {
+        participant_qos_.wire_protocol().builtin.lazy_builtin_endpoints = lazy;
+        return *this;
+    }
+
     PubSubWriter& load_publisher_attr(
             const std::string& /*xml*/)
     {
@@ -892,6 +892,13 @@ public:
         return *this;
     }
 
+    PubSubReader& lazy_builtin_endpoints(
+            bool lazy)
+    {
+        participant_attr_.rtps.builtin.lazy_builtin_endpoints = lazy;
+        return *this;
+    }
+
     PubSubReader& load_participant_attr(
             const std::string& xml)
     {
@@ -782,6 +782,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& adaptive_reliability(
+            bool adaptive)
+    {
+        publisher_attr_.times.adaptive_reliability = adaptive;
+        return *this;
+    }
+
     PubSubWriter& unicastLocatorList(
             eprosima::fastrtps::rtps::LocatorList_t unicastLocators)
     {
@@ -951,6 +958,13 @@ public:
         return *this;
     }
 
+    PubSubWriter& lazy_builtin_endpoints(
+            bool lazy)
+    {
+        participant_attr_.rtps.builtin.lazy_builtin_endpoints = lazy;
+        return *this;
+    }
+
     PubSubWriter& load_publisher_attr(
             const std::string& xml)
     {
@@ -158,3 +158,43 @@ TEST(AcknackQos, NotRecoverAfterLosingCommunicationWithDisablePositiveAck)
     // Block reader until reception finished or timeout.
     ASSERT_EQ(reader.block_for_all(std::chrono::seconds(1)), 0u);
 }
+
+TEST(AcknackQos, RecoverLossesWithAdaptiveReliability)
+{
+    // This test makes the writer lose some of the samples it sends, with a heartbeat period longer than the time the
+    // reader waits for them. The adaptive heartbeat period lets the reader receive all of them in time.
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 20;
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS);
+    writer.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    writer.heartbeat_period_seconds(10);
+    writer.adaptive_reliability(true);
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+    writer.init();
+
+    reader.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS);
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS);
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    std::list<HelloWorld> data = default_helloworld_data_generator(30);
+    reader.startReception(data);
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Losses are recovered long before the heartbeat period.
+    ASSERT_EQ(30u, reader.block_for_all(std::chrono::seconds(5)));
+}
@@ -1891,6 +1891,50 @@ TEST_P(LivelinessQos, AssertLivelinessParticipant)
     EXPECT_EQ(publishers.pub_times_liveliness_lost(), 2u);
 }
 
+//! Tests liveliness between a reader and a writer whose participant creates the liveliness endpoints on demand
+TEST_P(LivelinessQos, ManualByParticipant_LazyBuiltinEndpoints)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    config_pdp(writer, reader);
+
+    // Liveliness lease duration and announcement period, in milliseconds
+    unsigned int lease_duration_ms = 1500;
+    unsigned int announcement_period_ms = 1;
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS)
+            .liveliness_kind(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS)
+            .liveliness_lease_duration(lease_duration_ms * 1e-3)
+            .init();
+    writer.lazy_builtin_endpoints(true)
+            .reliability(RELIABLE_RELIABILITY_QOS)
+            .liveliness_kind(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS)
+            .liveliness_announcement_period(announcement_period_ms * 1e-3)
+            .liveliness_lease_duration(lease_duration_ms * 1e-3)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    unsigned int num_assertions = 2;
+    for (unsigned int count = 1; count <= num_assertions; ++count)
+    {
+        writer.assert_liveliness();
+        reader.wait_liveliness_recovered(count);
+        reader.wait_liveliness_lost(count);
+        writer.wait_liveliness_lost(count);
+    }
+
+    EXPECT_EQ(writer.times_liveliness_lost(), num_assertions);
+    EXPECT_EQ(reader.times_liveliness_lost(), num_assertions);
+    EXPECT_EQ(reader.times_liveliness_recovered(), num_assertions);
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -0,0 +1,156 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the access control checks performed by the builtin Permissions plugin when discovering remote
+ * readers with security enabled. Endpoints are spread over the topics of the permissions document used by
+ * the access control tests, mixing literal and wildcard topic and partition expressions.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+
+#include <security/OpenSSLInit.hpp>
+#include <security/accesscontrol/Permissions.h>
+#include <security/authentication/PKIDH.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::rtps::security;
+using namespace eprosima::fastdds::benchmark;
+
+static const std::string certs_path = CERTS_PATH;
+
+static void fill_participant_attributes(
+        RTPSParticipantAttributes& participant_attr)
+{
+    PropertySeq& properties = participant_attr.properties.properties();
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.identity_ca", "file://" + certs_path + "/maincacert.pem");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.identity_certificate",
+            "file://" + certs_path + "/mainsubcert.pem");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.private_key", "file://" + certs_path + "/mainsubkey.pem");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.password", "testkey");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.permissions_ca",
+            "file://" + certs_path + "/maincacert.pem");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.governance",
+            "file://" + certs_path + "/governance_helloworld_all_enable.smime");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.permissions",
+            "file://" + certs_path + "/permissions_access_control_tests.smime");
+}
+
+static std::vector<ReaderProxyData> create_readers(
+        uint32_t endpoints)
+{
+    std::vector<ReaderProxyData> readers;
+    readers.reserve(endpoints);
+
+    for (uint32_t i = 0; i < endpoints; ++i)
+    {
+        readers.emplace_back(1, 1);
+        ReaderProxyData& reader = readers.back();
+        switch (i % 4)
+        {
+            case 0:
+                reader.topicName(eprosima::fastrtps::string_255("HelloWorldTopic_no_partitions"));
+                break;
+            case 1:
+                reader.topicName(eprosima::fastrtps::string_255(
+                            "HelloWorldTopic_no_partitions_wildcards_" + std::to_string(i % 8)));
+                break;
+            case 2:
+                reader.topicName(eprosima::fastrtps::string_255("HelloWorldTopic_single_partition"));
+                reader.m_qos.m_partition.push_back("Partition");
+                break;
+            default:
+                reader.topicName(eprosima::fastrtps::string_255("HelloWorldTopic_multiple_partition"));
+                reader.m_qos.m_partition.push_back("Partition1");
+                reader.m_qos.m_partition.push_back("Partition2");
+                break;
+        }
+    }
+
+    return readers;
+}
+
+static void run(
+        Permissions& access_plugin,
+        const PermissionsHandle& access_handle,
+        uint32_t endpoints,
+        uint64_t iterations)
+{
+    std::vector<ReaderProxyData> readers = create_readers(endpoints);
+
+    std::string name = "Remote reader checks for " + std::to_string(endpoints) + " endpoints";
+    measure(name, iterations, [&](uint64_t)
+            {
+                for (const ReaderProxyData& reader : readers)
+                {
+                    SecurityException exception;
+                    bool relay_only = false;
+                    if (!access_plugin.check_remote_datareader(access_handle, 0, reader, relay_only, exception))
+                    {
+                        std::cerr << exception.what() << std::endl;
+                        exit(1);
+                    }
+                }
+            });
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    static OpenSSLInit openssl_init;
+
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000);
+
+    RTPSParticipantAttributes participant_attr;
+    fill_participant_attributes(participant_attr);
+
+    PKIDH authentication_plugin;
+    Permissions access_plugin;
+    IdentityHandle* identity_handle = nullptr;
+    SecurityException exception;
+    GUID_t candidate_participant_key;
+    candidate_participant_key.guidPrefix.value[0] = 1;
+    candidate_participant_key.entityId = c_EntityId_RTPSParticipant;
+    GUID_t adjusted_participant_key;
+
+    if (ValidationResult_t::VALIDATION_OK != authentication_plugin.validate_local_identity(&identity_handle,
+            adjusted_participant_key, 0, participant_attr, candidate_participant_key, exception))
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    PermissionsHandle* access_handle = access_plugin.validate_local_permissions(authentication_plugin,
+                    *identity_handle, 0, participant_attr, exception);
+    if (access_handle == nullptr)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    run(access_plugin, *access_handle, 1000, iterations);
+    run(access_plugin, *access_handle, 5000, iterations / 5 + 1);
+
+    access_plugin.return_permissions_handle(access_handle, exception);
+    authentication_plugin.return_identity_handle(identity_handle, exception);
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures a reliable writer processing the acknacks of many matched readers. Every iteration makes all the readers
+ * acknowledge one more change, as they do when they keep up with the writer. Acknacks processed one by one, as
+ * when each one arrives in its own message, are compared with acknacks processed as a batch, as when they arrive
+ * in the same message.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint32_t num_readers = 200;
+
+static void run(
+        RTPSParticipant* participant,
+        bool batched,
+        uint64_t iterations)
+{
+    WriterAttributes writer_attributes;
+    writer_attributes.endpoint.reliabilityKind = RELIABLE;
+    writer_attributes.endpoint.durabilityKind = VOLATILE;
+    HistoryAttributes history_attributes;
+    history_attributes.initialReservedCaches = static_cast<int32_t>(iterations);
+    std::unique_ptr<WriterHistory> history(new WriterHistory(history_attributes));
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant, writer_attributes, history.get());
+    if (nullptr == writer)
+    {
+        std::cerr << "Error creating writer" << std::endl;
+        std::exit(1);
+    }
+
+    // All the readers share a locator nobody listens on, so data is sent once per change
+    Locator_t locator;
+    IPLocator::setIPv4(locator, 127, 0, 0, 1);
+    locator.port = 7399;
+
+    std::vector<GUID_t> readers;
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        ReaderProxyData reader_data(4u, 1u);
+        reader_data.add_unicast_locator(locator);
+        reader_data.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+        reader_data.guid().guidPrefix.value[0] = 1;
+        reader_data.guid().guidPrefix.value[1] = static_cast<octet>(i >> 8);
+        reader_data.guid().guidPrefix.value[2] = static_cast<octet>(i);
+        reader_data.guid().entityId = EntityId_t(0x00000104);
+        writer->matched_reader_add(reader_data);
+        readers.push_back(reader_data.guid());
+    }
+
+    // Every iteration acknowledges one of these changes
+    for (uint64_t n = 0; n < iterations; ++n)
+    {
+        CacheChange_t* change = writer->new_change(ALIVE);
+        change->serializedPayload.length = 16;
+        history->add_change(change);
+    }
+
+    std::string name = std::string(batched ? "Batched" : "Individual") + " acknacks of " +
+            std::to_string(num_readers) + " readers";
+    measure(name, iterations, [&](uint64_t n)
+            {
+                SequenceNumberSet_t sn_set(SequenceNumber_t(0, static_cast<uint32_t>(n + 2)));
+                uint32_t ack_count = static_cast<uint32_t>(n + 1);
+                bool result = false;
+
+                if (batched)
+                {
+                    writer->begin_acknack_batch();
+                }
+                for (const GUID_t& reader : readers)
+                {
+                    writer->process_acknack(writer->getGuid(), reader, ack_count, sn_set, true, result);
+                }
+                if (batched)
+                {
+                    writer->end_acknack_batch();
+                }
+            });
+
+    RTPSDomain::removeRTPSWriter(writer);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000);
+
+    RTPSParticipantAttributes attributes;
+    attributes.builtin.discovery_config.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol::NONE;
+    attributes.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, attributes);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    run(participant, false, iterations);
+    run(participant, true, iterations);
+
+    RTPSDomain::removeRTPSParticipant(participant);
+    return 0;
+}
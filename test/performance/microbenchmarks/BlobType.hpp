@@ -0,0 +1,121 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BlobType.hpp
+ */
+
+#ifndef _TEST_PERFORMANCE_MICROBENCHMARKS_BLOBTYPE_HPP_
+#define _TEST_PERFORMANCE_MICROBENCHMARKS_BLOBTYPE_HPP_
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace benchmark {
+
+// Below the size of a datagram, so synchronous writers do not need to fragment
+static constexpr uint32_t max_sample_size = 60000;
+
+struct BlobSample
+{
+    std::vector<uint8_t> data;
+};
+
+//! Type of BlobSample. It is not plain, so readers deserialize the samples they loan.
+class BlobType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    BlobType()
+    {
+        setName("BlobSample");
+        m_typeSize = max_sample_size + 4u + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        BlobSample* sample = static_cast<BlobSample*>(data);
+        eprosima::fastcdr::FastBuffer buffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        eprosima::fastcdr::Cdr ser(buffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.serialize_encapsulation();
+        ser << sample->data;
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override
+    {
+        BlobSample* sample = static_cast<BlobSample*>(data);
+        eprosima::fastcdr::FastBuffer buffer(reinterpret_cast<char*>(payload->data), payload->length);
+        eprosima::fastcdr::Cdr deser(buffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+                eprosima::fastcdr::Cdr::DDS_CDR);
+        deser.read_encapsulation();
+        payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        deser >> sample->data;
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(static_cast<BlobSample*>(data)->data.size()) + 4u + 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new BlobSample();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<BlobSample*>(data);
+    }
+
+    bool getKey(
+            void*,
+            eprosima::fastrtps::rtps::InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+} // namespace benchmark
+} // namespace fastdds
+} // namespace eprosima
+
+FASTDDS_SEQUENCE(BlobSampleSeq, eprosima::fastdds::benchmark::BlobSample);
+
+#endif // _TEST_PERFORMANCE_MICROBENCHMARKS_BLOBTYPE_HPP_
@@ -0,0 +1,155 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the latency of small writes on a DataWriter while another thread writes large samples on it. The type
+ * serializes the large samples several times, as a complex type would take to serialize them. Small writes on an
+ * idle writer are compared with small writes competing with the large ones, which only share the writer while the
+ * changes are added to the history. The worst latency of the small writes is also shown.
+ */
+
+#include "BlobType.hpp"
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::benchmark;
+
+using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+
+static constexpr uint32_t small_sample_size = 16;
+static constexpr uint32_t serialization_passes = 20;
+
+//! BlobType serializing each sample several times.
+class CostlyBlobType : public BlobType
+{
+public:
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        bool ret = true;
+        for (uint32_t i = 0; ret && i < serialization_passes; ++i)
+        {
+            ret = BlobType::serialize(data, payload);
+        }
+        return ret;
+    }
+
+};
+
+static void write(
+        DataWriter* writer,
+        BlobSample& sample)
+{
+    if (ReturnCode_t::RETCODE_OK != writer->write(&sample))
+    {
+        std::cerr << "Error writing sample" << std::endl;
+        std::exit(1);
+    }
+}
+
+static void run(
+        DataWriter* writer,
+        bool with_large_writes,
+        uint64_t iterations)
+{
+    std::atomic<bool> stop{false};
+    std::thread large_writer;
+    if (with_large_writes)
+    {
+        large_writer = std::thread([writer, &stop]()
+                        {
+                            BlobSample large_sample;
+                            large_sample.data.resize(max_sample_size);
+                            while (!stop)
+                            {
+                                write(writer, large_sample);
+                            }
+                        });
+    }
+
+    BlobSample small_sample;
+    small_sample.data.resize(small_sample_size);
+    std::chrono::steady_clock::duration worst{0};
+
+    std::string name = std::string("Small writes ") + (with_large_writes ? "with" : "without") + " large writes";
+    measure(name, iterations, [&](uint64_t)
+            {
+                auto start = std::chrono::steady_clock::now();
+                write(writer, small_sample);
+                worst = (std::max)(worst, std::chrono::steady_clock::now() - start);
+            });
+    std::cout << "    worst write " <<
+        std::chrono::duration_cast<std::chrono::microseconds>(worst).count() << " us" << std::endl;
+
+    stop = true;
+    if (large_writer.joinable())
+    {
+        large_writer.join();
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 2000);
+
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new CostlyBlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("ConcurrentWriteTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 1;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+
+    run(writer, false, iterations);
+    run(writer, true, iterations);
+
+    publisher->delete_datawriter(writer);
+    participant->delete_publisher(publisher);
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the cost of the discovery server routine on the DiscoveryDataBase, driven by synthetic clients.
+ * Each client announces its DATA(p), one writer and one reader. No acknowledgement is ever received, so
+ * every topic stays dirty and every cycle processes the whole database, which is the worst case of a
+ * server starting with many clients.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps::ddb;
+using namespace eprosima::fastdds::benchmark;
+
+static const uint32_t endpoints_per_topic = 10;
+
+static GuidPrefix_t client_prefix(
+        uint32_t client)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[8] = static_cast<octet>(client >> 24);
+    prefix.value[9] = static_cast<octet>(client >> 16);
+    prefix.value[10] = static_cast<octet>(client >> 8);
+    prefix.value[11] = static_cast<octet>(client);
+    return prefix;
+}
+
+static CacheChange_t* create_change(
+        const GUID_t& entity)
+{
+    CacheChange_t* change = new CacheChange_t();
+    change->kind = ALIVE;
+    change->writerGUID = entity;
+    change->instanceHandle = InstanceHandle_t(entity);
+
+    SampleIdentity sample_id;
+    sample_id.writer_guid(entity);
+    sample_id.sequence_number(SequenceNumber_t(0, 1));
+    WriteParams params;
+    params.sample_identity(sample_id);
+    params.related_sample_identity(sample_id);
+    change->write_params = std::move(params);
+    return change;
+}
+
+static void release_changes(
+        const std::vector<CacheChange_t*>& changes)
+{
+    for (CacheChange_t* change : changes)
+    {
+        delete change;
+    }
+}
+
+static void run(
+        uint32_t clients,
+        uint64_t iterations)
+{
+    GuidPrefix_t server_prefix;
+    server_prefix.value[0] = 0x02;
+    DiscoveryDataBase db(server_prefix, {});
+
+    uint32_t topics = (clients + endpoints_per_topic - 1) / endpoints_per_topic;
+    for (uint32_t client = 0; client < clients; ++client)
+    {
+        GuidPrefix_t prefix = client_prefix(client);
+        std::string topic_name = "topic_" + std::to_string(client % topics);
+
+        db.update(create_change(GUID_t(prefix, c_EntityId_RTPSParticipant)),
+                DiscoveryParticipantChangeData(RemoteLocatorList(1, 1), true, true));
+        db.update(create_change(GUID_t(prefix, EntityId_t(0x00000103))), topic_name);
+        db.update(create_change(GUID_t(prefix, EntityId_t(0x00000104))), topic_name);
+    }
+
+    std::string name = "Routine cycle with " + std::to_string(clients) + " clients";
+    std::vector<CacheChange_t*> send_list;
+    measure(name, iterations, [&](uint64_t)
+            {
+                db.process_pdp_data_queue();
+                db.process_edp_data_queue();
+                db.process_dirty_topics();
+
+                // The server would send these on its builtin writers
+                db.take_pdp_to_send(send_list);
+                db.take_edp_publications_to_send(send_list);
+                db.take_edp_subscriptions_to_send(send_list);
+
+                release_changes(db.changes_to_release());
+                db.clear_changes_to_release();
+            });
+
+    db.disable();
+    release_changes(db.clear());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000);
+
+    run(100, iterations);
+    run(500, iterations);
+    run(2000, iterations);
+
+    return 0;
+}
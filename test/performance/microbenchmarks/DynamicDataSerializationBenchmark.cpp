@@ -0,0 +1,121 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Compares serialization of a fixed-size dynamic type through DynamicPubSubType (map based DynamicData)
+ * and through FlatDynamicPubSubType (compiled layout).
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicDataPtr.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/FlatDynamicData.h>
+#include <fastrtps/types/FlatDynamicPubSubType.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::types;
+using namespace eprosima::fastdds::benchmark;
+
+static DynamicType_ptr build_type()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder_ptr point_builder = factory->create_struct_builder();
+    point_builder->add_member(0, "x", factory->create_float64_type());
+    point_builder->add_member(1, "y", factory->create_float64_type());
+    point_builder->add_member(2, "z", factory->create_float64_type());
+    point_builder->set_name("BenchmarkPoint");
+
+    DynamicTypeBuilder_ptr float32_builder = factory->create_float32_builder();
+    DynamicTypeBuilder_ptr covariance_builder = factory->create_array_builder(float32_builder.get(), { 36 });
+
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    MemberId id = 0;
+    struct_builder->add_member(id++, "sensor_id", factory->create_uint32_type());
+    struct_builder->add_member(id++, "sequence", factory->create_uint64_type());
+    struct_builder->add_member(id++, "valid", factory->create_bool_type());
+    struct_builder->add_member(id++, "status", factory->create_int16_type());
+    struct_builder->add_member(id++, "position", point_builder.get());
+    struct_builder->add_member(id++, "velocity", point_builder.get());
+    struct_builder->add_member(id++, "covariance", covariance_builder.get());
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        struct_builder->add_member(id++, "reading_" + std::to_string(i), factory->create_int32_type());
+    }
+    struct_builder->set_name("BenchmarkSample");
+
+    return struct_builder->build();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000000);
+
+    DynamicType_ptr type = build_type();
+    DynamicPubSubType dynamic_pst(type);
+    FlatDynamicPubSubType flat_pst(type);
+    if (!flat_pst.get_layout())
+    {
+        std::cerr << "Benchmark type could not be compiled" << std::endl;
+        return 1;
+    }
+
+    DynamicData_ptr dynamic_data(DynamicDataFactory::get_instance()->create_data(type));
+    dynamic_data->set_uint32_value(17, 0);
+    dynamic_data->set_uint64_value(123456789, 1);
+    dynamic_data->set_bool_value(true, 2);
+    for (MemberId id = 7; id < 15; ++id)
+    {
+        dynamic_data->set_int32_value(static_cast<int32_t>(id * 1000), id);
+    }
+
+    FlatDynamicData* flat_data = static_cast<FlatDynamicData*>(flat_pst.createData());
+    flat_data->load_from(dynamic_data.get());
+
+    SerializedPayload_t payload(dynamic_pst.m_typeSize);
+    std::cout << "Serialized size: " << flat_pst.m_typeSize << " bytes" << std::endl;
+
+    double dynamic_ser = measure("DynamicPubSubType size+serialize", iterations, [&](uint64_t)
+                    {
+                        dynamic_pst.getSerializedSizeProvider(dynamic_data.get())();
+                        dynamic_pst.serialize(dynamic_data.get(), &payload);
+                    });
+    double flat_ser = measure("FlatDynamicPubSubType size+serialize", iterations, [&](uint64_t)
+                    {
+                        flat_pst.getSerializedSizeProvider(flat_data)();
+                        flat_pst.serialize(flat_data, &payload);
+                    });
+    double dynamic_deser = measure("DynamicPubSubType deserialize", iterations, [&](uint64_t)
+                    {
+                        dynamic_pst.deserialize(&payload, dynamic_data.get());
+                    });
+    double flat_deser = measure("FlatDynamicPubSubType deserialize", iterations, [&](uint64_t)
+                    {
+                        flat_pst.deserialize(&payload, flat_data);
+                    });
+
+    std::cout << "Serialize speedup: " << dynamic_ser / flat_ser << "x" << std::endl;
+    std::cout << "Deserialize speedup: " << dynamic_deser / flat_deser << "x" << std::endl;
+
+    flat_pst.deleteData(flat_data);
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the queries of the local addresses done while creating transports and computing locators. Every
+ * iteration gets the addresses of the host and its IPv4 locators. Queries served from the cached interfaces are
+ * compared with queries enumerating the interfaces every time, which was the previous behavior.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastrtps/utils/IPFinder.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static void query()
+{
+    std::vector<IPFinder::info_IP> ips;
+    IPFinder::getIPs(&ips, true);
+
+    LocatorList_t locators;
+    IPFinder::getIP4Address(&locators);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 10000);
+
+    std::vector<IPFinder::info_IP> ips;
+    IPFinder::getIPs(&ips, true);
+    std::cout << "Host with " << ips.size() << " addresses" << std::endl;
+
+    measure("Enumerated interfaces", iterations, [](uint64_t)
+            {
+                IPFinder::invalidateIPs();
+                query();
+            });
+
+    measure("Cached interfaces", iterations, [](uint64_t)
+            {
+                query();
+            });
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the delivery of a sample from a DataWriter to a DataReader on the same participant. Every iteration
+ * writes a sample and takes it with a loan. Samples written with write() are deserialized by the reader, while
+ * samples written with write_shared() are loaned as they are to a reader configured to share them.
+ */
+
+#include "BlobType.hpp"
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+
+static void wait_matched(
+        DataWriter* writer)
+{
+    PublicationMatchedStatus status;
+    for (int i = 0; i < 500; ++i)
+    {
+        writer->get_publication_matched_status(status);
+        if (status.current_count == 1)
+        {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::cerr << "Timeout waiting for the reader to match" << std::endl;
+    std::exit(1);
+}
+
+static void take_one(
+        DataReader* reader,
+        const BlobSample* expected)
+{
+    BlobSampleSeq values;
+    SampleInfoSeq infos;
+    if (ReturnCode_t::RETCODE_OK != reader->take(values, infos, 1) || values.length() != 1 ||
+            values[0].data.size() != expected->data.size())
+    {
+        std::cerr << "Sample not received" << std::endl;
+        std::exit(1);
+    }
+    reader->return_loan(values, infos);
+}
+
+static void run(
+        DomainParticipant* participant,
+        Topic* topic,
+        uint32_t sample_size,
+        uint64_t iterations)
+{
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 1;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    reader_qos.history().depth = 1;
+    DataReader* copy_reader = subscriber->create_datareader(topic, reader_qos);
+    wait_matched(writer);
+
+    measure("Deserialized delivery of " + std::to_string(sample_size) + " bytes", iterations, [&](uint64_t)
+            {
+                BlobSample sample;
+                sample.data.resize(sample_size);
+                writer->write(&sample);
+                take_one(copy_reader, &sample);
+            });
+
+    subscriber->delete_datareader(copy_reader);
+
+    reader_qos.properties().properties().emplace_back("fastdds.intraprocess_shared_samples", "true");
+    DataReader* sharing_reader = subscriber->create_datareader(topic, reader_qos);
+    wait_matched(writer);
+
+    measure("Shared delivery of " + std::to_string(sample_size) + " bytes", iterations, [&](uint64_t)
+            {
+                std::shared_ptr<BlobSample> sample = std::make_shared<BlobSample>();
+                sample->data.resize(sample_size);
+                writer->write_shared(sample);
+                take_one(sharing_reader, sample.get());
+            });
+
+    subscriber->delete_datareader(sharing_reader);
+    publisher->delete_datawriter(writer);
+    participant->delete_subscriber(subscriber);
+    participant->delete_publisher(publisher);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 10000);
+
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new BlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("IntraprocessSharedSampleTopic", type.get_type_name(),
+                    TOPIC_QOS_DEFAULT);
+
+    run(participant, topic, 1024, iterations);
+    run(participant, topic, max_sample_size, iterations / 10 + 1);
+
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    return 0;
+}
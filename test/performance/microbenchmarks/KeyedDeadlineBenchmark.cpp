@@ -0,0 +1,126 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the cost of the deadline timer of a keyed history. Every iteration mimics a deadline being missed:
+ * the instance with the earliest deadline is looked up, its deadline is renewed one period later, and the
+ * next instance to expire is looked up again to reschedule the timer. The deadline heap used by the histories
+ * is compared with a linear scan of the instances, which was the previous implementation.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastrtps_deprecated/common/InstanceDeadlineHeap.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+using Instances = std::map<InstanceHandle_t, KeyedChanges>;
+
+static const std::chrono::milliseconds deadline_period(100);
+
+static InstanceHandle_t instance_handle(
+        uint32_t instance)
+{
+    InstanceHandle_t handle;
+    handle.value[12] = static_cast<octet>(instance >> 24);
+    handle.value[13] = static_cast<octet>(instance >> 16);
+    handle.value[14] = static_cast<octet>(instance >> 8);
+    handle.value[15] = static_cast<octet>(instance);
+    return handle;
+}
+
+static void fill(
+        Instances& instances,
+        InstanceDeadlineHeap* heap,
+        uint32_t count)
+{
+    // Deadlines spread along one period, as if the instances had been written at different times
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto it = instances.insert(std::make_pair(instance_handle(i), KeyedChanges())).first;
+        it->second.next_deadline_us = start + (deadline_period * i) / count;
+        if (heap != nullptr)
+        {
+            heap->push(&*it);
+        }
+    }
+}
+
+static Instances::value_type* linear_min(
+        Instances& instances)
+{
+    return &*std::min_element(instances.begin(), instances.end(),
+                   [](const Instances::value_type& lhs, const Instances::value_type& rhs)
+                   {
+                       return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
+                   });
+}
+
+static void run(
+        uint32_t count,
+        uint64_t iterations)
+{
+    Instances heap_instances;
+    InstanceDeadlineHeap heap;
+    fill(heap_instances, &heap, count);
+
+    measure("Deadline heap with " + std::to_string(count) + " instances", iterations, [&](uint64_t)
+            {
+                InstanceDeadlineHeap::Entry* missed = heap.top();
+                missed->second.next_deadline_us += deadline_period;
+                heap.update(missed);
+                heap.top();
+            });
+
+    Instances scan_instances;
+    fill(scan_instances, nullptr, count);
+
+    // The linear scan is orders of magnitude slower, so fewer iterations are enough
+    uint64_t scan_iterations = std::max<uint64_t>(1, iterations / 100);
+    measure("Linear scan with " + std::to_string(count) + " instances", scan_iterations, [&](uint64_t)
+            {
+                Instances::value_type* missed = linear_min(scan_instances);
+                missed->second.next_deadline_us += deadline_period;
+                linear_min(scan_instances);
+            });
+
+    // The heap must still point to the earliest deadline after all the updates
+    if (linear_min(heap_instances)->second.next_deadline_us != heap.top()->second.next_deadline_us)
+    {
+        std::cerr << "Deadline heap does not return the earliest deadline" << std::endl;
+        std::exit(1);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000000);
+
+    run(1000, iterations);
+    run(10000, iterations);
+    run(100000, iterations);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the liveliness assertions of a LivelinessManager holding many manual by topic writers, as done by a
+ * participant whose writers assert their liveliness on every sample. Every iteration asserts all the writers
+ * once, in the same order, so each assertion moves the timer owner to the back.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/writer/LivelinessManager.h>
+
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static void run(
+        ResourceEvent& service,
+        uint32_t writers,
+        uint64_t iterations)
+{
+    LivelinessManager manager(nullptr, service);
+    Duration_t lease_duration(10);
+
+    std::vector<GUID_t> guids;
+    GuidPrefix_t prefix;
+    prefix.value[0] = 1;
+    for (uint32_t i = 0; i < writers; ++i)
+    {
+        guids.emplace_back(prefix, i + 1);
+        manager.add_writer(guids.back(), MANUAL_BY_TOPIC_LIVELINESS_QOS, lease_duration);
+    }
+
+    std::string name = "Assert " + std::to_string(writers) + " manual by topic writers";
+    measure(name, iterations, [&](uint64_t)
+            {
+                for (const GUID_t& guid : guids)
+                {
+                    manager.assert_liveliness(guid, MANUAL_BY_TOPIC_LIVELINESS_QOS, lease_duration);
+                }
+            });
+
+    for (const GUID_t& guid : guids)
+    {
+        manager.remove_writer(guid, MANUAL_BY_TOPIC_LIVELINESS_QOS, lease_duration);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 1000);
+
+    ResourceEvent service;
+    service.init_thread();
+
+    run(service, 200, iterations);
+    run(service, 2000, iterations / 10 + 1);
+
+    return 0;
+}
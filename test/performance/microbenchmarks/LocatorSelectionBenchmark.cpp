@@ -0,0 +1,101 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the selection of locators done by a writer with many matched readers, which alternates between sending
+ * data to all of them and sending a heartbeat or a repair to one of them. The selections restored from the cache of
+ * the selector are compared with running the selection of the transports every time, which was the previous
+ * behavior.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/common/LocatorSelector.hpp>
+#include <fastdds/rtps/network/NetworkFactory.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint32_t num_readers = 32;
+
+static void select(
+        const NetworkFactory& network,
+        LocatorSelector& selector,
+        const std::vector<LocatorSelectorEntry>& entries,
+        uint64_t n)
+{
+    selector.reset(true);
+    network.select_locators(selector);
+
+    selector.reset(false);
+    selector.enable(entries[n % entries.size()].remote_guid);
+    network.select_locators(selector);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 100000);
+
+    NetworkFactory network;
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor udpv4;
+    network.RegisterTransport(&udpv4);
+
+    Locator_t multicast;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.0.1", 7401, multicast);
+
+    std::vector<LocatorSelectorEntry> entries;
+    entries.reserve(num_readers);
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        entries.emplace_back(4u, 1u);
+        LocatorSelectorEntry& entry = entries.back();
+        entry.remote_guid.guidPrefix.value[0] = static_cast<octet>(i + 1);
+        entry.remote_guid.entityId = c_EntityId_Unknown;
+
+        Locator_t unicast;
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "192.168.1.1", 7411, unicast);
+        IPLocator::setIPv4(unicast, 192, 168, 1, static_cast<octet>(i + 2));
+        entry.unicast.push_back(unicast);
+        entry.multicast.push_back(multicast);
+    }
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(num_readers));
+    for (LocatorSelectorEntry& entry : entries)
+    {
+        selector.add_entry(&entry);
+    }
+
+    std::cout << num_readers << " readers" << std::endl;
+
+    measure("Transport selection", iterations, [&](uint64_t n)
+            {
+                selector.clear_selection_cache();
+                select(network, selector, entries, n);
+            });
+
+    measure("Cached selection", iterations, [&](uint64_t n)
+            {
+                select(network, selector, entries, n);
+            });
+
+    return 0;
+}
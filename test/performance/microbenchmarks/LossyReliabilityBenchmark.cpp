@@ -0,0 +1,176 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures a reliable writer recovering from losses. The writer participant uses the test UDP transport, which drops
+ * a percentage of the data messages it sends. Every iteration writes a burst of samples and waits until the reader,
+ * on another participant, has acknowledged all of them. Writers with the configured heartbeat and NACK response
+ * times are compared with writers using adaptive reliability, and the heartbeats sent by each writer are counted.
+ */
+
+#include "BlobType.hpp"
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.h>
+#include <fastrtps/xmlparser/XMLProfileManager.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::benchmark;
+using eprosima::fastdds::rtps::test_UDPv4TransportDescriptor;
+
+static const char* topic_name = "LossyReliabilityTopic";
+static constexpr uint32_t burst_size = 50;
+static constexpr uint8_t drop_percentage = 10;
+
+static std::atomic<uint32_t> user_heartbeats{0};
+
+static void wait_matched(
+        DataWriter* writer)
+{
+    PublicationMatchedStatus status;
+    for (int i = 0; i < 10000; ++i)
+    {
+        writer->get_publication_matched_status(status);
+        if (status.current_count > 0)
+        {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::cerr << "Timeout waiting for the reader to match" << std::endl;
+    std::exit(1);
+}
+
+static void run(
+        DomainId_t domain_id,
+        bool adaptive,
+        uint64_t iterations)
+{
+    auto transport = std::make_shared<test_UDPv4TransportDescriptor>();
+    transport->dropDataMessagesPercentage = drop_percentage;
+    transport->drop_heartbeat_messages_filter_ = [](eprosima::fastrtps::rtps::CDRMessage_t& msg)
+            {
+                // The last octet of the writer id is its kind. Builtin writers have the two upper bits set.
+                if (0 == (msg.buffer[msg.pos + 7] & 0xC0))
+                {
+                    ++user_heartbeats;
+                }
+                return false;
+            };
+
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    participant_qos.transport().use_builtin_transports = false;
+    participant_qos.transport().user_transports.push_back(transport);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, participant_qos);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        std::exit(1);
+    }
+
+    TypeSupport type(new BlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = burst_size;
+    writer_qos.data_sharing().off();
+    writer_qos.reliable_writer_qos().times.adaptive_reliability = adaptive;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+
+    wait_matched(writer);
+
+    BlobSample sample;
+    sample.data.resize(1000);
+    user_heartbeats = 0;
+
+    measure(std::string("Burst of ") + std::to_string(burst_size) + " samples (" +
+            (adaptive ? "adaptive" : "fixed") + " reliability)", iterations, [&](uint64_t)
+            {
+                for (uint32_t i = 0; i < burst_size; ++i)
+                {
+                    writer->write(&sample);
+                }
+                writer->wait_for_acknowledgments({10, 0});
+            });
+    std::cout << "    " << user_heartbeats.load() << " heartbeats sent" << std::endl;
+
+    publisher->delete_datawriter(writer);
+    participant->delete_publisher(publisher);
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 100);
+
+    // Samples must go through the transport to be lost
+    eprosima::fastrtps::LibrarySettingsAttributes library_settings;
+    library_settings.intraprocess_delivery = eprosima::fastrtps::INTRAPROCESS_OFF;
+    eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings(library_settings);
+
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new BlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().depth = burst_size;
+    reader_qos.data_sharing().off();
+    DataReader* reader = subscriber->create_datareader(topic, reader_qos);
+
+    run(domain_id, false, iterations);
+    run(domain_id, true, iterations);
+
+    subscriber->delete_datareader(reader);
+    participant->delete_subscriber(subscriber);
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Microbenchmark.hpp
+ */
+
+#ifndef _TEST_PERFORMANCE_MICROBENCHMARKS_MICROBENCHMARK_HPP_
+#define _TEST_PERFORMANCE_MICROBENCHMARKS_MICROBENCHMARK_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace eprosima {
+namespace fastdds {
+namespace benchmark {
+
+/**
+ * Number of iterations for a benchmark run.
+ * Passing --smoke reduces the iterations so the benchmark can run as part of the test suite,
+ * and passing a number overrides the default.
+ */
+inline uint64_t iterations(
+        int argc,
+        char** argv,
+        uint64_t default_iterations)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strcmp(argv[i], "--smoke"))
+        {
+            return default_iterations / 1000 + 1;
+        }
+        uint64_t value = std::strtoull(argv[i], nullptr, 10);
+        if (value > 0)
+        {
+            return value;
+        }
+    }
+    return default_iterations;
+}
+
+/**
+ * Runs a function a number of times and prints the average time per iteration.
+ * @return Average nanoseconds per iteration.
+ */
+template<typename Function>
+double measure(
+        const std::string& name,
+        uint64_t iterations,
+        Function&& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        function(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double total_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double ns_per_iteration = total_ns / static_cast<double>(iterations);
+    std::cout << std::left << std::setw(48) << name << std::right << std::setw(14) << std::fixed <<
+        std::setprecision(1) << ns_per_iteration << " ns/op  (" << iterations << " iterations)" << std::endl;
+    return ns_per_iteration;
+}
+
+} // namespace benchmark
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _TEST_PERFORMANCE_MICROBENCHMARKS_MICROBENCHMARK_HPP_
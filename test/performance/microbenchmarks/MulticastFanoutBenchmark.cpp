@@ -0,0 +1,103 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Simulates a writer with 100 readers on loopback, all of them listening on the same multicast locator, sending
+ * messages to a growing number of them, as repairs requested by several readers are. For each number of interested
+ * readers it measures the selection of locators and prints the datagrams sent and the datagrams received by the
+ * readers, including those received by readers not interested in the message.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/common/LocatorSelector.hpp>
+#include <fastdds/rtps/network/NetworkFactory.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint32_t num_readers = 100;
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 10000);
+
+    NetworkFactory network;
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor udpv4;
+    network.RegisterTransport(&udpv4);
+
+    Locator_t multicast;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.0.1", 7401, multicast);
+
+    std::vector<LocatorSelectorEntry> entries;
+    entries.reserve(num_readers);
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        entries.emplace_back(1u, 1u);
+        LocatorSelectorEntry& entry = entries.back();
+        entry.remote_guid.guidPrefix.value[0] = static_cast<octet>(i + 1);
+        entry.remote_guid.entityId = c_EntityId_Unknown;
+
+        Locator_t unicast;
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", 7411 + 2 * i, unicast);
+        entry.unicast.push_back(unicast);
+        entry.multicast.push_back(multicast);
+    }
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(num_readers));
+    for (LocatorSelectorEntry& entry : entries)
+    {
+        selector.add_entry(&entry);
+    }
+
+    for (uint32_t interested : {1u, 2u, 10u, 25u, 50u, 100u})
+    {
+        auto select = [&]()
+                {
+                    selector.clear_selection_cache();
+                    selector.reset(false);
+                    for (uint32_t i = 0; i < interested; ++i)
+                    {
+                        selector.enable(entries[(i * num_readers) / interested].remote_guid);
+                    }
+                    network.select_locators(selector);
+                };
+
+        measure("Selection for " + std::to_string(interested) + " interested readers", iterations, [&](uint64_t)
+                {
+                    select();
+                });
+
+        select();
+        size_t datagrams = 0;
+        size_t received = 0;
+        selector.for_each([&](const Locator_t& locator)
+                {
+                    ++datagrams;
+                    received += IPLocator::isMulticast(locator) ? num_readers : 1;
+                });
+        std::cout << "    " << datagrams << " datagrams sent, " << received << " datagrams received" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures several threads getting and releasing payloads from the same topic payload pool, as the writers of a
+ * topic on different threads do. The lock-free list of free payloads used by the pool is also compared with a
+ * vector protected by a mutex, which was the previous implementation. Each iteration performs a fixed number of
+ * operations on every thread.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <rtps/history/TopicPayloadPool.hpp>
+#include <utils/collections/LockFreeFreeList.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint32_t operations_per_thread = 10000;
+static constexpr uint32_t payloads_per_thread = 4;
+static constexpr uint32_t payload_size = 256;
+
+class MutexFreeList
+{
+public:
+
+    void push(
+            int* item)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(item);
+    }
+
+    int* pop()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.empty())
+        {
+            return nullptr;
+        }
+        int* item = free_.back();
+        free_.pop_back();
+        return item;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::vector<int*> free_;
+};
+
+//! Runs a function on a number of threads, operations_per_thread times on each thread.
+template<typename Function>
+static void run_threads(
+        uint32_t num_threads,
+        Function&& function)
+{
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&function]()
+                {
+                    for (uint32_t n = 0; n < operations_per_thread; ++n)
+                    {
+                        function();
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+static void run_free_lists(
+        uint32_t num_threads,
+        uint64_t iterations)
+{
+    std::vector<int> values(num_threads * payloads_per_thread);
+    std::string suffix = " (" + std::to_string(num_threads) + " threads)";
+
+    MutexFreeList mutex_list;
+    for (int& value : values)
+    {
+        mutex_list.push(&value);
+    }
+    measure("Mutex free list" + suffix, iterations, [&](uint64_t)
+            {
+                run_threads(num_threads, [&]()
+                {
+                    int* item = mutex_list.pop();
+                    if (nullptr != item)
+                    {
+                        mutex_list.push(item);
+                    }
+                });
+            });
+
+    LockFreeFreeList<int> lock_free_list;
+    std::vector<LockFreeFreeList<int>::slot_type> slots;
+    for (int& value : values)
+    {
+        slots.push_back(lock_free_list.add(&value));
+        lock_free_list.push(slots.back());
+    }
+    measure("Lock-free free list" + suffix, iterations, [&](uint64_t)
+            {
+                run_threads(num_threads, [&]()
+                {
+                    int* item = lock_free_list.pop();
+                    if (nullptr != item)
+                    {
+                        lock_free_list.push(slots[item - values.data()]);
+                    }
+                });
+            });
+}
+
+static void run_pool(
+        MemoryManagementPolicy_t policy,
+        const std::string& policy_name,
+        uint32_t num_threads,
+        uint64_t iterations)
+{
+    PoolConfig config{ policy, payload_size, num_threads * payloads_per_thread, 0 };
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+
+    // One history per thread, as each writer reserves its own
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        pool->reserve_history(config, false);
+    }
+
+    std::string name = "Payload pool " + policy_name + " (" + std::to_string(num_threads) + " threads)";
+    measure(name, iterations, [&](uint64_t)
+            {
+                run_threads(num_threads, [&]()
+                {
+                    CacheChange_t change;
+                    if (!pool->get_payload(payload_size, change))
+                    {
+                        std::cerr << "Error getting payload" << std::endl;
+                        std::exit(1);
+                    }
+                    pool->release_payload(change);
+                });
+            });
+
+    for (uint32_t t = 0; t < num_threads; ++t)
+    {
+        pool->release_history(config, false);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 200);
+
+    for (uint32_t num_threads : {1u, 4u, 8u})
+    {
+        run_free_lists(num_threads, iterations);
+        run_pool(PREALLOCATED_MEMORY_MODE, "preallocated", num_threads, iterations);
+        run_pool(PREALLOCATED_WITH_REALLOC_MEMORY_MODE, "prealloc realloc", num_threads, iterations);
+        run_pool(DYNAMIC_RESERVE_MEMORY_MODE, "dynamic", num_threads, iterations);
+        run_pool(DYNAMIC_REUSABLE_MEMORY_MODE, "dynamic reusable", num_threads, iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,165 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the delivery of a sample to several DataReaders on the same participant as the DataWriter. Every
+ * iteration writes a sample, reads it with a loan on every reader and then takes it. Readers deserializing each
+ * loan on their own are compared with readers sharing the deserialized sample cache.
+ */
+
+#include "BlobType.hpp"
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::benchmark;
+
+using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+
+static void wait_matched(
+        DataWriter* writer,
+        int32_t readers)
+{
+    PublicationMatchedStatus status;
+    for (int i = 0; i < 500; ++i)
+    {
+        writer->get_publication_matched_status(status);
+        if (status.current_count == readers)
+        {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::cerr << "Timeout waiting for the readers to match" << std::endl;
+    std::exit(1);
+}
+
+static void receive(
+        DataReader* reader,
+        bool take)
+{
+    BlobSampleSeq values;
+    SampleInfoSeq infos;
+    ReturnCode_t ret = take ? reader->take(values, infos, 1) : reader->read(values, infos, 1);
+    if (ReturnCode_t::RETCODE_OK != ret || values.length() != 1)
+    {
+        std::cerr << "Sample not received" << std::endl;
+        std::exit(1);
+    }
+    reader->return_loan(values, infos);
+}
+
+static void run(
+        DomainParticipant* participant,
+        Topic* topic,
+        uint32_t num_readers,
+        bool use_cache,
+        uint64_t iterations)
+{
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = 1;
+    DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    reader_qos.history().depth = 1;
+    if (use_cache)
+    {
+        reader_qos.properties().properties().emplace_back("fastdds.deserialized_sample_cache", "1");
+    }
+
+    std::vector<DataReader*> readers;
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        readers.push_back(subscriber->create_datareader(topic, reader_qos));
+    }
+    wait_matched(writer, static_cast<int32_t>(num_readers));
+
+    BlobSample sample;
+    sample.data.resize(max_sample_size);
+
+    std::string name = std::string(use_cache ? "Cached" : "Uncached") + " delivery to " +
+            std::to_string(num_readers) + " readers";
+    measure(name, iterations, [&](uint64_t)
+            {
+                writer->write(&sample);
+                for (DataReader* reader : readers)
+                {
+                    receive(reader, false);
+                    receive(reader, true);
+                }
+            });
+
+    for (DataReader* reader : readers)
+    {
+        subscriber->delete_datareader(reader);
+    }
+    publisher->delete_datawriter(writer);
+    participant->delete_subscriber(subscriber);
+    participant->delete_publisher(publisher);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 2000);
+
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new BlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic("ReaderFanoutTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+
+    for (uint32_t num_readers : {1u, 8u})
+    {
+        run(participant, topic, num_readers, false, iterations);
+        run(participant, topic, num_readers, true, iterations);
+    }
+
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    return 0;
+}
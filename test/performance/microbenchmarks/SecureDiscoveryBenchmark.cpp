@@ -0,0 +1,166 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the time a group of secure participants on the same process needs until every participant has
+ * authenticated every other one. Participants only use UDPv4 on the loopback interface, with the initial peers
+ * covering the ports of the whole group.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/DomainParticipantListener.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static const std::string certs_path = CERTS_PATH;
+
+class AuthenticationCounter : public DomainParticipantListener
+{
+public:
+
+    void onParticipantAuthentication(
+            DomainParticipant*,
+            ParticipantAuthenticationInfo&& info) override
+    {
+        if (ParticipantAuthenticationInfo::AUTHORIZED_PARTICIPANT == info.status)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++authorized_;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait(
+            uint32_t expected,
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [&]()
+                       {
+                           return authorized_ >= expected;
+                       });
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint32_t authorized_ = 0;
+};
+
+static DomainParticipantQos participant_qos(
+        uint32_t participants)
+{
+    DomainParticipantQos qos;
+
+    auto udp_transport = std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+    udp_transport->interfaceWhiteList.push_back("127.0.0.1");
+    udp_transport->maxInitialPeersRange = participants;
+    qos.transport().use_builtin_transports = false;
+    qos.transport().user_transports.push_back(udp_transport);
+
+    Locator_t peer;
+    IPLocator::setIPv4(peer, 127, 0, 0, 1);
+    qos.wire_protocol().builtin.initialPeersList.push_back(peer);
+
+    PropertySeq& properties = qos.properties().properties();
+    properties.emplace_back("dds.sec.auth.plugin", "builtin.PKI-DH");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.identity_ca", "file://" + certs_path + "/maincacert.pem");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.identity_certificate",
+            "file://" + certs_path + "/mainpubcert.pem");
+    properties.emplace_back("dds.sec.auth.builtin.PKI-DH.private_key", "file://" + certs_path + "/mainpubkey.pem");
+    properties.emplace_back("dds.sec.access.plugin", "builtin.Access-Permissions");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.permissions_ca",
+            "file://" + certs_path + "/maincacert.pem");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.governance",
+            "file://" + certs_path + "/governance_helloworld_all_enable.smime");
+    properties.emplace_back("dds.sec.access.builtin.Access-Permissions.permissions",
+            "file://" + certs_path + "/permissions_helloworld.smime");
+    properties.emplace_back("dds.sec.crypto.plugin", "builtin.AES-GCM-GMAC");
+
+    return qos;
+}
+
+static bool run(
+        uint32_t participants,
+        uint64_t iterations)
+{
+    DomainParticipantQos qos = participant_qos(participants);
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    bool ret = true;
+
+    std::string name = "Mutual authentication of " + std::to_string(participants) + " participants";
+    measure(name, iterations, [&](uint64_t)
+            {
+                AuthenticationCounter counter;
+                std::vector<DomainParticipant*> created;
+
+                for (uint32_t i = 0; i < participants; ++i)
+                {
+                    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(
+                        domain_id, qos, &counter);
+                    if (nullptr == participant)
+                    {
+                        std::cerr << "Error creating participant" << std::endl;
+                        ret = false;
+                        break;
+                    }
+                    created.push_back(participant);
+                }
+
+                if (ret && !counter.wait(participants * (participants - 1), std::chrono::seconds(60)))
+                {
+                    std::cerr << "Timeout waiting for the authentication of " << participants << " participants" <<
+                        std::endl;
+                    ret = false;
+                }
+
+                for (DomainParticipant* participant : created)
+                {
+                    DomainParticipantFactory::get_instance()->delete_participant(participant);
+                }
+            });
+
+    return ret;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 5);
+
+    if (!run(8, iterations) || !run(24, iterations))
+    {
+        return 1;
+    }
+
+    return 0;
+}
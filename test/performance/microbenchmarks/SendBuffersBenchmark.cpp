@@ -0,0 +1,152 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures several threads getting and returning send buffers from the pool of a participant, as writers on
+ * different threads, the event thread and the asynchronous writer thread do for every message group. The pool of
+ * the participant is compared with a vector protected by a mutex, which was the previous implementation. Each
+ * iteration performs a fixed number of operations on every thread.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <rtps/RTPSDomainImpl.hpp>
+#include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint32_t operations_per_thread = 10000;
+static constexpr size_t pool_size = 4;
+
+class MutexSendBuffers
+{
+public:
+
+    MutexSendBuffers(
+            const RTPSParticipantImpl* participant)
+    {
+        for (size_t i = 0; i < pool_size; ++i)
+        {
+            pool_.emplace_back(new RTPSMessageGroup_t(
+#if HAVE_SECURITY
+                        false,
+#endif
+                        participant->getMaxMessageSize(), participant->getGuid().guidPrefix));
+        }
+    }
+
+    std::unique_ptr<RTPSMessageGroup_t> get_buffer(
+            const RTPSParticipantImpl*)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        available_cv_.wait(lock, [this]()
+                {
+                    return !pool_.empty();
+                });
+        std::unique_ptr<RTPSMessageGroup_t> buffer = std::move(pool_.back());
+        pool_.pop_back();
+        return buffer;
+    }
+
+    void return_buffer(
+            std::unique_ptr<RTPSMessageGroup_t>&& buffer)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        pool_.push_back(std::move(buffer));
+        available_cv_.notify_one();
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<RTPSMessageGroup_t>> pool_;
+    std::condition_variable available_cv_;
+};
+
+template<typename Pool>
+static void run(
+        const std::string& name,
+        Pool& pool,
+        const RTPSParticipantImpl* participant,
+        uint32_t num_threads,
+        uint64_t iterations)
+{
+    measure(name + " (" + std::to_string(num_threads) + " threads)", iterations, [&](uint64_t)
+            {
+                std::vector<std::thread> threads;
+                for (uint32_t t = 0; t < num_threads; ++t)
+                {
+                    threads.emplace_back([&]()
+                    {
+                        for (uint32_t n = 0; n < operations_per_thread; ++n)
+                        {
+                            std::unique_ptr<RTPSMessageGroup_t> buffer = pool.get_buffer(participant);
+                            buffer->rtpsmsg_submessage_.length = n;
+                            pool.return_buffer(std::move(buffer));
+                        }
+                    });
+                }
+
+                for (std::thread& thread : threads)
+                {
+                    thread.join();
+                }
+            });
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 200);
+
+    RTPSParticipantAttributes attributes;
+    attributes.builtin.discovery_config.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol::NONE;
+    attributes.builtin.use_WriterLivelinessProtocol = false;
+    RTPSParticipant* participant = RTPSDomain::createParticipant(0, attributes);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+    RTPSParticipantImpl* participant_impl = RTPSDomainImpl::find_local_participant(participant->getGuid());
+
+    for (uint32_t num_threads : {1u, 4u, 8u})
+    {
+        MutexSendBuffers mutex_pool(participant_impl);
+        run("Mutex send buffers", mutex_pool, participant_impl, num_threads, iterations);
+
+        SendBuffersManager pool(pool_size, false);
+        pool.init(participant_impl);
+        run("Send buffers manager", pool, participant_impl, num_threads, iterations);
+        std::cout << "    exhausted " << pool.times_exhausted() << " times, waited " << pool.times_waited() <<
+            " times" << std::endl;
+    }
+
+    RTPSDomain::removeRTPSParticipant(participant);
+    return 0;
+}
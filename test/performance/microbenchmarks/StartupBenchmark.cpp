@@ -0,0 +1,140 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures the startup of a short-lived application. Every iteration creates a participant with a DataWriter and
+ * waits until it matches a DataReader of a participant that is already running, then deletes the participant.
+ * Participants creating all their builtin endpoints are compared with participants creating them on demand. The
+ * creation of the participant alone is also measured.
+ */
+
+#include "BlobType.hpp"
+#include "Microbenchmark.hpp"
+
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastdds::benchmark;
+
+static const char* topic_name = "StartupTopic";
+
+static void wait_matched(
+        DataWriter* writer)
+{
+    PublicationMatchedStatus status;
+    for (int i = 0; i < 10000; ++i)
+    {
+        writer->get_publication_matched_status(status);
+        if (status.current_count > 0)
+        {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::cerr << "Timeout waiting for the reader to match" << std::endl;
+    std::exit(1);
+}
+
+static DomainParticipant* create_participant(
+        DomainId_t domain_id,
+        bool lazy)
+{
+    DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+    qos.wire_protocol().builtin.lazy_builtin_endpoints = lazy;
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(domain_id, qos);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        std::exit(1);
+    }
+    return participant;
+}
+
+static void run(
+        DomainId_t domain_id,
+        bool lazy,
+        uint64_t iterations)
+{
+    std::string mode = lazy ? "on demand" : "eager";
+
+    measure("Participant creation (" + mode + ")", iterations, [&](uint64_t)
+            {
+                DomainParticipant* participant = create_participant(domain_id, lazy);
+                DomainParticipantFactory::get_instance()->delete_participant(participant);
+            });
+
+    measure("Creation to first match (" + mode + ")", iterations, [&](uint64_t)
+            {
+                DomainParticipant* participant = create_participant(domain_id, lazy);
+                TypeSupport type(new BlobType());
+                type.register_type(participant);
+                Topic* topic = participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+                Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+                DataWriter* writer = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+
+                wait_matched(writer);
+
+                publisher->delete_datawriter(writer);
+                participant->delete_publisher(publisher);
+                participant->delete_topic(topic);
+                DomainParticipantFactory::get_instance()->delete_participant(participant);
+            });
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 50);
+
+    DomainId_t domain_id = static_cast<DomainId_t>(getpid() % 230);
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+    if (nullptr == participant)
+    {
+        std::cerr << "Error creating participant" << std::endl;
+        return 1;
+    }
+
+    TypeSupport type(new BlobType());
+    type.register_type(participant);
+    Topic* topic = participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    Subscriber* subscriber = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+    DataReader* reader = subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT);
+
+    run(domain_id, false, iterations);
+    run(domain_id, true, iterations);
+
+    subscriber->delete_datareader(reader);
+    participant->delete_subscriber(subscriber);
+    participant->delete_topic(topic);
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+
+    return 0;
+}
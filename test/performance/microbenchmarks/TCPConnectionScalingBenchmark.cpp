@@ -0,0 +1,225 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Measures a TCP transport serving many connections over loopback. A client transport connects to each of the
+ * listening ports of a server transport, and every iteration sends a message on each connection and waits until
+ * the server has received all of them. Channels served by a thread each are compared with channels served
+ * asynchronously from a few I/O threads, and the number of threads of the process is reported for both.
+ */
+
+#include "Microbenchmark.hpp"
+
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/network/SenderResource.h>
+#include <fastdds/rtps/transport/TCPv4Transport.h>
+#include <fastdds/rtps/transport/TCPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/TransportReceiverInterface.h>
+#include <fastrtps/utils/IPLocator.h>
+#include <rtps/transport/TCPSenderResource.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps;
+using namespace eprosima::fastdds::benchmark;
+
+static constexpr uint16_t logical_port = 7410;
+
+class CountingReceiver : public TransportReceiverInterface
+{
+public:
+
+    void OnDataReceived(
+            const octet*,
+            const uint32_t,
+            const Locator_t&,
+            const Locator_t&) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++received_;
+        cv_.notify_all();
+    }
+
+    //! Wait until the total number of messages received reaches a value.
+    bool wait(
+            uint64_t total)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(10), [&]()
+                       {
+                           return received_ >= total;
+                       });
+    }
+
+    uint64_t received()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return received_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t received_ = 0;
+};
+
+//! Number of threads of this process.
+static std::string num_threads()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, 8, "Threads:"))
+        {
+            return line.substr(8);
+        }
+    }
+    return " unknown";
+}
+
+static bool send_one(
+        SenderResource& sender,
+        const Locator_t& locator,
+        const octet* message,
+        uint32_t size)
+{
+    LocatorList_t locators;
+    locators.push_back(locator);
+    Locators begin(locators.begin());
+    Locators end(locators.end());
+    return sender.send(message, size, &begin, &end, std::chrono::steady_clock::now() + std::chrono::seconds(1));
+}
+
+static void run(
+        uint16_t async_io_threads,
+        uint16_t base_port,
+        uint16_t num_connections,
+        uint64_t iterations)
+{
+    TCPv4TransportDescriptor server_descriptor;
+    server_descriptor.async_io_threads = async_io_threads;
+    for (uint16_t i = 0; i < num_connections; ++i)
+    {
+        server_descriptor.add_listener_port(static_cast<uint16_t>(base_port + i));
+    }
+    TCPv4Transport server(server_descriptor);
+    server.init();
+
+    CountingReceiver receiver;
+    Locator_t input_locator;
+    input_locator.kind = LOCATOR_KIND_TCPv4;
+    input_locator.port = base_port;
+    IPLocator::setIPv4(input_locator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(input_locator, logical_port);
+    server.OpenInputChannel(input_locator, &receiver, server_descriptor.maxMessageSize);
+
+    TCPv4TransportDescriptor client_descriptor;
+    client_descriptor.async_io_threads = async_io_threads;
+    TCPv4Transport client(client_descriptor);
+    client.init();
+
+    SendResourceList senders;
+    std::vector<Locator_t> locators;
+    for (uint16_t i = 0; i < num_connections; ++i)
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_TCPv4;
+        IPLocator::setIPv4(locator, 127, 0, 0, 1);
+        locator.port = static_cast<uint16_t>(base_port + i);
+        IPLocator::setLogicalPort(locator, logical_port);
+        client.OpenOutputChannel(senders, locator);
+        locators.push_back(locator);
+    }
+
+    if (senders.size() != num_connections)
+    {
+        std::cerr << "Error opening the output channels" << std::endl;
+        std::exit(1);
+    }
+
+    std::vector<octet> message(256, 0x55);
+    uint32_t message_size = static_cast<uint32_t>(message.size());
+
+    // Wait for the negotiation of every connection, which accepts sends once the logical port is opened
+    uint64_t expected = 0;
+    for (uint16_t i = 0; i < num_connections; ++i)
+    {
+        auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!send_one(*senders[i], locators[i], message.data(), message_size))
+        {
+            if (std::chrono::steady_clock::now() > timeout)
+            {
+                std::cerr << "Timeout establishing connection " << i << std::endl;
+                std::exit(1);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ++expected;
+    }
+    receiver.wait(expected);
+
+    std::string mode = 0 == async_io_threads ? "thread per channel" :
+            std::to_string(async_io_threads) + " I/O threads";
+    std::string name = std::to_string(num_connections) + " connections, " + mode;
+    std::cout << std::left << std::setw(48) << name << "threads:" << num_threads() << std::endl;
+
+    measure(name, iterations, [&](uint64_t)
+            {
+                for (uint16_t i = 0; i < num_connections; ++i)
+                {
+                    send_one(*senders[i], locators[i], message.data(), message_size);
+                }
+                expected += num_connections;
+                if (!receiver.wait(expected))
+                {
+                    std::cerr << "Timeout receiving messages (" << receiver.received() << " of " << expected << ")" <<
+                        std::endl;
+                    std::exit(1);
+                }
+            });
+
+    senders.clear();
+    server.CloseInputChannel(input_locator);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint64_t iterations = eprosima::fastdds::benchmark::iterations(argc, argv, 2000);
+    uint16_t max_connections = iterations < 100 ? 16 : 200;
+    uint16_t base_port = static_cast<uint16_t>(20000 + (getpid() % 100) * 400);
+
+    for (uint16_t num_connections = 4; num_connections <= max_connections; num_connections *= 4)
+    {
+        run(0, base_port, num_connections, iterations);
+        run(2, static_cast<uint16_t>(base_port + num_connections), num_connections, iterations);
+    }
+
+    return 0;
+}
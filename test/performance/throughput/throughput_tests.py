@@ -61,11 +61,19 @@ if __name__ == '__main__':
         help='Publisher and subscribers in separate processes. Defaults:False',
         required=False,
     )
+    parser.add_argument(
+        '-d',
+        '--dynamic_types',
+        action='store_true',
+        help='Use a dynamic type with an unbounded sequence. Defaults:False',
+        required=False,
+    )
     # Parse arguments
     args = parser.parse_args()
     xml_file = args.xml_file
     security = args.security
     interprocess = args.interprocess
+    dynamic_types = args.dynamic_types
     recoveries_file = args.recoveries_file
 
     if security and not interprocess:
@@ -155,6 +163,12 @@ if __name__ == '__main__':
     domain = str(os.getpid() % 230)
     domain_options = ['--domain', domain]
 
+    # Dynamic types
+    dynamic_types_options = []
+    if dynamic_types is True:
+        dynamic_types_options = ['--dynamic_types']
+        reliability += '_dynamic_types'
+
     if interprocess is True:
         # Base of test command for publisher agent
         pub_command = [
@@ -190,8 +204,10 @@ if __name__ == '__main__':
         pub_command += recoveries_options
         pub_command += domain_options
         pub_command += xml_options
+        pub_command += dynamic_types_options
         sub_command += domain_options
         sub_command += xml_options
+        sub_command += dynamic_types_options
 
         print('Publisher command: {}'.format(
             ' '.join(element for element in pub_command)),
@@ -242,6 +258,7 @@ if __name__ == '__main__':
         command += recoveries_options
         command += domain_options
         command += xml_options
+        command += dynamic_types_options
 
         print('Executable command: {}'.format(
             ' '.join(element for element in command)),
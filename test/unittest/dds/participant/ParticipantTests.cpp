@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -147,6 +152,97 @@ TEST(ParticipantTests, ChangeDomainParticipantFactoryQos)
     ASSERT_EQ(fqos.entity_factory().autoenable_created_entities, false);
 }
 
+TEST(ParticipantTests, SharedThreadPoolsFactoryQos)
+{
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantFactoryQos original_qos;
+    factory->get_qos(original_qos);
+    ASSERT_FALSE(original_qos.thread_pools().enabled);
+
+    DomainParticipantFactoryQos qos = original_qos;
+    qos.thread_pools().enabled = true;
+    qos.thread_pools().timed_events.num_threads = 2;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->set_qos(qos));
+
+    // The settings are taken by the participants from the library settings
+    EXPECT_EQ(qos.thread_pools(),
+            eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings().thread_pools);
+
+    // Records the threads running the timed events of the writers, where liveliness is lost
+    class LivelinessLostListener : public DataWriterListener
+    {
+    public:
+
+        void on_liveliness_lost(
+                DataWriter* /*writer*/,
+                const LivelinessLostStatus& /*status*/) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.push_back(std::this_thread::get_id());
+            cv.notify_all();
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<std::thread::id> threads;
+    };
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.liveliness().kind = MANUAL_BY_TOPIC_LIVELINESS_QOS;
+    writer_qos.liveliness().lease_duration = Duration_t(0, 100000000);
+    writer_qos.liveliness().announcement_period = Duration_t(0, 50000000);
+
+    // Participants on several domains share the threads
+    const size_t num_participants = 3;
+    LivelinessLostListener listener;
+    std::vector<DomainParticipant*> participants;
+    std::vector<Topic*> topics;
+    std::vector<Publisher*> publishers;
+    std::vector<DataWriter*> writers;
+    for (DomainId_t domain_id = 0; domain_id < num_participants; ++domain_id)
+    {
+        DomainParticipant* participant = factory->create_participant(domain_id, PARTICIPANT_QOS_DEFAULT);
+        ASSERT_NE(participant, nullptr);
+        participants.push_back(participant);
+
+        TypeSupport type(new TopicDataTypeMock());
+        type.register_type(participant);
+        Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+        ASSERT_NE(topic, nullptr);
+        topics.push_back(topic);
+        Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        ASSERT_NE(publisher, nullptr);
+        publishers.push_back(publisher);
+        DataWriter* writer = publisher->create_datawriter(topic, writer_qos, &listener);
+        ASSERT_NE(writer, nullptr);
+        writers.push_back(writer);
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, writer->assert_liveliness());
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(listener.mutex);
+        ASSERT_TRUE(listener.cv.wait_for(lock, std::chrono::seconds(5), [&]()
+                {
+                    return listener.threads.size() >= num_participants;
+                }));
+
+        // Each participant would lose the liveliness of its writer on its own thread without the pools
+        std::set<std::thread::id> distinct_threads(listener.threads.begin(), listener.threads.end());
+        EXPECT_LE(distinct_threads.size(), 2u);
+    }
+
+    for (size_t i = 0; i < num_participants; ++i)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, publishers[i]->delete_datawriter(writers[i]));
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, participants[i]->delete_publisher(publishers[i]));
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, participants[i]->delete_topic(topics[i]));
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->delete_participant(participants[i]));
+    }
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, factory->set_qos(original_qos));
+    EXPECT_FALSE(eprosima::fastrtps::xmlparser::XMLProfileManager::library_settings().thread_pools.enabled);
+}
+
 TEST(ParticipantTests, CreateDomainParticipant)
 {
     DomainParticipant* participant =
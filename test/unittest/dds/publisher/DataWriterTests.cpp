@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -442,6 +445,125 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+class UnboundedTopicDataTypeMock : public TopicDataType
+{
+public:
+
+    typedef FooType type;
+
+    UnboundedTopicDataTypeMock(
+            bool checks_bounds)
+        : TopicDataType()
+    {
+        m_typeSize = 0u;
+        setName(checks_bounds ? "checked_footype" : "unchecked_footype");
+        checks_serialization_bounds(checks_bounds);
+    }
+
+    bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override
+    {
+        const std::string& message = static_cast<FooType*>(data)->message();
+        if (payload->max_size < message.size())
+        {
+            // A type not checking the bounds would write past the end of the payload here
+            ++undersized_payloads;
+            return false;
+        }
+        memcpy(payload->data, message.data(), message.size());
+        payload->length = static_cast<uint32_t>(message.size());
+        return true;
+    }
+
+    bool deserialize(
+            fastrtps::rtps::SerializedPayload_t* /*payload*/,
+            void* /*data*/) override
+    {
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override
+    {
+        return [data]()
+               {
+                   return static_cast<uint32_t>(static_cast<FooType*>(data)->message().size());
+               };
+    }
+
+    void* createData() override
+    {
+        return nullptr;
+    }
+
+    void deleteData(
+            void* /*data*/) override
+    {
+    }
+
+    bool getKey(
+            void* /*data*/,
+            fastrtps::rtps::InstanceHandle_t* /*ihandle*/,
+            bool /*force_md5*/) override
+    {
+        return true;
+    }
+
+    uint32_t undersized_payloads = 0u;
+};
+
+void write_growing_samples_test(
+        TypeSupport& type)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.endpoint().history_memory_policy = fastrtps::rtps::DYNAMIC_RESERVE_MEMORY_MODE;
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    // Small samples, followed by a sample bigger than all of them
+    FooType data;
+    data.message("HelloWorld");
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(&data, fastrtps::rtps::c_InstanceHandle_Unknown));
+    }
+    data.message(std::string(4096, 'a'));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(&data, fastrtps::rtps::c_InstanceHandle_Unknown));
+
+    ASSERT_EQ(publisher->delete_datawriter(datawriter), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
+TEST(DataWriterTests, WriteReservesSerializedSize)
+{
+    // Types not checking the bounds get payloads of at least the serialized size of each sample
+    UnboundedTopicDataTypeMock* unchecked_type = new UnboundedTopicDataTypeMock(false);
+    TypeSupport unchecked_support(unchecked_type);
+    write_growing_samples_test(unchecked_support);
+    EXPECT_EQ(0u, unchecked_type->undersized_payloads);
+
+    // Types checking the bounds may get payloads from the estimate, and are retried with the exact size
+    UnboundedTopicDataTypeMock* checked_type = new UnboundedTopicDataTypeMock(true);
+    TypeSupport checked_support(checked_type);
+    write_growing_samples_test(checked_support);
+    EXPECT_EQ(1u, checked_type->undersized_payloads);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
@@ -673,6 +795,71 @@ TEST(DataWriterTests, LoanPositiveTests)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+/*!
+ * Threads writing loaned samples on the same DataWriter at the same time. Loaned samples are written without
+ * blocking the writer, so the loans must be tracked safely by all the threads.
+ */
+TEST(DataWriterTests, LoanConcurrentWrites)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_samples = 500;
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new LoanableTypeSupport());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("loanable_topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    // Every thread holds at most one loan at a time
+    DataWriterQos wqos;
+    wqos.history().depth = 1;
+    wqos.resource_limits().extra_samples = num_threads;
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, wqos);
+    ASSERT_NE(datawriter, nullptr);
+
+    auto write_loans = [datawriter, num_samples]()
+            {
+                fastrtps::rtps::InstanceHandle_t handle;
+                for (int i = 0; i < num_samples; ++i)
+                {
+                    void* sample = nullptr;
+                    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->loan_sample(sample));
+                    if (0 == i % 10)
+                    {
+                        ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->discard_loan(sample));
+                    }
+                    else
+                    {
+                        ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write(sample, handle));
+                    }
+                }
+            };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back(write_loans);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // No loan is left, so the writer can be deleted
+    ASSERT_EQ(publisher->delete_datawriter(datawriter), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_topic(topic), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(participant->delete_publisher(publisher), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(DomainParticipantFactory::get_instance()->delete_participant(participant), ReturnCode_t::RETCODE_OK);
+}
+
 class LoanableTypeSupportTesting : public LoanableTypeSupport
 {
 public:
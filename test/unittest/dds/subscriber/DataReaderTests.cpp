@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <cassert>
+#include <memory>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -875,6 +877,207 @@ TEST_F(DataReaderTests, return_loan)
     EXPECT_EQ(ok_code, subscriber_->delete_datareader(reader2));
 }
 
+/*
+ * This test checks that samples written with write_shared are loaned without copies to the intra-process readers
+ * configured to share them, while the rest of readers still get a deserialized copy, and that the loans keep the
+ * shared samples alive.
+ */
+TEST_F(DataReaderTests, intraprocess_shared_samples)
+{
+    type_.reset(new FooBoundedTypeSupport());
+
+    // Samples are only shared with readers receiving the payload of the writer through intra-process delivery
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.data_sharing().off();
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.data_sharing().off();
+
+    DataReaderQos sharing_qos = reader_qos;
+    sharing_qos.properties().properties().emplace_back("fastdds.intraprocess_shared_samples", "true");
+
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+    DataReader* sharing_reader = subscriber_->create_datareader(topic_, sharing_qos);
+    ASSERT_NE(sharing_reader, nullptr);
+
+    std::shared_ptr<FooBoundedType> data = std::make_shared<FooBoundedType>();
+    data->index(1);
+    data->message().assign(100, 'a');
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    EXPECT_EQ(ok_code, data_writer_->write_shared(data));
+    // Kept by the writer while the change is on its history
+    EXPECT_EQ(2, data.use_count());
+
+    FooBoundedSeq data_values;
+    SampleInfoSeq infos;
+    FooBoundedSeq shared_values;
+    SampleInfoSeq shared_infos;
+
+    // The reader without the property deserializes the sample
+    EXPECT_EQ(ok_code, data_reader_->take(data_values, infos));
+    ASSERT_EQ(1, data_values.length());
+    EXPECT_NE(data.get(), &data_values[0]);
+    EXPECT_EQ(data->index(), data_values[0].index());
+    EXPECT_EQ(data->message(), data_values[0].message());
+    EXPECT_EQ(ok_code, data_reader_->return_loan(data_values, infos));
+
+    // The sharing reader loans the written sample
+    EXPECT_EQ(ok_code, sharing_reader->take(shared_values, shared_infos));
+    ASSERT_EQ(1, shared_values.length());
+    EXPECT_EQ(data.get(), &shared_values[0]);
+    EXPECT_EQ(3, data.use_count());
+    EXPECT_EQ(ok_code, sharing_reader->return_loan(shared_values, shared_infos));
+    EXPECT_EQ(2, data.use_count());
+
+    EXPECT_EQ(ok_code, subscriber_->delete_datareader(sharing_reader));
+}
+
+/*
+ * This test checks that the readers using the deserialized sample cache share the samples loaned for the same
+ * change, and that a sample is not deserialized again when it is read and then taken.
+ */
+TEST_F(DataReaderTests, deserialized_sample_cache)
+{
+    type_.reset(new FooBoundedTypeSupport());
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.properties().properties().emplace_back("fastdds.deserialized_sample_cache", "4");
+
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+    DataReader* reader2 = subscriber_->create_datareader(topic_, reader_qos);
+    ASSERT_NE(reader2, nullptr);
+    DataReader* uncached_reader = subscriber_->create_datareader(topic_, DATAREADER_QOS_DEFAULT);
+    ASSERT_NE(uncached_reader, nullptr);
+
+    FooBoundedType data;
+    data.index(1);
+    data.message().assign(100, 'a');
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+
+    FooBoundedSeq data_values;
+    SampleInfoSeq infos;
+    FooBoundedSeq data_values_2;
+    SampleInfoSeq infos_2;
+    FooBoundedSeq uncached_values;
+    SampleInfoSeq uncached_infos;
+
+    // Readers using the cache loan the same sample
+    EXPECT_EQ(ok_code, data_reader_->read(data_values, infos));
+    EXPECT_EQ(ok_code, reader2->read(data_values_2, infos_2));
+    EXPECT_EQ(ok_code, uncached_reader->read(uncached_values, uncached_infos));
+    ASSERT_EQ(1, data_values.length());
+    ASSERT_EQ(1, data_values_2.length());
+    ASSERT_EQ(1, uncached_values.length());
+    const FooBoundedType* cached_sample = &data_values[0];
+    EXPECT_EQ(cached_sample, &data_values_2[0]);
+    EXPECT_NE(cached_sample, &uncached_values[0]);
+    EXPECT_EQ(data.index(), cached_sample->index());
+    EXPECT_EQ(data.message(), cached_sample->message());
+    EXPECT_EQ(data.message(), uncached_values[0].message());
+
+    EXPECT_EQ(ok_code, data_reader_->return_loan(data_values, infos));
+    EXPECT_EQ(ok_code, reader2->return_loan(data_values_2, infos_2));
+    EXPECT_EQ(ok_code, uncached_reader->return_loan(uncached_values, uncached_infos));
+
+    // The sample is kept on the cache after the loans are returned
+    EXPECT_EQ(ok_code, data_reader_->take(data_values, infos));
+    ASSERT_EQ(1, data_values.length());
+    EXPECT_EQ(cached_sample, &data_values[0]);
+    EXPECT_EQ(ok_code, data_reader_->return_loan(data_values, infos));
+
+    EXPECT_EQ(ok_code, subscriber_->delete_datareader(reader2));
+    EXPECT_EQ(ok_code, subscriber_->delete_datareader(uncached_reader));
+}
+
+/*
+ * This test checks that the samples loaned for a non plain type are constructed when the reader is enabled, as
+ * indicated by allocated_samples, and reused by later loans.
+ */
+TEST_F(DataReaderTests, loaned_samples_preallocated)
+{
+    class CountingTypeSupport : public FooBoundedTypeSupport
+    {
+    public:
+
+        void* createData() override
+        {
+            ++created;
+            return FooBoundedTypeSupport::createData();
+        }
+
+        std::atomic<uint32_t> created{0};
+    };
+
+    CountingTypeSupport* counting_type = new CountingTypeSupport();
+    type_.reset(counting_type);
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_samples = 10;
+    reader_qos.resource_limits().max_samples_per_instance = 10;
+    reader_qos.resource_limits().allocated_samples = 4;
+
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+    EXPECT_EQ(4u, counting_type->created.load());
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    FooBoundedType data;
+    data.message().assign(100, 'a');
+    FooBoundedSeq data_values;
+    SampleInfoSeq infos;
+
+    // Loaning fewer samples than allocated_samples does not construct samples
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        data.index(i);
+        EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+        EXPECT_EQ(ok_code, data_reader_->take(data_values, infos));
+        ASSERT_EQ(1, data_values.length());
+        EXPECT_EQ(i, data_values[0].index());
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_values, infos));
+    }
+    EXPECT_EQ(4u, counting_type->created.load());
+
+    // Samples constructed to loan more samples at once are reused afterwards
+    for (uint32_t n = 0; n < 2; ++n)
+    {
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            EXPECT_EQ(ok_code, data_writer_->write(&data, HANDLE_NIL));
+        }
+        EXPECT_EQ(ok_code, data_reader_->take(data_values, infos));
+        EXPECT_EQ(6, data_values.length());
+        EXPECT_EQ(ok_code, data_reader_->return_loan(data_values, infos));
+        EXPECT_EQ(6u, counting_type->created.load());
+    }
+
+    // With KEEP_LAST, no more samples are constructed than the history holds
+    DataReaderQos keep_last_qos = reader_qos;
+    keep_last_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    keep_last_qos.history().depth = 2;
+    DataReader* keep_last_reader = subscriber_->create_datareader(topic_, keep_last_qos);
+    ASSERT_NE(keep_last_reader, nullptr);
+    EXPECT_EQ(8u, counting_type->created.load());
+    EXPECT_EQ(ok_code, subscriber_->delete_datareader(keep_last_reader));
+}
+
 /*
  * This test checks that the limits imposed by reader_resource_limits QoS are taken into account when performing loans.
  */
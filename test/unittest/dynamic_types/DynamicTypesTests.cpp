@@ -22,12 +22,16 @@
 #include <fastrtps/types/MemberDescriptor.h>
 #include <fastrtps/types/DynamicType.h>
 #include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicDataLayout.h>
+#include <fastrtps/types/FlatDynamicData.h>
+#include <fastrtps/types/FlatDynamicPubSubType.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/types/DynamicDataPtr.h>
 #include <fastrtps/types/TypeObjectFactory.h>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
 #include "idl/BasicPubSubTypes.h"
 #include "idl/BasicTypeObject.h"
 #include <tinyxml2.h>
@@ -5071,6 +5075,142 @@ TEST(TypeIdentifierTests, MinimalTypeIdentifierComparision)
     ASSERT_FALSE(unionUnionStruct1 == unionUnion1);
 }
 
+TEST_F(DynamicTypesTests, DynamicDataLayout_unit_tests)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder_ptr inner_builder = factory->create_struct_builder();
+    inner_builder->add_member(0, "flag", factory->create_bool_type());
+    inner_builder->add_member(1, "count", factory->create_uint32_type());
+    inner_builder->set_name("LayoutInner");
+
+    DynamicTypeBuilder_ptr float64_builder = factory->create_float64_builder();
+    DynamicTypeBuilder_ptr array_builder = factory->create_array_builder(float64_builder.get(), { 4 });
+
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    struct_builder->add_member(0, "short", factory->create_int16_type());
+    struct_builder->add_member(1, "long_long", factory->create_int64_type());
+    struct_builder->add_member(2, "octet", factory->create_byte_type());
+    struct_builder->add_member(3, "doubles", array_builder.get());
+    struct_builder->add_member(4, "inner", inner_builder.get());
+    struct_builder->set_name("LayoutStruct");
+    DynamicType_ptr struct_type = struct_builder->build();
+
+    // Types without a fixed-size representation can't be compiled.
+    DynamicTypeBuilder_ptr string_struct_builder = factory->create_struct_builder();
+    string_struct_builder->add_member(0, "string", factory->create_string_type());
+    ASSERT_TRUE(DynamicDataLayout::compile(string_struct_builder->build()) == nullptr);
+
+    std::shared_ptr<const DynamicDataLayout> layout = DynamicDataLayout::compile(struct_type);
+    ASSERT_TRUE(layout != nullptr);
+    // short(2) + pad(6) + long long(8) + octet(1) + pad(7) + double[4](32) + bool(1) + pad(3) + ulong(4)
+    ASSERT_EQ(layout->serialized_size(), 64u);
+    ASSERT_EQ(layout->operations().size(), 6u);
+
+    DynamicData_ptr data(DynamicDataFactory::get_instance()->create_data(struct_type));
+    ASSERT_EQ(data->set_int16_value(-3, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data->set_int64_value(1234567890123ll, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data->set_byte_value(7, 2), ReturnCode_t::RETCODE_OK);
+    DynamicData* doubles = data->loan_value(3);
+    ASSERT_TRUE(doubles != nullptr);
+    ASSERT_EQ(doubles->set_float64_value(2.5, 2), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data->return_loaned_value(doubles), ReturnCode_t::RETCODE_OK);
+    DynamicData* inner = data->loan_value(4);
+    ASSERT_TRUE(inner != nullptr);
+    ASSERT_EQ(inner->set_bool_value(true, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(inner->set_uint32_value(42u, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(data->return_loaned_value(inner), ReturnCode_t::RETCODE_OK);
+
+    DynamicPubSubType dynamic_pst(struct_type);
+    FlatDynamicPubSubType flat_pst(struct_type);
+    ASSERT_EQ(dynamic_pst.getSerializedSizeProvider(data.get())(), layout->serialized_size() + 4);
+
+    SerializedPayload_t dynamic_payload(dynamic_pst.m_typeSize);
+    ASSERT_TRUE(dynamic_pst.serialize(data.get(), &dynamic_payload));
+
+    // The flat representation reads the payload written by DynamicData.
+    FlatDynamicData* flat = static_cast<FlatDynamicData*>(flat_pst.createData());
+    ASSERT_TRUE(flat_pst.deserialize(&dynamic_payload, flat));
+    int16_t short_value = 0;
+    ASSERT_EQ(flat->get_int16_value(short_value, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(short_value, -3);
+    int64_t long_long_value = 0;
+    ASSERT_EQ(flat->get_int64_value(long_long_value, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(long_long_value, 1234567890123ll);
+    double double_value = 0;
+    ASSERT_EQ(flat->get_float64_value(double_value, 3, 2), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(double_value, 2.5);
+    ASSERT_EQ(flat->get_float64_value(double_value, 3, 4), ReturnCode_t::RETCODE_BAD_PARAMETER);
+    int32_t wrong_kind = 0;
+    ASSERT_EQ(flat->get_int32_value(wrong_kind, 0), ReturnCode_t::RETCODE_BAD_PARAMETER);
+
+    // And writes exactly the same bytes.
+    SerializedPayload_t flat_payload(flat_pst.m_typeSize);
+    ASSERT_TRUE(flat_pst.serialize(flat, &flat_payload));
+    ASSERT_EQ(flat_payload.length, dynamic_payload.length);
+    ASSERT_EQ(0, memcmp(flat_payload.data, dynamic_payload.data, flat_payload.length));
+
+    // Conversions between both representations.
+    FlatDynamicData loaded(layout);
+    ASSERT_TRUE(loaded.load_from(data.get()));
+    ASSERT_TRUE(loaded.equals(*flat));
+    DynamicData_ptr stored(DynamicDataFactory::get_instance()->create_data(struct_type));
+    ASSERT_TRUE(flat->store_to(stored.get()));
+    ASSERT_TRUE(stored->equals(data.get()));
+
+    flat_pst.deleteData(flat);
+}
+
+TEST_F(DynamicTypesTests, DynamicDataLayout_equals_ignores_padding)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    struct_builder->add_member(0, "octet", factory->create_byte_type());
+    struct_builder->add_member(1, "long_double", factory->create_float128_type());
+    struct_builder->set_name("LayoutPaddedStruct");
+    DynamicType_ptr struct_type = struct_builder->build();
+
+    std::shared_ptr<const DynamicDataLayout> layout = DynamicDataLayout::compile(struct_type);
+    ASSERT_TRUE(layout != nullptr);
+
+    FlatDynamicData a(layout);
+    FlatDynamicData b(layout);
+    ASSERT_EQ(a.set_byte_value(3, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(b.set_byte_value(3, 0), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(a.set_float128_value(1.5l, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(b.set_float128_value(1.5l, 1), ReturnCode_t::RETCODE_OK);
+
+    // Garbage on every byte that is not part of a value
+    memset(b.data() + 1, 0xA5, layout->flat_size() - 1);
+    ASSERT_EQ(b.set_float128_value(1.5l, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(a.equals(b));
+
+    ASSERT_EQ(b.set_float128_value(2.5l, 1), ReturnCode_t::RETCODE_OK);
+    ASSERT_FALSE(a.equals(b));
+}
+
+TEST_F(DynamicTypesTests, FlatDynamicPubSubType_unsupported_type)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder_ptr struct_builder = factory->create_struct_builder();
+    struct_builder->add_member(0, "string", factory->create_string_type());
+    struct_builder->set_name("LayoutStringStruct");
+    DynamicType_ptr struct_type = struct_builder->build();
+
+    FlatDynamicPubSubType flat_pst(struct_type);
+    ASSERT_FALSE(flat_pst.is_valid());
+    ASSERT_TRUE(flat_pst.createData() == nullptr);
+
+    // Every entry point fails instead of using the missing layout
+    SerializedPayload_t payload(64);
+    ASSERT_FALSE(flat_pst.serialize(&payload, &payload));
+    ASSERT_FALSE(flat_pst.deserialize(&payload, &payload));
+    InstanceHandle_t handle;
+    ASSERT_FALSE(flat_pst.getKey(&payload, &handle));
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,246 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using namespace eprosima::fastrtps::rtps;
+
+static const char* const backup_file_name = "DiscoveryDataBaseBackupTests.db";
+
+class DiscoveryDataBaseBackupTests : public ::testing::Test
+{
+public:
+
+    DiscoveryDataBaseBackupTests()
+    {
+        server_prefix_.value[0] = 0x02;
+    }
+
+    void TearDown() override
+    {
+        std::remove(backup_file_name);
+    }
+
+    static CacheChange_t* create_change(
+            const GUID_t& entity)
+    {
+        CacheChange_t* change = new CacheChange_t();
+        change->kind = ALIVE;
+        change->writerGUID = entity;
+        change->instanceHandle = InstanceHandle_t(entity);
+        change->sequenceNumber = SequenceNumber_t(0, 1);
+
+        SampleIdentity sample_id;
+        sample_id.writer_guid(entity);
+        sample_id.sequence_number(SequenceNumber_t(0, 1));
+        change->write_params.sample_identity(sample_id);
+        change->write_params.related_sample_identity(sample_id);
+
+        change->serializedPayload.reserve(16);
+        memcpy(change->serializedPayload.data, entity.guidPrefix.value, GuidPrefix_t::size);
+        memcpy(change->serializedPayload.data + GuidPrefix_t::size, entity.entityId.value, EntityId_t::size);
+        change->serializedPayload.length = 16;
+        return change;
+    }
+
+    static void release(
+            DiscoveryDataBase& db)
+    {
+        db.disable();
+        for (CacheChange_t* change : db.clear())
+        {
+            delete change;
+        }
+    }
+
+    //! Adds a client with a writer and a reader on the same topic, and runs the routine of the server on them
+    void populate(
+            DiscoveryDataBase& db,
+            uint32_t clients)
+    {
+        for (uint32_t client = 0; client < clients; ++client)
+        {
+            GuidPrefix_t prefix;
+            prefix.value[0] = 0x01;
+            prefix.value[11] = static_cast<octet>(client);
+
+            RemoteLocatorList locators(1, 1);
+            Locator_t locator;
+            locator.kind = LOCATOR_KIND_UDPv4;
+            locator.port = 7400 + client;
+            locator.address[15] = static_cast<octet>(client);
+            locators.add_unicast_locator(locator);
+
+            db.update(create_change(GUID_t(prefix, c_EntityId_RTPSParticipant)),
+                    DiscoveryParticipantChangeData(locators, true, false));
+            db.update(create_change(GUID_t(prefix, EntityId_t(0x00000103))), "topic");
+            db.update(create_change(GUID_t(prefix, EntityId_t(0x00000104))), "topic");
+        }
+
+        db.process_pdp_data_queue();
+        db.process_edp_data_queue();
+        db.process_dirty_topics();
+        db.clear_pdp_to_send();
+        db.clear_edp_publications_to_send();
+        db.clear_edp_subscriptions_to_send();
+        for (CacheChange_t* change : db.changes_to_release())
+        {
+            delete change;
+        }
+        db.clear_changes_to_release();
+    }
+
+    static std::vector<char> serialize(
+            const DiscoveryDataBase& db)
+    {
+        eprosima::fastcdr::FastBuffer buffer;
+        eprosima::fastcdr::Cdr cdr(buffer);
+        db.to_backup(cdr);
+        return std::vector<char>(buffer.getBuffer(), buffer.getBuffer() + cdr.getSerializedDataLength());
+    }
+
+    static bool write_file(
+            const std::vector<char>& contents)
+    {
+        eprosima::fastcdr::FastBuffer buffer(const_cast<char*>(contents.data()), contents.size());
+        return write_backup_file(backup_file_name, buffer, contents.size());
+    }
+
+protected:
+
+    GuidPrefix_t server_prefix_;
+};
+
+TEST_F(DiscoveryDataBaseBackupTests, round_trip)
+{
+    DiscoveryDataBase db(server_prefix_, {});
+    populate(db, 3);
+    std::vector<char> contents = serialize(db);
+    ASSERT_TRUE(write_file(contents));
+    // Replacing an existing snapshot must succeed as well
+    ASSERT_TRUE(write_file(contents));
+
+    DiscoveryDataBaseBackup backup;
+    ASSERT_TRUE(read_backup_file(backup_file_name, backup));
+    ASSERT_EQ(3u, backup.participants.size());
+    ASSERT_EQ(3u, backup.writers.size());
+    ASSERT_EQ(3u, backup.readers.size());
+    for (const BackupParticipant& participant : backup.participants)
+    {
+        EXPECT_TRUE(participant.is_client);
+        EXPECT_FALSE(participant.is_local);
+        EXPECT_EQ(1u, participant.metatraffic_locators.unicast.size());
+        EXPECT_FALSE(participant.ack_status.empty());
+        EXPECT_EQ(16u, participant.change->serializedPayload.length);
+    }
+    for (const BackupEndpoint& writer : backup.writers)
+    {
+        EXPECT_EQ("topic", writer.topic);
+        EXPECT_FALSE(writer.ack_status.empty());
+    }
+
+    // A database restored from the snapshot stores exactly the same data
+    std::map<InstanceHandle_t, CacheChange_t*> changes_map;
+    for (BackupParticipant& participant : backup.participants)
+    {
+        changes_map[participant.change->instanceHandle] = participant.change.release();
+    }
+    for (std::vector<BackupEndpoint>* endpoints : {&backup.writers, &backup.readers})
+    {
+        for (BackupEndpoint& endpoint : *endpoints)
+        {
+            changes_map[endpoint.change->instanceHandle] = endpoint.change.release();
+        }
+    }
+
+    DiscoveryDataBase restored_db(server_prefix_, {});
+    ASSERT_TRUE(restored_db.from_backup(backup, changes_map));
+    EXPECT_EQ(contents, serialize(restored_db));
+
+    release(restored_db);
+    release(db);
+}
+
+TEST_F(DiscoveryDataBaseBackupTests, truncated_file)
+{
+    DiscoveryDataBase db(server_prefix_, {});
+    populate(db, 3);
+    std::vector<char> contents = serialize(db);
+    release(db);
+
+    contents.resize(contents.size() / 2);
+    ASSERT_TRUE(write_file(contents));
+
+    DiscoveryDataBaseBackup backup;
+    EXPECT_FALSE(read_backup_file(backup_file_name, backup));
+    EXPECT_TRUE(backup.participants.empty());
+    EXPECT_TRUE(backup.writers.empty());
+    EXPECT_TRUE(backup.readers.empty());
+}
+
+TEST_F(DiscoveryDataBaseBackupTests, corrupted_counts)
+{
+    // Counts larger than the file are rejected before allocating anything
+    for (uint32_t count : {0xFFFFFFFFu, 0x10000000u, 2u})
+    {
+        eprosima::fastcdr::FastBuffer buffer;
+        eprosima::fastcdr::Cdr cdr(buffer);
+        serialize_backup_header(cdr);
+        cdr.serialize(count);
+        std::vector<char> contents(buffer.getBuffer(), buffer.getBuffer() + cdr.getSerializedDataLength());
+        ASSERT_TRUE(write_file(contents));
+
+        DiscoveryDataBaseBackup backup;
+        EXPECT_FALSE(read_backup_file(backup_file_name, backup));
+        EXPECT_TRUE(backup.participants.empty());
+    }
+
+    // Wrong header
+    std::vector<char> contents(64, 0x7F);
+    ASSERT_TRUE(write_file(contents));
+    DiscoveryDataBaseBackup backup;
+    EXPECT_FALSE(read_backup_file(backup_file_name, backup));
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -661,6 +661,133 @@ TEST_F(NetworkTests, LocatorShrink)
     }
 }
 
+TEST_F(NetworkTests, LocatorMulticastFanout)
+{
+    NetworkFactory f;
+    UDPv4TransportDescriptor udpv4;
+    f.RegisterTransport(&udpv4);
+
+    Locator_t multicast;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.1.1", 7400, multicast);
+
+    // Five readers listening on the same multicast locator
+    std::vector<LocatorSelectorEntry> entries;
+    entries.reserve(5);
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        entries.emplace_back(1u, 1u);
+        entries.back().remote_guid.entityId.value[3] = static_cast<octet>(i + 1);
+        Locator_t unicast;
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "1.1.1.1", 7400, unicast);
+        IPLocator::setIPv4(unicast, 1, 1, 1, static_cast<octet>(i + 1));
+        entries.back().unicast.push_back(unicast);
+        entries.back().multicast.push_back(multicast);
+    }
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(5u));
+    for (LocatorSelectorEntry& entry : entries)
+    {
+        selector.add_entry(&entry);
+    }
+
+    // Sending to less than half of the readers uses their unicast locators
+    selector.reset(false);
+    selector.enable(entries[1].remote_guid);
+    selector.enable(entries[3].remote_guid);
+    f.select_locators(selector);
+    ASSERT_EQ(2u, selector.selected_size());
+    ASSERT_FALSE(selector.is_selected(multicast));
+    ASSERT_TRUE(selector.is_selected(entries[1].unicast[0]));
+    ASSERT_TRUE(selector.is_selected(entries[3].unicast[0]));
+
+    // Sending to at least half of the readers uses a single multicast datagram
+    selector.reset(false);
+    selector.enable(entries[0].remote_guid);
+    selector.enable(entries[2].remote_guid);
+    selector.enable(entries[4].remote_guid);
+    f.select_locators(selector);
+    ASSERT_EQ(1u, selector.selected_size());
+    ASSERT_TRUE(selector.is_selected(multicast));
+
+    // Sending to all the readers uses a single multicast datagram
+    selector.reset(true);
+    f.select_locators(selector);
+    ASSERT_EQ(1u, selector.selected_size());
+    ASSERT_TRUE(selector.is_selected(multicast));
+}
+
+static std::vector<Locator_t> selected_locators(
+        const LocatorSelector& selector)
+{
+    std::vector<Locator_t> ret;
+    selector.for_each([&ret](const Locator_t& locator)
+            {
+                ret.push_back(locator);
+            });
+    return ret;
+}
+
+TEST_F(NetworkTests, select_locators_reuses_the_selection_of_the_same_destinations)
+{
+    // Given
+    HELPER_RegisterTransportWithKindAndChannels(MockTransport::DefaultKind, 10);
+    const MockTransport* transport = MockTransport::mockTransportInstances.back();
+
+    std::vector<LocatorSelectorEntry> entries;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        entries.emplace_back(1u, 1u);
+        entries.back().remote_guid.entityId.value[3] = static_cast<octet>(i + 1);
+        Locator_t locator;
+        locator.kind = MockTransport::DefaultKind;
+        locator.port = 7400 + i;
+        entries.back().unicast.push_back(locator);
+    }
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(3u));
+    for (LocatorSelectorEntry& entry : entries)
+    {
+        selector.add_entry(&entry);
+    }
+
+    // When selecting all the destinations twice
+    selector.reset(true);
+    networkFactoryUnderTest.select_locators(selector);
+    std::vector<Locator_t> all_locators = selected_locators(selector);
+    selector.reset(false);
+    selector.enable(entries[1].remote_guid);
+    networkFactoryUnderTest.select_locators(selector);
+    std::vector<Locator_t> one_locator = selected_locators(selector);
+    selector.reset(true);
+    networkFactoryUnderTest.select_locators(selector);
+
+    // Then the transport is only asked once for each set of destinations
+    ASSERT_EQ(2u, transport->mockSelectLocatorsCalls);
+    ASSERT_EQ(3u, all_locators.size());
+    ASSERT_EQ(all_locators, selected_locators(selector));
+    ASSERT_EQ(1u, one_locator.size());
+    ASSERT_EQ(entries[1].unicast[0], one_locator[0]);
+
+    // When the locators of a destination change
+    entries[1].unicast[0].port = 7500;
+    selector.clear_selection_cache();
+    selector.reset(true);
+    networkFactoryUnderTest.select_locators(selector);
+
+    // Then the selection is performed again
+    ASSERT_EQ(3u, transport->mockSelectLocatorsCalls);
+    ASSERT_EQ(entries[1].unicast[0], selected_locators(selector)[1]);
+
+    // When a destination is removed
+    selector.remove_entry(entries[0].remote_guid);
+    selector.reset(true);
+    networkFactoryUnderTest.select_locators(selector);
+
+    // Then the selection is performed again
+    ASSERT_EQ(4u, transport->mockSelectLocatorsCalls);
+    ASSERT_EQ(2u, selected_locators(selector).size());
+}
+
 int main(
         int argc,
         char** argv)
@@ -130,6 +130,7 @@ LocatorList_t MockTransport::NormalizeLocator(const Locator_t& locator)
 
 void MockTransport::select_locators(LocatorSelector& selector) const
 {
+    ++mockSelectLocatorsCalls;
     ResourceLimitedVector<LocatorSelectorEntry*>& entries = selector.transport_starts();
     for (size_t i = 0; i < entries.size(); ++i)
     {
@@ -150,6 +150,9 @@ class MockTransport : public TransportInterface
         const static int DefaultMaxChannels = 10;
         int mockMaximumChannels;
 
+        // Number of times the selection algorithm has been run on this transport
+        mutable uint32_t mockSelectLocatorsCalls = 0;
+
         //Helper persistent handles
         static std::vector<MockTransport*> mockTransportInstances;
 };
@@ -14,6 +14,8 @@
 
 #include "mock/MockEvent.h"
 #include <fastrtps/rtps/resources/ResourceEvent.h>
+#include <future>
+#include <memory>
 #include <thread>
 #include <random>
 #include <gtest/gtest.h>
@@ -255,6 +257,43 @@ void cancel(
  * This function launches four threads. Two threads restart the event, and the other two
  * cancel it.
  */
+/*!
+ * @fn TEST(TimedEvent, Event_DeleteOthersFromCallback)
+ * @brief This test checks that a callback can delete other events of its service.
+ * This happens when the service is shared among participants, and it should neither block nor trigger the deleted
+ * events.
+ */
+TEST(TimedEvent, Event_DeleteOthersFromCallback)
+{
+    using TimedEvent = eprosima::fastrtps::rtps::TimedEvent;
+
+    std::atomic<int> others_triggered(0);
+    auto other_callback = [&others_triggered]()
+            {
+                ++others_triggered;
+                return false;
+            };
+    std::unique_ptr<TimedEvent> before(new TimedEvent(*env->service_, other_callback, 50));
+    std::unique_ptr<TimedEvent> after(new TimedEvent(*env->service_, other_callback, 50));
+
+    std::promise<void> deleted;
+    TimedEvent deleter(*env->service_, [&]()
+            {
+                before.reset();
+                after.reset();
+                deleted.set_value();
+                return false;
+            }, 50);
+
+    // The three events expire together, so the deleter may run before, after or between the others
+    before->restart_timer();
+    deleter.restart_timer();
+    after->restart_timer();
+
+    ASSERT_EQ(std::future_status::ready, deleted.get_future().wait_for(std::chrono::seconds(5)));
+    EXPECT_LE(others_triggered.load(), 2);
+}
+
 TEST(TimedEventMultithread, Event_TwoStartTwoCancel)
 {
     std::thread* thr1 = nullptr, * thr2 = nullptr,
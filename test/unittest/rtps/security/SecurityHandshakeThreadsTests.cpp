@@ -0,0 +1,349 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SecurityTests.hpp"
+
+#include <rtps/security/HandshakeWorkerPool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+class SecurityHandshakeThreadsTest : public SecurityTest
+{
+    protected:
+
+        SecurityHandshakeThreadsTest()
+        {
+            // Process the handshakes on a worker thread
+            participant_properties_.properties().back().value() = "1";
+        }
+
+        void fill_other_participant_key(
+                GUID_t& participant_key)
+        {
+            fill_participant_key(participant_key);
+            participant_key.guidPrefix.value[11] = 13;
+        }
+
+        // Handshake request sent by a remote participant
+        CacheChange_t* request_message_change(
+                const GUID_t& remote_participant_key)
+        {
+            ParticipantGenericMessage message;
+            message.message_identity().source_guid(remote_participant_key);
+            message.destination_participant_key(guid);
+            message.message_class_id("dds.sec.auth");
+            HandshakeMessageToken token;
+            message.message_data().push_back(token);
+            CacheChange_t* change =
+                    new CacheChange_t(static_cast<uint32_t>(ParticipantGenericMessageHelper::serialized_size(message))
+                            + 4 /*encapsulation*/);
+            CDRMessage_t aux_msg(0);
+            aux_msg.wraps = true;
+            aux_msg.buffer = change->serializedPayload.data;
+            aux_msg.max_size = change->serializedPayload.max_size;
+
+            // Serialize encapsulation
+            CDRMessage::addOctet(&aux_msg, 0);
+            aux_msg.msg_endian = DEFAULT_ENDIAN;
+            change->serializedPayload.encapsulation = PL_DEFAULT_ENCAPSULATION;
+            CDRMessage::addOctet(&aux_msg, DEFAULT_ENCAPSULATION);
+            CDRMessage::addUInt16(&aux_msg, 0);
+
+            EXPECT_TRUE(CDRMessage::addParticipantGenericMessage(&aux_msg, message));
+            change->serializedPayload.length = aux_msg.length;
+            return change;
+        }
+
+        void receive(
+                CacheChange_t* change)
+        {
+            EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
+            WillOnce(Return(true));
+            stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
+        }
+
+};
+
+TEST_F(SecurityHandshakeThreadsTest, handshake_reply_on_worker_thread)
+{
+    initialization_ok();
+
+    EXPECT_CALL(*auth_plugin_, validate_remote_identity_rvr(_, Ref(local_identity_handle_), _, _, _)).Times(1).
+    WillOnce(DoAll(SetArgPointee<0>(&remote_identity_handle_),
+            Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+
+    fill_participant_key(participant_data_.m_guid);
+    ASSERT_TRUE(manager_.discovered_participant(participant_data_));
+
+    HandshakeMessageToken handshake_message;
+    CacheChange_t* reply_change = new CacheChange_t(200);
+    std::thread::id step_thread;
+
+    EXPECT_CALL(*auth_plugin_, begin_handshake_reply_rvr(_, _, _, Ref(remote_identity_handle_),
+            Ref(local_identity_handle_), _, _)).Times(1).
+    WillOnce(DoAll(InvokeWithoutArgs([&step_thread]()
+            {
+                step_thread = std::this_thread::get_id();
+            }),
+            SetArgPointee<0>(&handshake_handle_),
+            SetArgPointee<1>(&handshake_message), Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+    EXPECT_CALL(*stateless_writer_, new_change(_, _, _)).Times(1).
+    WillOnce(Return(reply_change));
+    EXPECT_CALL(*stateless_writer_->history_, add_change_mock(reply_change)).Times(1).
+    WillOnce(Return(true));
+    EXPECT_CALL(participant_, pdpsimple()).Times(1).WillOnce(Return(&pdpsimple_));
+    EXPECT_CALL(pdpsimple_, get_participant_proxy_data_serialized(BIGEND)).Times(1);
+
+    receive(request_message_change(participant_data_.m_guid));
+    stateless_writer_->history_->wait_for_more_samples_than(0);
+
+    EXPECT_NE(std::this_thread::get_id(), step_thread);
+
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&local_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&remote_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_handshake_handle(&handshake_handle_, _)).Times(1).
+    WillOnce(Return(true));
+
+    manager_.destroy();
+
+    delete reply_change;
+}
+
+TEST_F(SecurityHandshakeThreadsTest, deferred_message_processed_after_step)
+{
+    initialization_ok();
+
+    EXPECT_CALL(*auth_plugin_, validate_remote_identity_rvr(_, Ref(local_identity_handle_), _, _, _)).Times(1).
+    WillOnce(DoAll(SetArgPointee<0>(&remote_identity_handle_),
+            Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+
+    fill_participant_key(participant_data_.m_guid);
+    ASSERT_TRUE(manager_.discovered_participant(participant_data_));
+
+    HandshakeMessageToken handshake_message;
+    CacheChange_t* reply_change = new CacheChange_t(200);
+    std::promise<void> step_started;
+    std::promise<void> step_released;
+    std::shared_future<void> release = step_released.get_future().share();
+    std::thread::id step_thread;
+    std::thread::id resend_thread;
+
+    EXPECT_CALL(*auth_plugin_, begin_handshake_reply_rvr(_, _, _, Ref(remote_identity_handle_),
+            Ref(local_identity_handle_), _, _)).Times(1).
+    WillOnce(DoAll(InvokeWithoutArgs([&step_started, &step_thread, release]()
+            {
+                step_thread = std::this_thread::get_id();
+                step_started.set_value();
+                release.wait();
+            }),
+            SetArgPointee<0>(&handshake_handle_),
+            SetArgPointee<1>(&handshake_message), Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+    EXPECT_CALL(*stateless_writer_, new_change(_, _, _)).Times(1).
+    WillOnce(Return(reply_change));
+    EXPECT_CALL(participant_, pdpsimple()).Times(1).WillOnce(Return(&pdpsimple_));
+    EXPECT_CALL(pdpsimple_, get_participant_proxy_data_serialized(BIGEND)).Times(1);
+
+    // The request is resent while the reply is being computed. It is processed when the step finishes, so the
+    // reply is sent again by the same worker, instead of waiting for the resend timer.
+    EXPECT_CALL(*stateless_writer_->history_, add_change_mock(reply_change)).Times(2).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*stateless_writer_->history_, remove_change_and_reuse(_)).Times(1).
+    WillOnce(DoAll(InvokeWithoutArgs([&resend_thread]()
+            {
+                resend_thread = std::this_thread::get_id();
+            }),
+            Return(reply_change)));
+
+    receive(request_message_change(participant_data_.m_guid));
+    step_started.get_future().wait();
+    receive(request_message_change(participant_data_.m_guid));
+    step_released.set_value();
+
+    stateless_writer_->history_->wait_for_more_samples_than(1);
+    EXPECT_EQ(step_thread, resend_thread);
+
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&local_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&remote_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_handshake_handle(&handshake_handle_, _)).Times(1).
+    WillOnce(Return(true));
+
+    manager_.destroy();
+
+    delete reply_change;
+}
+
+TEST_F(SecurityHandshakeThreadsTest, stop_cancels_queued_steps_and_drops_deferred_messages)
+{
+    initialization_ok();
+
+    MockIdentityHandle other_identity_handle;
+    ParticipantProxyData other_participant_data(c_default_RTPSParticipantAllocationAttributes);
+
+    EXPECT_CALL(*auth_plugin_, validate_remote_identity_rvr(_, Ref(local_identity_handle_), _, _, _)).Times(2).
+    WillOnce(DoAll(SetArgPointee<0>(&remote_identity_handle_),
+            Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE))).
+    WillOnce(DoAll(SetArgPointee<0>(&other_identity_handle),
+            Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+
+    fill_participant_key(participant_data_.m_guid);
+    ASSERT_TRUE(manager_.discovered_participant(participant_data_));
+    fill_other_participant_key(other_participant_data.m_guid);
+    ASSERT_TRUE(manager_.discovered_participant(other_participant_data));
+
+    HandshakeMessageToken handshake_message;
+    CacheChange_t* reply_change = new CacheChange_t(200);
+    std::promise<void> step_started;
+    std::promise<void> step_released;
+    std::shared_future<void> release = step_released.get_future().share();
+
+    EXPECT_CALL(*auth_plugin_, begin_handshake_reply_rvr(_, _, _, Ref(remote_identity_handle_),
+            Ref(local_identity_handle_), _, _)).Times(1).
+    WillOnce(DoAll(InvokeWithoutArgs([&step_started, release]()
+            {
+                step_started.set_value();
+                release.wait();
+            }),
+            SetArgPointee<0>(&handshake_handle_),
+            SetArgPointee<1>(&handshake_message), Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_MESSAGE)));
+    EXPECT_CALL(*stateless_writer_, new_change(_, _, _)).Times(1).
+    WillOnce(Return(reply_change));
+    EXPECT_CALL(*stateless_writer_->history_, add_change_mock(reply_change)).Times(1).
+    WillOnce(Return(true));
+    EXPECT_CALL(participant_, pdpsimple()).Times(1).WillOnce(Return(&pdpsimple_));
+    EXPECT_CALL(pdpsimple_, get_participant_proxy_data_serialized(BIGEND)).Times(1);
+
+    // The queued step of the other participant is cancelled, and the deferred request is not processed
+    EXPECT_CALL(*auth_plugin_, begin_handshake_reply_rvr(_, _, _, Ref(other_identity_handle),
+            Ref(local_identity_handle_), _, _)).Times(0);
+    EXPECT_CALL(*stateless_writer_->history_, remove_change_and_reuse(_)).Times(0);
+
+    receive(request_message_change(participant_data_.m_guid));
+    step_started.get_future().wait();
+    receive(request_message_change(other_participant_data.m_guid));
+    receive(request_message_change(participant_data_.m_guid));
+
+    std::thread stopping_thread([this]()
+            {
+                manager_.stop_handshake_workers();
+            });
+    // Let the queued step be cancelled before the running one finishes
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    step_released.set_value();
+    stopping_thread.join();
+
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&local_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&remote_identity_handle_, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&other_identity_handle, _)).Times(1).
+    WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_handshake_handle(&handshake_handle_, _)).Times(1).
+    WillOnce(Return(true));
+
+    manager_.destroy();
+
+    delete reply_change;
+}
+
+TEST(HandshakeWorkers, participants_share_process_pool)
+{
+    std::shared_ptr<HandshakeWorkers> first = std::make_shared<HandshakeWorkers>();
+    std::shared_ptr<HandshakeWorkers> second = std::make_shared<HandshakeWorkers>();
+    first->start(2);
+    second->start(3);
+
+    // The pool is created by the first participant
+    ASSERT_NE(nullptr, first->pool());
+    EXPECT_EQ(first->pool(), second->pool());
+    EXPECT_EQ(2u, first->pool()->num_threads());
+
+    // And released with the last one
+    first.reset();
+    second.reset();
+    HandshakeWorkers third;
+    third.start(3);
+    ASSERT_NE(nullptr, third.pool());
+    EXPECT_EQ(3u, third.pool()->num_threads());
+
+    // Participants processing the handshakes on the receiving thread do not use it
+    HandshakeWorkers synchronous;
+    synchronous.start(0);
+    EXPECT_EQ(nullptr, synchronous.pool());
+    EXPECT_FALSE(synchronous.post([](bool)
+            {
+            }));
+}
+
+TEST(HandshakeWorkers, stop_only_cancels_own_jobs)
+{
+    HandshakeWorkers stopped;
+    HandshakeWorkers other;
+    stopped.start(1);
+    other.start(1);
+
+    std::promise<void> job_started;
+    std::promise<void> job_released;
+    std::shared_future<void> release = job_released.get_future().share();
+    std::atomic<bool> first_cancelled{true};
+    std::atomic<bool> second_cancelled{false};
+    std::atomic<bool> other_cancelled{true};
+    std::promise<void> other_done;
+
+    ASSERT_TRUE(stopped.post([&](bool cancelled)
+            {
+                first_cancelled = cancelled;
+                job_started.set_value();
+                release.wait();
+            }));
+    job_started.get_future().wait();
+    ASSERT_TRUE(stopped.post([&](bool cancelled)
+            {
+                second_cancelled = cancelled;
+            }));
+    ASSERT_TRUE(other.post([&](bool cancelled)
+            {
+                other_cancelled = cancelled;
+                other_done.set_value();
+            }));
+
+    std::thread stopping_thread([&stopped]()
+            {
+                stopped.stop();
+            });
+    // Queued jobs are taken as soon as stopping is flagged
+    while (!stopped.stopping())
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(stopped.post([](bool)
+            {
+            }));
+    job_released.set_value();
+    stopping_thread.join();
+
+    EXPECT_FALSE(first_cancelled);
+    EXPECT_TRUE(second_cancelled);
+
+    // The jobs of other participants still run
+    other_done.get_future().wait();
+    EXPECT_FALSE(other_cancelled);
+    EXPECT_FALSE(other.stopping());
+}
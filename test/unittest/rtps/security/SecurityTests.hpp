@@ -125,7 +125,11 @@ class SecurityTest : public ::testing::Test
         stateless_writer_(nullptr), stateless_reader_(nullptr),
         volatile_writer_(nullptr), volatile_reader_(nullptr),
         manager_(&participant_), participant_data_(c_default_RTPSParticipantAllocationAttributes),
-        default_cdr_message(RTPSMESSAGE_DEFAULT_SIZE){}
+        default_cdr_message(RTPSMESSAGE_DEFAULT_SIZE)
+        {
+            // Process handshakes on the calling thread, so expectations can be checked right after each message
+            participant_properties_.properties().emplace_back("dds.sec.auth.handshake_threads", "0");
+        }
 
         ~SecurityTest()
         {
@@ -15,10 +15,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastrtps/rtps/writer/LivelinessManager.h>
 #include <fastrtps/rtps/resources/ResourceEvent.h>
 #include <fastrtps/rtps/common/Time_t.h>
 #include <asio.hpp>
+#include <atomic>
 #include <thread>
 #include <condition_variable>
 #include <gtest/gtest.h>
@@ -412,6 +415,53 @@ TEST_F(LivelinessManagerTests, TimerExpired_ManualByTopic)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that the assert_liveliness() method that takes a participant only asserts the writers of that participant
+TEST_F(LivelinessManagerTests, AssertLivelinessByParticipant)
+{
+    LivelinessManager liveliness_manager(
+                nullptr,
+                service_);
+
+    GuidPrefix_t guidP1;
+    guidP1.value[0] = 1;
+    GuidPrefix_t guidP2;
+    guidP2.value[0] = 2;
+
+    liveliness_manager.add_writer(GUID_t(guidP1, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(10));
+    liveliness_manager.add_writer(GUID_t(guidP2, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(10));
+    liveliness_manager.add_writer(GUID_t(guidP1, 2), MANUAL_BY_PARTICIPANT_LIVELINESS_QOS, Duration_t(10));
+    liveliness_manager.add_writer(GUID_t(guidP2, 2), MANUAL_BY_PARTICIPANT_LIVELINESS_QOS, Duration_t(1));
+
+    // Assert liveliness of automatic writers of the first participant
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(AUTOMATIC_LIVELINESS_QOS, guidP1));
+    auto liveliness_data = liveliness_manager.get_liveliness_data();
+    EXPECT_EQ(liveliness_data[0].status, LivelinessData::WriterStatus::ALIVE);
+    EXPECT_EQ(liveliness_data[1].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_EQ(liveliness_data[2].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_EQ(liveliness_data[3].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_TRUE(liveliness_manager.is_any_alive(AUTOMATIC_LIVELINESS_QOS));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS));
+
+    // Assert liveliness of manual by participant writers of the second participant
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS, guidP2));
+    liveliness_data = liveliness_manager.get_liveliness_data();
+    EXPECT_EQ(liveliness_data[0].status, LivelinessData::WriterStatus::ALIVE);
+    EXPECT_EQ(liveliness_data[1].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_EQ(liveliness_data[2].status, LivelinessData::WriterStatus::NOT_ASSERTED);
+    EXPECT_EQ(liveliness_data[3].status, LivelinessData::WriterStatus::ALIVE);
+    EXPECT_TRUE(liveliness_manager.is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS));
+
+    // Removing a writer keeps the rest of the writers indexed
+    EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP1, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(10)));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(AUTOMATIC_LIVELINESS_QOS));
+    EXPECT_TRUE(liveliness_manager.assert_liveliness(GUID_t(guidP2, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(10)));
+    EXPECT_TRUE(liveliness_manager.is_any_alive(AUTOMATIC_LIVELINESS_QOS));
+    EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP2, 2), MANUAL_BY_PARTICIPANT_LIVELINESS_QOS,
+            Duration_t(1)));
+    EXPECT_FALSE(liveliness_manager.is_any_alive(MANUAL_BY_PARTICIPANT_LIVELINESS_QOS));
+    EXPECT_EQ(liveliness_manager.get_liveliness_data().size(), 2u);
+}
+
 //! Tests that the timer owner is calculated correctly
 //! This is tested indirectly by checking which writer lost liveliness last
 TEST_F(LivelinessManagerTests, TimerOwnerCalculation)
@@ -478,6 +528,69 @@ TEST_F(LivelinessManagerTests, TimerOwnerRemoved)
     EXPECT_EQ(num_writers_lost, 1u);
 }
 
+//! Tests that removing the last alive writer, which is the timer owner, stops the timer
+TEST_F(LivelinessManagerTests, LastAliveWriterRemoved)
+{
+    std::atomic_bool error_logged(false);
+
+    class ErrorLogConsumer : public eprosima::fastdds::dds::LogConsumer
+    {
+    public:
+
+        ErrorLogConsumer(
+                std::atomic_bool* error_logged)
+            : error_logged_(error_logged)
+        {
+        }
+
+        void Consume(
+                const eprosima::fastdds::dds::Log::Entry& entry) override
+        {
+            if (eprosima::fastdds::dds::Log::Kind::Error == entry.kind)
+            {
+                error_logged_->store(true);
+            }
+        }
+
+        std::atomic_bool* error_logged_;
+    };
+    eprosima::fastdds::dds::Log::ClearConsumers();
+    eprosima::fastdds::dds::Log::RegisterConsumer(
+        std::unique_ptr<eprosima::fastdds::dds::LogConsumer>(new ErrorLogConsumer(&error_logged)));
+
+    {
+        LivelinessManager liveliness_manager(
+                    std::bind(&LivelinessManagerTests::liveliness_changed,
+                              this,
+                              std::placeholders::_1,
+                              std::placeholders::_2,
+                              std::placeholders::_3,
+                              std::placeholders::_4,
+                              std::placeholders::_5),
+                    service_);
+
+        GuidPrefix_t guidP;
+        guidP.value[0] = 1;
+
+        liveliness_manager.add_writer(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1));
+        liveliness_manager.add_writer(GUID_t(guidP, 2), MANUAL_BY_TOPIC_LIVELINESS_QOS, Duration_t(0.1));
+
+        // Only the first writer is alive, so it is the timer owner
+        liveliness_manager.assert_liveliness(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1));
+        EXPECT_TRUE(liveliness_manager.remove_writer(GUID_t(guidP, 1), AUTOMATIC_LIVELINESS_QOS, Duration_t(0.1)));
+
+        // Let the lease duration go by
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        EXPECT_EQ(num_writers_lost, 0u);
+    }
+
+    eprosima::fastdds::dds::Log::Flush();
+    EXPECT_FALSE(error_logged.load());
+    eprosima::fastdds::dds::Log::ClearConsumers();
+    eprosima::fastdds::dds::Log::RegisterConsumer(
+        std::unique_ptr<eprosima::fastdds::dds::LogConsumer>(new eprosima::fastdds::dds::StdoutConsumer()));
+}
+
 }
 }
 
@@ -12,14 +12,21 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <future>
+#include <thread>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/builtin/data/ReaderProxyData.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/rtps/writer/WriterListener.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 #include <fastdds/rtps/history/WriterHistory.h>
+#include <fastrtps/utils/IPLocator.h>
 
 
 namespace eprosima {
@@ -171,6 +178,202 @@ TEST(RTPSWriterTests, WriterWithCustomPayloadPool_DoesNotInitializePool_WhenDyna
     pool_initialization_test(DYNAMIC_REUSABLE_MEMORY_MODE);
 }
 
+class ReceivedByAllListener : public WriterListener
+{
+public:
+
+    void onWriterChangeReceivedByAll(
+            RTPSWriter* /*writer*/,
+            CacheChange_t* change) override
+    {
+        received_by_all.push_back(change->sequenceNumber);
+    }
+
+    std::vector<SequenceNumber_t> received_by_all;
+};
+
+/*!
+ * Reliable writer with several remote readers, which only acknowledge changes when told to.
+ */
+class AcknackTest : public testing::Test
+{
+protected:
+
+    static constexpr uint32_t num_readers = 3;
+    static constexpr uint32_t num_changes = 2;
+
+    void SetUp() override
+    {
+        RTPSParticipantAttributes p_attr;
+        participant = RTPSDomain::createParticipant(0, true, p_attr);
+        ASSERT_NE(participant, nullptr);
+
+        HistoryAttributes h_attr;
+        history = new WriterHistory(h_attr);
+
+        WriterAttributes w_attr;
+        w_attr.endpoint.reliabilityKind = RELIABLE;
+        w_attr.endpoint.durabilityKind = TRANSIENT_LOCAL;
+        writer = RTPSDomain::createRTPSWriter(participant, w_attr, history, &listener);
+        ASSERT_NE(writer, nullptr);
+
+        // Nobody listens on this locator, so the readers never acknowledge anything by themselves
+        Locator_t locator;
+        IPLocator::setIPv4(locator, 127, 0, 0, 1);
+        locator.port = 7399;
+
+        for (uint32_t i = 0; i < num_readers; ++i)
+        {
+            ReaderProxyData reader_data(4u, 1u);
+            reader_data.add_unicast_locator(locator);
+            reader_data.m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+            reader_data.guid().guidPrefix.value[0] = 1;
+            reader_data.guid().guidPrefix.value[1] = static_cast<octet>(i);
+            reader_data.guid().entityId = EntityId_t(0x00000104);
+            ASSERT_TRUE(writer->matched_reader_add(reader_data));
+            readers.push_back(reader_data.guid());
+        }
+        ack_counts.assign(num_readers, 0u);
+
+        for (uint32_t i = 0; i < num_changes; ++i)
+        {
+            CacheChange_t* change = writer->new_change(ALIVE);
+            ASSERT_NE(change, nullptr);
+            change->serializedPayload.length = 16;
+            ASSERT_TRUE(history->add_change(change));
+        }
+    }
+
+    void TearDown() override
+    {
+        if (writer != nullptr)
+        {
+            RTPSDomain::removeRTPSWriter(writer);
+        }
+        if (participant != nullptr)
+        {
+            RTPSDomain::removeRTPSParticipant(participant);
+        }
+        delete history;
+    }
+
+    //! Make a reader acknowledge all the changes before a sequence number
+    void acknack(
+            uint32_t reader,
+            uint32_t base)
+    {
+        bool result = false;
+        SequenceNumberSet_t sn_set(SequenceNumber_t(0, base));
+        ASSERT_TRUE(writer->process_acknack(writer->getGuid(), readers[reader], ++ack_counts[reader], sn_set, true,
+                result));
+        ASSERT_TRUE(result);
+    }
+
+    RTPSParticipant* participant = nullptr;
+    WriterHistory* history = nullptr;
+    RTPSWriter* writer = nullptr;
+    ReceivedByAllListener listener;
+    std::vector<GUID_t> readers;
+    std::vector<uint32_t> ack_counts;
+};
+
+/*!
+ * Readers holding the lowest acknowledged sequence number advance one by one. A change is notified as received by
+ * all exactly when the last of them advances.
+ */
+TEST_F(AcknackTest, ReadersAtMinimumAdvanceOneByOne)
+{
+    std::vector<SequenceNumber_t> first_acked{SequenceNumber_t(0, 1)};
+    std::vector<SequenceNumber_t> all_acked{SequenceNumber_t(0, 1), SequenceNumber_t(0, 2)};
+
+    // All the readers start at the minimum, and acknowledge the first change
+    for (uint32_t i = 0; i < num_readers - 1; ++i)
+    {
+        acknack(i, 2);
+        EXPECT_TRUE(listener.received_by_all.empty());
+    }
+    acknack(num_readers - 1, 2);
+    EXPECT_EQ(first_acked, listener.received_by_all);
+    EXPECT_FALSE(writer->wait_for_all_acked(Duration_t(0, 0)));
+
+    // Acknowledging the last change, even repeatedly, notifies nothing until the last reader does it
+    acknack(0, 3);
+    acknack(0, 3);
+    acknack(1, 3);
+    EXPECT_EQ(first_acked, listener.received_by_all);
+
+    acknack(num_readers - 1, 3);
+    EXPECT_EQ(all_acked, listener.received_by_all);
+    EXPECT_TRUE(writer->wait_for_all_acked(Duration_t(0, 0)));
+}
+
+/*!
+ * Acknacks received in the same message are processed as a batch. Changes are only notified as received by all once
+ * the batch ends.
+ */
+TEST_F(AcknackTest, AcknacksInSameMessage)
+{
+    std::vector<SequenceNumber_t> first_acked{SequenceNumber_t(0, 1)};
+    std::vector<SequenceNumber_t> all_acked{SequenceNumber_t(0, 1), SequenceNumber_t(0, 2)};
+
+    writer->begin_acknack_batch();
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        acknack(i, 2);
+    }
+    EXPECT_TRUE(listener.received_by_all.empty());
+    writer->end_acknack_batch();
+    EXPECT_EQ(first_acked, listener.received_by_all);
+
+    // Readers acknowledging all the changes are checked once for the whole batch
+    writer->begin_acknack_batch();
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        acknack(i, 3);
+    }
+    EXPECT_EQ(first_acked, listener.received_by_all);
+    writer->end_acknack_batch();
+    EXPECT_EQ(all_acked, listener.received_by_all);
+    EXPECT_TRUE(writer->wait_for_all_acked(Duration_t(0, 0)));
+}
+
+/*!
+ * A batch of acknacks only defers the work of the acknacks processed by its own thread, so a batch open on another
+ * thread does not postpone it.
+ */
+TEST_F(AcknackTest, ConcurrentBatchesDoNotDeferEachOther)
+{
+    std::vector<SequenceNumber_t> all_acked{SequenceNumber_t(0, 1), SequenceNumber_t(0, 2)};
+
+    std::promise<void> batch_begun;
+    std::promise<void> may_end_batch;
+    std::thread other_receiver([&]()
+            {
+                writer->begin_acknack_batch();
+                batch_begun.set_value();
+                may_end_batch.get_future().wait();
+                writer->end_acknack_batch();
+            });
+    batch_begun.get_future().wait();
+
+    writer->begin_acknack_batch();
+    for (uint32_t i = 0; i < num_readers; ++i)
+    {
+        acknack(i, 3);
+    }
+    EXPECT_TRUE(listener.received_by_all.empty());
+    writer->end_acknack_batch();
+    EXPECT_EQ(all_acked, listener.received_by_all);
+
+    // Acknacks outside any batch are not deferred either
+    acknack(0, 3);
+    EXPECT_TRUE(writer->wait_for_all_acked(Duration_t(0, 0)));
+
+    may_end_batch.set_value();
+    other_receiver.join();
+    EXPECT_EQ(all_acked, listener.received_by_all);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
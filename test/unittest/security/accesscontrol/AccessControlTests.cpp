@@ -448,6 +448,56 @@ TEST_F(AccessControlTest, validate_partition_access_ok_on_permission_wildcards)
     check_remote_datawriter(publisher_participant_attr, true);
 }
 
+TEST_F(AccessControlTest, validate_repeated_checks_on_same_handle)
+{
+    RTPSParticipantAttributes subscriber_participant_attr;
+    fill_subscriber_participant_security_attributes(subscriber_participant_attr);
+
+    PermissionsHandle* access_handle;
+    get_access_handle(subscriber_participant_attr, &access_handle);
+
+    ReaderProxyData allowed_reader(1, 1);
+    allowed_reader.topicName(eprosima::fastrtps::string_255("HelloWorldTopic_multiple_partition"));
+    allowed_reader.m_qos.m_partition.push_back("Partition1");
+
+    ReaderProxyData denied_reader(1, 1);
+    denied_reader.topicName(eprosima::fastrtps::string_255("HelloWorldTopic_multiple_partition"));
+    denied_reader.m_qos.m_partition.push_back("Partition5");
+
+    std::string denied_message;
+
+    // Second round is answered with the decisions of the first one.
+    for (int round = 0; round < 2; ++round)
+    {
+        SecurityException exception;
+        bool relay_only = true;
+        ASSERT_TRUE(access_plugin.check_remote_datareader(*access_handle, domain_id, allowed_reader, relay_only,
+                exception)) << exception.what();
+        ASSERT_FALSE(relay_only);
+
+        SecurityException denied_exception;
+        ASSERT_FALSE(access_plugin.check_remote_datareader(*access_handle, domain_id, denied_reader, relay_only,
+                denied_exception));
+        ASSERT_NE(0u, strlen(denied_exception.what()));
+        if (round == 0)
+        {
+            denied_message = denied_exception.what();
+        }
+        else
+        {
+            ASSERT_EQ(denied_message, denied_exception.what());
+        }
+
+        ASSERT_FALSE(access_plugin.check_create_datareader(*access_handle, domain_id,
+                "HelloWorldTopic_multiple_partition", {"Partition5"}, exception));
+        ASSERT_TRUE(access_plugin.check_create_datareader(*access_handle, domain_id,
+                "HelloWorldTopic_multiple_partition", {"Partition1", "Partition2"}, exception)) << exception.what();
+    }
+
+    SecurityException exception;
+    ASSERT_TRUE(access_plugin.return_permissions_handle(access_handle, exception)) << exception.what();
+}
+
 int main(
         int argc,
         char** argv)
@@ -20,6 +20,7 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <MockReceiverResource.h>
 #include "../../../src/cpp/rtps/transport/TCPSenderResource.hpp"
+#include "../../../src/cpp/rtps/transport/tcp/TCPReceiveBuffer.hpp"
 
 #include <memory>
 #include <asio.hpp>
@@ -28,6 +29,8 @@
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
+using TCPReceiveBuffer = eprosima::fastdds::rtps::TCPReceiveBuffer;
+using TCPHeader = eprosima::fastdds::rtps::TCPHeader;
 
 #if defined(_WIN32)
 #define GET_PID _getpid
@@ -227,8 +230,181 @@ TEST_F(TCPv4Tests, send_and_receive_between_ports)
     senderThread->join();
     sem.wait();
 }
+
+TEST_F(TCPv4Tests, send_and_receive_between_ports_with_async_io)
+{
+    TCPv4TransportDescriptor recvDescriptor;
+    recvDescriptor.add_listener_port(g_default_port);
+    recvDescriptor.async_io_threads = 2;
+    TCPv4Transport receiveTransportUnderTest(recvDescriptor);
+    receiveTransportUnderTest.init();
+
+    TCPv4TransportDescriptor sendDescriptor;
+    sendDescriptor.async_io_threads = 2;
+    TCPv4Transport sendTransportUnderTest(sendDescriptor);
+    sendTransportUnderTest.init();
+
+    Locator_t inputLocator;
+    inputLocator.kind = LOCATOR_KIND_TCPv4;
+    inputLocator.port = g_default_port;
+    IPLocator::setIPv4(inputLocator, 127, 0, 0, 1);
+    IPLocator::setLogicalPort(inputLocator, 7410);
+
+    LocatorList_t locator_list;
+    locator_list.push_back(inputLocator);
+
+    Locator_t outputLocator;
+    outputLocator.kind = LOCATOR_KIND_TCPv4;
+    IPLocator::setIPv4(outputLocator, 127, 0, 0, 1);
+    outputLocator.port = g_default_port;
+    IPLocator::setLogicalPort(outputLocator, 7410);
+
+    MockReceiverResource receiver(receiveTransportUnderTest, inputLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+    ASSERT_TRUE(receiveTransportUnderTest.IsInputChannelOpen(inputLocator));
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(sendTransportUnderTest.OpenOutputChannel(send_resource_list, outputLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    octet message[5] = { 'H','e','l','l','o' };
+
+    // Several messages sent back to back may be coalesced on the same write and parsed from the same read
+    const uint32_t num_messages = 10;
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message, msg_recv->data, 5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    auto send = [&]()
+    {
+        Locators input_begin(locator_list.begin());
+        Locators input_end(locator_list.end());
+        return send_resource_list.at(0)->send(message, 5, &input_begin, &input_end,
+                       (std::chrono::steady_clock::now()+ std::chrono::microseconds(100)));
+    };
+
+    while (!send())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    for (uint32_t i = 1; i < num_messages; ++i)
+    {
+        EXPECT_TRUE(send());
+    }
+
+    for (uint32_t i = 0; i < num_messages; ++i)
+    {
+        sem.wait();
+    }
+}
 #endif
 
+TEST(TCPReceiveBufferTests, takes_several_frames_from_a_single_read)
+{
+    TCPReceiveBuffer buffer(100);
+    octet body[5] = { 'H','e','l','l','o' };
+
+    TCPHeader header;
+    header.length = static_cast<uint32_t>(TCPHeader::size() + sizeof(body));
+    for (int i = 0; i < 3; ++i)
+    {
+        memcpy(buffer.write_position(), header.address(), TCPHeader::size());
+        buffer.commit(TCPHeader::size());
+        memcpy(buffer.write_position(), body, sizeof(body));
+        buffer.commit(sizeof(body));
+    }
+
+    TCPHeader received_header;
+    octet* received_body = nullptr;
+    uint32_t body_size = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(TCPReceiveBuffer::Result::FRAME, buffer.next_frame(received_header, received_body, body_size));
+        EXPECT_EQ(sizeof(body), body_size);
+        EXPECT_EQ(0, memcmp(body, received_body, sizeof(body)));
+    }
+    EXPECT_EQ(TCPReceiveBuffer::Result::NEED_MORE_DATA, buffer.next_frame(received_header, received_body, body_size));
+}
+
+TEST(TCPReceiveBufferTests, keeps_incomplete_frames_for_next_read)
+{
+    TCPReceiveBuffer buffer(100);
+    octet body[5] = { 'H','e','l','l','o' };
+
+    TCPHeader header;
+    header.length = static_cast<uint32_t>(TCPHeader::size() + sizeof(body));
+    memcpy(buffer.write_position(), header.address(), TCPHeader::size());
+    buffer.commit(TCPHeader::size());
+    memcpy(buffer.write_position(), body, 2);
+    buffer.commit(2);
+
+    TCPHeader received_header;
+    octet* received_body = nullptr;
+    uint32_t body_size = 0;
+    EXPECT_EQ(TCPReceiveBuffer::Result::NEED_MORE_DATA, buffer.next_frame(received_header, received_body, body_size));
+    buffer.compact();
+
+    memcpy(buffer.write_position(), body + 2, sizeof(body) - 2);
+    buffer.commit(sizeof(body) - 2);
+    ASSERT_EQ(TCPReceiveBuffer::Result::FRAME, buffer.next_frame(received_header, received_body, body_size));
+    EXPECT_EQ(sizeof(body), body_size);
+    EXPECT_EQ(0, memcmp(body, received_body, sizeof(body)));
+}
+
+TEST(TCPReceiveBufferTests, skips_frames_bigger_than_max_size)
+{
+    TCPReceiveBuffer buffer(4);
+    octet body[5] = { 'H','e','l','l','o' };
+
+    TCPHeader big_header;
+    big_header.length = static_cast<uint32_t>(TCPHeader::size() + sizeof(body));
+    TCPHeader small_header;
+    small_header.length = static_cast<uint32_t>(TCPHeader::size() + 4);
+
+    memcpy(buffer.write_position(), big_header.address(), TCPHeader::size());
+    buffer.commit(TCPHeader::size());
+    memcpy(buffer.write_position(), body, 2);
+    buffer.commit(2);
+
+    TCPHeader received_header;
+    octet* received_body = nullptr;
+    uint32_t body_size = 0;
+    EXPECT_EQ(TCPReceiveBuffer::Result::NEED_MORE_DATA, buffer.next_frame(received_header, received_body, body_size));
+    EXPECT_EQ(1u, buffer.dropped_frames());
+    buffer.compact();
+
+    // The rest of the big frame is discarded as it arrives
+    memcpy(buffer.write_position(), body + 2, sizeof(body) - 2);
+    buffer.commit(sizeof(body) - 2);
+    memcpy(buffer.write_position(), small_header.address(), TCPHeader::size());
+    buffer.commit(TCPHeader::size());
+    memcpy(buffer.write_position(), body, 4);
+    buffer.commit(4);
+
+    ASSERT_EQ(TCPReceiveBuffer::Result::FRAME, buffer.next_frame(received_header, received_body, body_size));
+    EXPECT_EQ(4u, body_size);
+    EXPECT_EQ(0, memcmp(body, received_body, 4));
+}
+
+TEST(TCPReceiveBufferTests, rejects_invalid_headers)
+{
+    TCPReceiveBuffer buffer(100);
+
+    TCPHeader header;
+    header.rtcp[0] = 'X';
+    memcpy(buffer.write_position(), header.address(), TCPHeader::size());
+    buffer.commit(TCPHeader::size());
+
+    TCPHeader received_header;
+    octet* received_body = nullptr;
+    uint32_t body_size = 0;
+    EXPECT_EQ(TCPReceiveBuffer::Result::BAD_HEADER, buffer.next_frame(received_header, received_body, body_size));
+}
+
 TEST_F(TCPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
 {
     // Given
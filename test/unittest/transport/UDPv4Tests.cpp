@@ -231,6 +231,135 @@ TEST_F(UDPv4Tests, send_to_loopback)
     senderThread->join();
     sem.wait();
 }
+
+TEST_F(UDPv4Tests, send_gathered_buffers_to_loopback)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, 127, 0, 0, 1); // Loopback
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator)); // Includes loopback
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(multicastLocator));
+    octet message[10] = { 'H', 'e', 'l', 'l', 'o', 'W', 'o', 'r', 'l', 'd' };
+
+    // The message is sent in three slices, which should be received as a single datagram
+    std::vector<eprosima::fastdds::rtps::NetworkBuffer> buffers;
+    buffers.emplace_back(message, 2);
+    buffers.emplace_back(message + 2, 5);
+    buffers.emplace_back(message + 7, 3);
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(memcmp(message, msg_recv->data, 10), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+            {
+                LocatorList_t locator_list;
+                locator_list.push_back(multicastLocator);
+
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+
+                EXPECT_TRUE(send_resource_list.at(0)->send(buffers, 10, &locators_begin, &locators_end,
+                        (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+            };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    sem.wait();
+}
+
+TEST_F(UDPv4Tests, send_many_gathered_buffers_to_loopback)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(outputChannelLocator, 127, 0, 0, 1); // Loopback
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator)); // Includes loopback
+    ASSERT_FALSE(send_resource_list.empty());
+    ASSERT_TRUE(transportUnderTest.IsInputChannelOpen(multicastLocator));
+
+    // A message with 40 payloads of 1KB referenced between 41 slices of submessage headers, as sent by the
+    // message group, is more than the 64 buffers asio gathers in a single send
+    const uint32_t num_payloads = 40;
+    const uint32_t payload_size = 1024;
+    const uint32_t header_size = 8;
+    std::vector<octet> message((num_payloads * (header_size + payload_size)) + header_size);
+    for (size_t i = 0; i < message.size(); ++i)
+    {
+        message[i] = static_cast<octet>(i % 251);
+    }
+
+    std::vector<eprosima::fastdds::rtps::NetworkBuffer> buffers;
+    for (uint32_t i = 0; i < num_payloads; ++i)
+    {
+        buffers.emplace_back(&message[i * (header_size + payload_size)], header_size);
+        buffers.emplace_back(&message[i * (header_size + payload_size) + header_size], payload_size);
+    }
+    buffers.emplace_back(&message[num_payloads * (header_size + payload_size)], header_size);
+    ASSERT_GT(buffers.size(), 64u);
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+            {
+                EXPECT_EQ(message.size(), msg_recv->length);
+                EXPECT_EQ(memcmp(message.data(), msg_recv->data, message.size()), 0);
+                sem.post();
+            };
+
+    msg_recv->setCallback(recCallback);
+
+    auto sendThreadFunction = [&]()
+            {
+                LocatorList_t locator_list;
+                locator_list.push_back(multicastLocator);
+
+                Locators locators_begin(locator_list.begin());
+                Locators locators_end(locator_list.end());
+
+                EXPECT_TRUE(send_resource_list.at(0)->send(buffers, static_cast<uint32_t>(message.size()),
+                        &locators_begin, &locators_end,
+                        (std::chrono::steady_clock::now() + std::chrono::microseconds(100))));
+            };
+
+    senderThread.reset(new std::thread(sendThreadFunction));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    senderThread->join();
+    sem.wait();
+}
 #endif // ifndef __APPLE__
 
 TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
@@ -635,6 +764,39 @@ TEST_F(UDPv4Tests, open_a_blocked_socket)
     }
 }
 
+TEST_F(UDPv4Tests, local_addresses_are_cached)
+{
+    std::vector<IPFinder::info_IP> first_ips;
+    ASSERT_TRUE(IPFinder::getIPs(&first_ips, true));
+    uint32_t version = IPFinder::getInterfacesVersion();
+
+    // Enumerating again the same interfaces keeps the version, so transports do not update their interfaces.
+    IPFinder::invalidateIPs();
+    std::vector<IPFinder::info_IP> second_ips;
+    ASSERT_TRUE(IPFinder::getIPs(&second_ips, true));
+    ASSERT_EQ(version, IPFinder::getInterfacesVersion());
+    ASSERT_EQ(first_ips.size(), second_ips.size());
+    for (size_t i = 0; i < first_ips.size(); ++i)
+    {
+        EXPECT_EQ(first_ips[i].name, second_ips[i].name);
+        EXPECT_EQ(first_ips[i].dev, second_ips[i].dev);
+    }
+
+    // The cached addresses are the local ones of the transport
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+    for (const IPFinder::info_IP& ip : second_ips)
+    {
+        if (IPFinder::IP4 == ip.type || IPFinder::IP4_LOCAL == ip.type)
+        {
+            Locator_t locator;
+            locator.kind = LOCATOR_KIND_UDPv4;
+            IPLocator::setIPv4(locator, ip.name);
+            EXPECT_TRUE(transportUnderTest.is_local_locator(locator));
+        }
+    }
+}
+
 TEST_F(UDPv4Tests, simple_throughput)
 {
     const size_t sample_size = 1024;
@@ -76,6 +76,7 @@ void MockMessageReceiver::setCallback(std::function<void()> cb)
 void MockMessageReceiver::processCDRMsg(const Locator_t&, CDRMessage_t*msg)
 {
     data = msg->buffer;
+    length = msg->length;
     if (callback != nullptr)
     {
         callback();
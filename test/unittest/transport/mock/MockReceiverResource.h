@@ -44,6 +44,7 @@ public:
     void processCDRMsg(const Locator_t& loc, CDRMessage_t*msg) override;
     void setCallback(std::function<void()> cb);
     octet* data;
+    uint32_t length = 0;
     std::function<void()> callback;
 };
 
@@ -0,0 +1,140 @@
+// Copyright 2021 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/LockFreeFreeList.hpp>
+#include <gtest/gtest.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+TEST(LockFreeFreeListTests, push_pop)
+{
+    LockFreeFreeList<int> uut;
+    std::vector<int> values(200);
+
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(nullptr, uut.pop());
+
+    // Registered elements are not free until pushed
+    std::vector<LockFreeFreeList<int>::slot_type> slots;
+    for (int& value : values)
+    {
+        slots.push_back(uut.add(&value));
+        EXPECT_NE(LockFreeFreeList<int>::npos, slots.back());
+    }
+    EXPECT_TRUE(uut.empty());
+
+    for (auto slot : slots)
+    {
+        uut.push(slot);
+    }
+    EXPECT_EQ(values.size(), uut.size());
+
+    // Elements are taken in reverse order
+    for (size_t i = values.size(); i > 0; --i)
+    {
+        EXPECT_EQ(&values[i - 1], uut.pop());
+    }
+    EXPECT_TRUE(uut.empty());
+    EXPECT_EQ(nullptr, uut.pop());
+}
+
+TEST(LockFreeFreeListTests, remove_reuses_slot)
+{
+    LockFreeFreeList<int> uut;
+    int first = 0;
+    int second = 0;
+
+    auto slot = uut.add(&first);
+    uut.remove(slot);
+    EXPECT_EQ(slot, uut.add(&second));
+
+    uut.push(slot);
+    EXPECT_EQ(&second, uut.pop());
+}
+
+TEST(LockFreeFreeListTests, concurrent_push_pop)
+{
+    constexpr size_t num_elements = 64;
+    constexpr size_t num_threads = 8;
+    constexpr size_t num_operations = 20000;
+
+    LockFreeFreeList<int> uut;
+    std::vector<int> values(num_elements);
+    std::vector<LockFreeFreeList<int>::slot_type> slots;
+    for (int& value : values)
+    {
+        slots.push_back(uut.add(&value));
+        uut.push(slots.back());
+    }
+
+    // Every thread takes a few elements, checks nobody else is using them, and returns them
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    std::vector<int*> taken;
+                    for (size_t n = 0; n < num_operations; ++n)
+                    {
+                        int* value = uut.pop();
+                        if (nullptr != value)
+                        {
+                            EXPECT_EQ(0, (*value)++);
+                            taken.push_back(value);
+                        }
+
+                        if (taken.size() > 4 || (nullptr == value && !taken.empty()))
+                        {
+                            int* returned = taken.back();
+                            taken.pop_back();
+                            (*returned)--;
+                            uut.push(slots[returned - values.data()]);
+                        }
+                    }
+
+                    for (int* returned : taken)
+                    {
+                        (*returned)--;
+                        uut.push(slots[returned - values.data()]);
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // All the elements are free again, exactly once
+    EXPECT_EQ(num_elements, uut.size());
+    std::set<int*> free_values;
+    for (int* value = uut.pop(); nullptr != value; value = uut.pop())
+    {
+        EXPECT_EQ(0, *value);
+        EXPECT_TRUE(free_values.insert(value).second);
+    }
+    EXPECT_EQ(num_elements, free_values.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
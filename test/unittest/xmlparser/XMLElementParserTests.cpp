@@ -1726,6 +1726,7 @@ TEST_F(XMLParserTests, getXMLDurabilityQosKind)
  *      <writerPayloadSize>
  *      <mutation_tries>
  *      <avoid_builtin_multicast>
+ *      <lazy_builtin_endpoints>
  * 2. Check invalid element
  */
 TEST_F(XMLParserTests, getXMLBuiltinAttributes_NegativeClauses)
@@ -1764,7 +1765,8 @@ TEST_F(XMLParserTests, getXMLBuiltinAttributes_NegativeClauses)
         "readerPayloadSize",
         "writerPayloadSize",
         "mutation_tries",
-        "avoid_builtin_multicast"
+        "avoid_builtin_multicast",
+        "lazy_builtin_endpoints"
     };
 
     for (std::string tag : field_vec)
@@ -2435,6 +2437,7 @@ TEST_F(XMLParserTests, getXMLPartitionQos_NegativeClauses)
  *      <heartbeatPeriod>
  *      <nackResponseDelay>
  *      <nackSupressionDuration>
+ *      <adaptiveReliability>
  * 2. Check invalid element
  */
 TEST_F(XMLParserTests, getXMLWriterTimes_NegativeClauses)
@@ -2467,6 +2470,7 @@ TEST_F(XMLParserTests, getXMLWriterTimes_NegativeClauses)
         "heartbeatPeriod",
         "nackResponseDelay",
         "nackSupressionDuration",
+        "adaptiveReliability",
     };
 
     for (std::string tag : field_vec)
@@ -660,6 +660,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <calculate_crc>false</calculate_crc>\
                     <check_crc>false</check_crc>\
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
+                    <async_io_threads>4</async_io_threads>\
                     <tls><!-- TLS Section --></tls>\
                 </transport_descriptor>\
                 ";
@@ -692,6 +693,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv4Desc->async_io_threads, 4u);
         xmlparser::XMLProfileManager::DeleteInstance();
 
         // TCPv6
@@ -717,6 +719,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[1], 5200u);
+        EXPECT_EQ(pTCPv6Desc->async_io_threads, 4u);
         xmlparser::XMLProfileManager::DeleteInstance();
     }
 
@@ -802,6 +805,7 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "calculate_crc",
         "check_crc",
         "enable_tcp_nodelay",
+        "async_io_threads",
         "tls",
         "bad_element"
     };
@@ -2149,6 +2153,34 @@ TEST_F(XMLParserTests, parseXMLLibrarySettingsNegativeClauses)
     titleElement = xml_doc.RootElement();
     // Check that it returns an xml error when <intraprocess_delivery> is empty
     EXPECT_EQ(XMLP_ret::XML_ERROR, XMLParserTest::parseXMLLibrarySettings_wrapper(titleElement));
+
+    // Check that it returns an xml error when <thread_pools> has invalid values
+    const char* thread_pools_xml =
+            "\
+            <library_settings>\
+                <thread_pools>\
+                    %s\
+                </thread_pools>\
+            </library_settings>\
+            ";
+    char buffer[1000];
+    std::vector<std::string> wrong_contents =
+    {
+        "<bad_element>true</bad_element>",
+        "<enabled>maybe</enabled>",
+        "<timed_events><num_threads>0</num_threads></timed_events>",
+        "<timed_events><bad_element>1</bad_element></timed_events>",
+        "<async_writers><priority>high</priority></async_writers>",
+        "<async_writers><affinity>-1</affinity></async_writers>",
+        "<async_writers><affinity>3f</affinity></async_writers>"
+    };
+    for (const std::string& content : wrong_contents)
+    {
+        sprintf(buffer, thread_pools_xml, content.c_str());
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(buffer));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_ERROR, XMLParserTest::parseXMLLibrarySettings_wrapper(titleElement));
+    }
 }
 
 /*
@@ -213,6 +213,27 @@ TEST_F(XMLProfileParserTests, XMLParserLibrarySettings)
     EXPECT_EQ(library_settings.intraprocess_delivery, IntraprocessDeliveryType::INTRAPROCESS_FULL);
 }
 
+TEST_F(XMLProfileParserTests, XMLParserThreadPoolsSettings)
+{
+    // Library settings are not cleared between tests, so restore them for the rest
+    const LibrarySettingsAttributes original_settings = xmlparser::XMLProfileManager::library_settings();
+
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK,
+            xmlparser::XMLProfileManager::loadXMLFile("test_xml_thread_pools_profile.xml"));
+
+    const eprosima::fastdds::rtps::SharedThreadPoolsSettings& thread_pools =
+            xmlparser::XMLProfileManager::library_settings().thread_pools;
+    EXPECT_TRUE(thread_pools.enabled);
+    EXPECT_EQ(thread_pools.timed_events.num_threads, 2u);
+    EXPECT_EQ(thread_pools.timed_events.thread.priority, 5);
+    EXPECT_EQ(thread_pools.timed_events.thread.affinity, 12u);
+    EXPECT_EQ(thread_pools.async_writers.num_threads, 1u);
+    EXPECT_EQ(thread_pools.async_writers.thread.scheduling_policy, 0);
+    EXPECT_EQ(thread_pools.async_writers.thread.affinity, 0u);
+
+    xmlparser::XMLProfileManager::library_settings(original_settings);
+}
+
 TEST_F(XMLProfileParserTests, XMLParserParticipant)
 {
     std::string participant_profile = std::string("test_participant_profile");
@@ -268,6 +289,7 @@ TEST_F(XMLProfileParserTests, XMLParserParticipant)
     EXPECT_EQ(builtin.discovery_config.initial_announcements.period.seconds, 1);
     EXPECT_EQ(builtin.discovery_config.initial_announcements.period.nanosec, 827u);
     EXPECT_FALSE(builtin.avoid_builtin_multicast);
+    EXPECT_TRUE(builtin.lazy_builtin_endpoints);
     EXPECT_EQ(builtin.discovery_config.m_simpleEDP.use_PublicationWriterANDSubscriptionReader, false);
     EXPECT_EQ(builtin.discovery_config.m_simpleEDP.use_PublicationReaderANDSubscriptionWriter, true);
     IPLocator::setIPv4(locator, 192, 168, 1, 5);
@@ -346,6 +368,7 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultParticipantProfile)
     EXPECT_EQ(builtin.discovery_config.initial_announcements.period.seconds, 1);
     EXPECT_EQ(builtin.discovery_config.initial_announcements.period.nanosec, 827u);
     EXPECT_FALSE(builtin.avoid_builtin_multicast);
+    EXPECT_TRUE(builtin.lazy_builtin_endpoints);
     EXPECT_EQ(builtin.discovery_config.m_simpleEDP.use_PublicationWriterANDSubscriptionReader, false);
     EXPECT_EQ(builtin.discovery_config.m_simpleEDP.use_PublicationReaderANDSubscriptionWriter, true);
     IPLocator::setIPv4(locator, 192, 168, 1, 5);
@@ -425,6 +448,7 @@ TEST_F(XMLProfileParserTests, XMLParserPublisher)
     EXPECT_EQ(pub_times.nackResponseDelay, c_TimeZero);
     EXPECT_EQ(pub_times.nackSupressionDuration.seconds, 121);
     EXPECT_EQ(pub_times.nackSupressionDuration.nanosec, 332u);
+    EXPECT_TRUE(pub_times.adaptive_reliability);
     IPLocator::setIPv4(locator, 192, 168, 1, 3);
     locator.port = 197;
     EXPECT_EQ(*(loc_list_it = publisher_atts.unicastLocatorList.begin()), locator);
@@ -494,6 +518,7 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultPublisherProfile)
     EXPECT_EQ(pub_times.nackResponseDelay, c_TimeZero);
     EXPECT_EQ(pub_times.nackSupressionDuration.seconds, 121);
     EXPECT_EQ(pub_times.nackSupressionDuration.nanosec, 332u);
+    EXPECT_TRUE(pub_times.adaptive_reliability);
     IPLocator::setIPv4(locator, 192, 168, 1, 3);
     locator.port = 197;
     EXPECT_EQ(*(loc_list_it = publisher_atts.unicastLocatorList.begin()), locator);
@@ -731,6 +731,49 @@ TEST_F(XTypesTests, SimpleUnionCompleteCoercion)
     ASSERT_FALSE(basic_wide_union->consistent(*basic_union, consistencyQos));
 }
 
+TEST_F(XTypesTests, HashedIdentifierConsistencyCache)
+{
+    TypeConsistencyEnforcementQosPolicy consistencyQos;
+    const TypeIdentifier* basic_struct = GetBasicStructIdentifier(false);
+    const TypeIdentifier* basic_names_struct = GetBasicNamesStructIdentifier(false);
+    const TypeIdentifier* basic_wide_struct = GetBasicWideStructIdentifier(false);
+    ASSERT_TRUE(basic_struct != nullptr);
+    ASSERT_TRUE(basic_names_struct != nullptr);
+    ASSERT_TRUE(basic_wide_struct != nullptr);
+
+    // A copy of a registered identifier must resolve to the stored one
+    TypeIdentifier copy = *basic_struct;
+    TypeObjectFactory* factory = TypeObjectFactory::get_instance();
+    ASSERT_TRUE(factory->typelookup_check_type_identifier(copy));
+    ASSERT_EQ(factory->get_type_object(&copy), factory->get_type_object(basic_struct));
+    ASSERT_TRUE(factory->get_type_object(&copy) != nullptr);
+
+    consistencyQos.m_force_type_validation = true;
+    consistencyQos.m_ignore_member_names = true;
+    consistencyQos.m_ignore_sequence_bounds = true;
+    consistencyQos.m_ignore_string_bounds = true;
+    consistencyQos.m_prevent_type_widening = false;
+    consistencyQos.m_kind = ALLOW_TYPE_COERCION;
+
+    // Repeated checks must return the cached result
+    for (int i = 0; i < 2; ++i)
+    {
+        ASSERT_TRUE(basic_struct->consistent(*basic_names_struct, consistencyQos));
+        ASSERT_TRUE(basic_wide_struct->consistent(*basic_struct, consistencyQos));
+    }
+
+    // Results are cached per policy
+    consistencyQos.m_ignore_member_names = false;
+    ASSERT_FALSE(basic_struct->consistent(*basic_names_struct, consistencyQos));
+    consistencyQos.m_ignore_member_names = true;
+    ASSERT_TRUE(basic_struct->consistent(*basic_names_struct, consistencyQos));
+    consistencyQos.m_prevent_type_widening = true;
+    ASSERT_FALSE(basic_wide_struct->consistent(*basic_struct, consistencyQos));
+    consistencyQos.m_prevent_type_widening = false;
+    consistencyQos.m_kind = DISALLOW_TYPE_COERCION;
+    ASSERT_FALSE(basic_wide_struct->consistent(*basic_struct, consistencyQos));
+}
+
 int main(int argc, char **argv)
 {
     eprosima::fastdds::dds::Log::SetVerbosity(eprosima::fastdds::dds::Log::Info);